@@ -0,0 +1,52 @@
+//
+//  BenchmarkState.h
+//  CSBenchmarks
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARKS_BENCHMARKSTATE_H_
+#define _CSBENCHMARKS_BENCHMARKSTATE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/State.h>
+
+namespace CSBenchmarks
+{
+    //------------------------------------------------------------------------------
+    /// Runs each of the benchmarks against the state's scene when initialised.
+    /// Results are written to the log, so the application should be built with
+    /// optimisations enabled and CS_LOGLEVEL_VERBOSE defined.
+    ///
+    /// @author Carlos Artesano
+    //------------------------------------------------------------------------------
+    class BenchmarkState final : public CSCore::State
+    {
+    public:
+        void CreateSystems() override;
+        void OnInit() override;
+    };
+}
+
+#endif
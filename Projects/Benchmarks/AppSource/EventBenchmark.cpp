@@ -0,0 +1,133 @@
+//
+//  EventBenchmark.cpp
+//  CSBenchmarks
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <EventBenchmark.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Event.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Core/Time.h>
+
+#include <functional>
+#include <vector>
+
+namespace CSBenchmarks
+{
+    namespace EventBenchmark
+    {
+        namespace
+        {
+            typedef std::function<void(u32)> Delegate;
+            
+            const u32 k_listenerCounts[] = { 0, 1, 16 };
+            const u32 k_numNotifications = 2000000;
+            const u32 k_numConnections = 200000;
+            
+            //------------------------------------------------------------------------------
+            /// A listener which accumulates the values it is notified with, so the
+            /// notifications can't be optimised away.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            class Listener final
+            {
+            public:
+                void OnEvent(u32 in_value)
+                {
+                    m_total += in_value;
+                }
+                
+                u32 m_total = 0;
+            };
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The number of listeners connected to the event.
+            ///
+            /// @return The average time in nanoseconds taken to notify the event.
+            //------------------------------------------------------------------------------
+            f64 TimeNotify(u32 in_numListeners)
+            {
+                CSCore::Event<Delegate> event;
+                Listener listener;
+                
+                std::vector<CSCore::EventConnectionUPtr> connections;
+                for (u32 i = 0; i < in_numListeners; ++i)
+                {
+                    connections.push_back(event.OpenConnection(&listener, &Listener::OnEvent));
+                }
+                
+                CSCore::PerformanceTimer timer;
+                timer.Start();
+                for (u32 i = 0; i < k_numNotifications; ++i)
+                {
+                    event.NotifyConnections(i);
+                }
+                timer.Stop();
+                
+                CS_ASSERT(in_numListeners > 0 || listener.m_total == 0, "Listener was notified by an event it isn't connected to.");
+                return (timer.GetTimeTakenMicroS() * 1000.0) / k_numNotifications;
+            }
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The average time in nanoseconds taken to open and then close a
+            /// connection.
+            //------------------------------------------------------------------------------
+            f64 TimeOpenAndClose()
+            {
+                CSCore::Event<Delegate> event;
+                Listener listener;
+                
+                CSCore::PerformanceTimer timer;
+                timer.Start();
+                for (u32 i = 0; i < k_numConnections; ++i)
+                {
+                    CSCore::EventConnectionUPtr connection = event.OpenConnection(&listener, &Listener::OnEvent);
+                }
+                timer.Stop();
+                
+                return (timer.GetTimeTakenMicroS() * 1000.0) / k_numConnections;
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void Run()
+        {
+            for (u32 numListeners : k_listenerCounts)
+            {
+                f64 notifyTime = TimeNotify(numListeners);
+                CS_LOG_VERBOSE("NotifyConnections, " + CSCore::ToString(numListeners) + " listeners: " + CSCore::ToString(notifyTime) + "ns.");
+            }
+            
+            f64 openAndCloseTime = TimeOpenAndClose();
+            CS_LOG_VERBOSE("OpenConnection and close: " + CSCore::ToString(openAndCloseTime) + "ns.");
+        }
+    }
+}
@@ -0,0 +1,48 @@
+//
+//  EventBenchmark.h
+//  CSBenchmarks
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARKS_EVENTBENCHMARK_H_
+#define _CSBENCHMARKS_EVENTBENCHMARK_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace CSBenchmarks
+{
+    namespace EventBenchmark
+    {
+        //------------------------------------------------------------------------------
+        /// Measures the cost of Event::NotifyConnections() with 0, 1 and 16 listeners,
+        /// and the cost of opening and then closing a connection.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        void Run();
+    }
+}
+
+#endif
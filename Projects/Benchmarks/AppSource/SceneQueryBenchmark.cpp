@@ -0,0 +1,182 @@
+//
+//  SceneQueryBenchmark.cpp
+//  CSBenchmarks
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <SceneQueryBenchmark.h>
+
+#include <ChilliSource/Core/Base.h>
+#include <ChilliSource/Core/Entity.h>
+#include <ChilliSource/Core/Scene.h>
+#include <ChilliSource/Core/String.h>
+#include <ChilliSource/Core/Time.h>
+
+#include <vector>
+
+namespace CSBenchmarks
+{
+    namespace SceneQueryBenchmark
+    {
+        namespace
+        {
+            const u32 k_entityCounts[] = { 1000, 10000, 50000 };
+            const u32 k_numIterations = 100;
+            
+            //------------------------------------------------------------------------------
+            /// The component type which is queried for. Every entity has one.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            class QueriedComponent final : public CSCore::Component
+            {
+            public:
+                CS_DECLARE_NAMEDTYPE(QueriedComponent);
+                
+                bool IsA(CSCore::InterfaceIDType in_interfaceId) const override
+                {
+                    return (QueriedComponent::InterfaceID == in_interfaceId);
+                }
+            };
+            //------------------------------------------------------------------------------
+            /// A component type which isn't queried for, so the searches have something
+            /// to skip. Every other entity has one.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            class OtherComponent final : public CSCore::Component
+            {
+            public:
+                CS_DECLARE_NAMEDTYPE(OtherComponent);
+                
+                bool IsA(CSCore::InterfaceIDType in_interfaceId) const override
+                {
+                    return (OtherComponent::InterfaceID == in_interfaceId);
+                }
+            };
+            
+            CS_DEFINE_NAMEDTYPE(QueriedComponent);
+            CS_DEFINE_NAMEDTYPE(OtherComponent);
+            
+            //------------------------------------------------------------------------------
+            /// Populates the scene with the given number of entities.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The scene.
+            /// @param The number of entities.
+            //------------------------------------------------------------------------------
+            void PopulateScene(CSCore::Scene* in_scene, u32 in_numEntities)
+            {
+                std::vector<CSCore::EntitySPtr> entities;
+                entities.reserve(in_numEntities);
+                
+                for (u32 i = 0; i < in_numEntities; ++i)
+                {
+                    CSCore::EntitySPtr entity = CSCore::Entity::Create();
+                    if (i % 2 == 0)
+                    {
+                        entity->AddComponent(CSCore::ComponentSPtr(new OtherComponent()));
+                    }
+                    entity->AddComponent(CSCore::ComponentSPtr(new QueriedComponent()));
+                    entities.push_back(entity);
+                }
+                
+                in_scene->Add(entities);
+            }
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The scene.
+            ///
+            /// @return The average time in microseconds taken to query the scene using
+            /// the component pools.
+            //------------------------------------------------------------------------------
+            f64 TimePooledQuery(CSCore::Scene* in_scene)
+            {
+                std::vector<QueriedComponent*> components;
+                
+                CSCore::PerformanceTimer timer;
+                timer.Start();
+                for (u32 i = 0; i < k_numIterations; ++i)
+                {
+                    components.clear();
+                    in_scene->QuerySceneForComponents(components);
+                }
+                timer.Stop();
+                
+                CS_ASSERT(components.size() == in_scene->GetEntities().size(), "Pooled query returned the wrong number of components.");
+                return timer.GetTimeTakenMicroS() / k_numIterations;
+            }
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The scene.
+            ///
+            /// @return The average time in microseconds taken to query the scene by
+            /// scanning the component list of each entity.
+            //------------------------------------------------------------------------------
+            f64 TimeEntityScan(CSCore::Scene* in_scene)
+            {
+                std::vector<QueriedComponent*> components;
+                
+                CSCore::PerformanceTimer timer;
+                timer.Start();
+                for (u32 i = 0; i < k_numIterations; ++i)
+                {
+                    components.clear();
+                    for (const auto& entity : in_scene->GetEntities())
+                    {
+                        entity->GetComponents(components);
+                    }
+                }
+                timer.Stop();
+                
+                CS_ASSERT(components.size() == in_scene->GetEntities().size(), "Entity scan returned the wrong number of components.");
+                return timer.GetTimeTakenMicroS() / k_numIterations;
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void Run(CSCore::Scene* in_scene)
+        {
+            CS_ASSERT(in_scene->GetEntities().empty() == true, "The scene query benchmark requires an empty scene.");
+            
+            for (u32 numEntities : k_entityCounts)
+            {
+                PopulateScene(in_scene, numEntities);
+                
+                f64 pooledTime = TimePooledQuery(in_scene);
+                f64 scanTime = TimeEntityScan(in_scene);
+                
+                CS_LOG_VERBOSE("QuerySceneForComponents, " + CSCore::ToString(numEntities) + " entities: " + CSCore::ToString(pooledTime) + "us pooled, "
+                               + CSCore::ToString(scanTime) + "us entity scan.");
+                
+                in_scene->RemoveAllEntities();
+            }
+        }
+    }
+}
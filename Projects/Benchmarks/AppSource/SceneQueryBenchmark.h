@@ -0,0 +1,52 @@
+//
+//  SceneQueryBenchmark.h
+//  CSBenchmarks
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CSBENCHMARKS_SCENEQUERYBENCHMARK_H_
+#define _CSBENCHMARKS_SCENEQUERYBENCHMARK_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace CSBenchmarks
+{
+    namespace SceneQueryBenchmark
+    {
+        //------------------------------------------------------------------------------
+        /// Measures the cost of Scene::QuerySceneForComponents() on scenes of 1k, 10k
+        /// and 50k entities, and compares it against gathering the same components by
+        /// scanning each entity's component list, which is how scene queries were
+        /// performed prior to the introduction of per-type component pools.
+        ///
+        /// @author Carlos Artesano
+        ///
+        /// @param The scene to run the benchmark in. This must be empty.
+        //------------------------------------------------------------------------------
+        void Run(CSCore::Scene* in_scene);
+    }
+}
+
+#endif
@@ -57,7 +57,7 @@ namespace CSBackend
 			}
 
 			stream->SeekG(0, CSCore::SeekDir::k_end);
-			u32 length = stream->TellG();
+			u32 length = static_cast<u32>(stream->TellG());
 			stream->SeekG(0, CSCore::SeekDir::k_beginning);
 
 			std::unique_ptr<u8[]> bankBuffer(new u8[length]);
@@ -95,7 +95,7 @@ namespace CSBackend
 				}
 
 				stream->SeekG(0, CSCore::SeekDir::k_end);
-				u32 length = stream->TellG();
+				u32 length = static_cast<u32>(stream->TellG());
 				stream->SeekG(0, CSCore::SeekDir::k_beginning);
 
 				std::unique_ptr<u8[]> bankBuffer(new u8[length]);
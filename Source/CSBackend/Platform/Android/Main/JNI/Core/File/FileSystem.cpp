@@ -35,6 +35,7 @@
 #include <CSBackend/Platform/Android/Main/JNI/Core/Java/JavaStaticClass.h>
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 
 #include <cstdio>
@@ -357,6 +358,12 @@ namespace CSBackend
 		//------------------------------------------------------------------------------
 		CSCore::FileStreamUPtr FileSystem::CreateFileStream(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath, CSCore::FileMode in_fileMode) const
 		{
+			CSCore::FileStreamUPtr archiveFileStream = CreateFileStreamFromPackedArchive(in_storageLocation, in_filePath, in_fileMode);
+			if (archiveFileStream != nullptr)
+			{
+				return archiveFileStream;
+			}
+
 			switch (in_storageLocation)
 			{
 				case CSCore::StorageLocation::k_package:
@@ -402,6 +409,77 @@ namespace CSBackend
 		}
 		//------------------------------------------------------------------------------
 		//------------------------------------------------------------------------------
+		CSCore::MemoryMappedFileUPtr FileSystem::CreateMemoryMappedFile(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
+		{
+			CSCore::MemoryMappedFileUPtr archiveFile = CreateMemoryMappedFileFromPackedArchive(in_storageLocation, in_filePath);
+			if (archiveFile != nullptr)
+			{
+				return archiveFile;
+			}
+
+			//The read-only locations are inside the APK so can't be mapped, and files in writable
+			//locations could be changed or truncated while mapped, so both are read into a buffer.
+			return CSCore::FileSystem::CreateMemoryMappedFile(in_storageLocation, in_filePath);
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		bool FileSystem::TryGetFileInfo(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath, FileInfo& out_fileInfo) const
+		{
+			if (DoesFileExistInPackedArchive(in_storageLocation, in_filePath) == true)
+			{
+				return false;
+			}
+
+			std::string zippedFilePath;
+			std::string absFilePath;
+			switch (in_storageLocation)
+			{
+				case CSCore::StorageLocation::k_package:
+				case CSCore::StorageLocation::k_chilliSource:
+					zippedFilePath = GetAbsolutePathToStorageLocation(in_storageLocation) + CSCore::StringUtils::StandardiseFilePath(in_filePath);
+					break;
+				case CSCore::StorageLocation::k_DLC:
+					if (DoesFileExistInCachedDLC(in_filePath) == false)
+					{
+						zippedFilePath = GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_package) + GetPackageDLCPath() + CSCore::StringUtils::StandardiseFilePath(in_filePath);
+					}
+					else
+					{
+						absFilePath = GetAbsolutePathToStorageLocation(in_storageLocation) + CSCore::StringUtils::StandardiseFilePath(in_filePath);
+					}
+					break;
+				default:
+					absFilePath = GetAbsolutePathToStorageLocation(in_storageLocation) + CSCore::StringUtils::StandardiseFilePath(in_filePath);
+					break;
+			}
+
+			struct stat fileStats;
+			if (zippedFilePath.empty() == false)
+			{
+				//files in the APK can only change when the APK does, so the modification time of the APK is used.
+				ZippedFileSystem::FileInfo zippedFileInfo;
+				if (m_zippedFileSystem->TryGetFileInfo(zippedFilePath, zippedFileInfo) == false || stat(m_zipFilePath.c_str(), &fileStats) != 0)
+				{
+					return false;
+				}
+
+				out_fileInfo.m_size = static_cast<u64>(zippedFileInfo.m_uncompressedSize);
+			}
+			else
+			{
+				if (stat(absFilePath.c_str(), &fileStats) != 0 || S_ISREG(fileStats.st_mode) == false)
+				{
+					return false;
+				}
+
+				out_fileInfo.m_size = static_cast<u64>(fileStats.st_size);
+			}
+
+			out_fileInfo.m_modificationTime = static_cast<u64>(fileStats.st_mtime);
+			return true;
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
 		bool FileSystem::CreateDirectoryPath(CSCore::StorageLocation in_storageLocation, const std::string& in_directory) const
 		{
 			CS_ASSERT(IsStorageLocationWritable(in_storageLocation) == true, "Cannot create directory in read-only storage location.");
@@ -447,14 +525,14 @@ namespace CSBackend
             }
 
             sourceStream->SeekG(0, CSCore::SeekDir::k_end);
-            s32 length = sourceStream->TellG();
+            s64 length = sourceStream->TellG();
             sourceStream->SeekG(0, CSCore::SeekDir::k_beginning);
 
-            s32 progress = 0;
+            s64 progress = 0;
             s8 buffer[k_chunkSize];
             while (progress < length)
             {
-                s32 copySize = length - progress;
+                s64 copySize = length - progress;
                 if (copySize > k_chunkSize)
                 {
                     copySize = k_chunkSize;
@@ -599,7 +677,18 @@ namespace CSBackend
 			    case CSCore::StorageLocation::k_package:
 			    case CSCore::StorageLocation::k_chilliSource:
 			    {
-			        return m_zippedFileSystem->GetFilePaths(GetAbsolutePathToStorageLocation(in_storageLocation) + CSCore::StringUtils::StandardiseDirectoryPath(in_directoryPath), in_recursive);
+			        auto filePaths = m_zippedFileSystem->GetFilePaths(GetAbsolutePathToStorageLocation(in_storageLocation) + CSCore::StringUtils::StandardiseDirectoryPath(in_directoryPath), in_recursive);
+
+			        auto archiveFilePaths = GetFilePathsInPackedArchive(in_storageLocation, in_directoryPath, in_recursive);
+			        if (archiveFilePaths.empty() == false)
+			        {
+			            filePaths.insert(filePaths.end(), archiveFilePaths.begin(), archiveFilePaths.end());
+
+			            std::sort(filePaths.begin(), filePaths.end());
+			            auto it = std::unique(filePaths.begin(), filePaths.end());
+			            filePaths.resize(it - filePaths.begin());
+			        }
+			        return filePaths;
 			    }
 			    case CSCore::StorageLocation::k_DLC:
 			    {
@@ -612,6 +701,9 @@ namespace CSBackend
                         CS_LOG_ERROR("Failed to get file paths in directory '" + in_directoryPath + "' in storage location '" + CSCore::ToString(in_storageLocation) + "'");
                     }
 
+                    auto archiveFilePaths = GetFilePathsInPackedArchive(in_storageLocation, in_directoryPath, in_recursive);
+                    filePaths.insert(filePaths.end(), archiveFilePaths.begin(), archiveFilePaths.end());
+
                     std::sort(filePaths.begin(), filePaths.end());
                     auto it = std::unique(filePaths.begin(), filePaths.end());
                     filePaths.resize(it - filePaths.begin());
@@ -638,7 +730,18 @@ namespace CSBackend
                 case CSCore::StorageLocation::k_package:
                 case CSCore::StorageLocation::k_chilliSource:
                 {
-                    return m_zippedFileSystem->GetDirectoryPaths(GetAbsolutePathToStorageLocation(in_storageLocation) + CSCore::StringUtils::StandardiseDirectoryPath(in_directoryPath), in_recursive);
+                    auto directoryPaths = m_zippedFileSystem->GetDirectoryPaths(GetAbsolutePathToStorageLocation(in_storageLocation) + CSCore::StringUtils::StandardiseDirectoryPath(in_directoryPath), in_recursive);
+
+                    auto archiveDirectoryPaths = GetDirectoryPathsInPackedArchive(in_storageLocation, in_directoryPath, in_recursive);
+                    if (archiveDirectoryPaths.empty() == false)
+                    {
+                        directoryPaths.insert(directoryPaths.end(), archiveDirectoryPaths.begin(), archiveDirectoryPaths.end());
+
+                        std::sort(directoryPaths.begin(), directoryPaths.end());
+                        auto it = std::unique(directoryPaths.begin(), directoryPaths.end());
+                        directoryPaths.resize(it - directoryPaths.begin());
+                    }
+                    return directoryPaths;
                 }
                 case CSCore::StorageLocation::k_DLC:
                 {
@@ -651,6 +754,9 @@ namespace CSBackend
                         CS_LOG_ERROR("Failed to get directory paths in directory '" + in_directoryPath + "' in storage location '" + CSCore::ToString(in_storageLocation) + "'");
                     }
 
+                    auto archiveDirectoryPaths = GetDirectoryPathsInPackedArchive(in_storageLocation, in_directoryPath, in_recursive);
+                    subDirectoryPaths.insert(subDirectoryPaths.end(), archiveDirectoryPaths.begin(), archiveDirectoryPaths.end());
+
                     std::sort(subDirectoryPaths.begin(), subDirectoryPaths.end());
                     auto it = std::unique(subDirectoryPaths.begin(), subDirectoryPaths.end());
                     subDirectoryPaths.resize(it - subDirectoryPaths.begin());
@@ -672,6 +778,11 @@ namespace CSBackend
 		//------------------------------------------------------------------------------
 		bool FileSystem::DoesFileExist(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
 		{
+			if (DoesFileExistInPackedArchive(in_storageLocation, in_filePath) == true)
+			{
+				return true;
+			}
+
 			switch (in_storageLocation)
 			{
 				case CSCore::StorageLocation::k_package:
@@ -705,6 +816,11 @@ namespace CSBackend
 		//------------------------------------------------------------------------------
 		bool FileSystem::DoesDirectoryExist(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
 		{
+			if (DoesDirectoryExistInPackedArchive(in_storageLocation, in_directoryPath) == true)
+			{
+				return true;
+			}
+
 			switch (in_storageLocation)
 			{
 				case CSCore::StorageLocation::k_package:
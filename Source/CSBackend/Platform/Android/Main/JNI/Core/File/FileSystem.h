@@ -101,6 +101,39 @@ namespace CSBackend
 			//------------------------------------------------------------------------------
 			CSCore::FileStreamUPtr CreateFileStream(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath, CSCore::FileMode in_fileMode) const override;
 			//------------------------------------------------------------------------------
+			/// Memory maps the given file in the given storage location. Files inside
+			/// the APK, i.e in the package and chilli source storage locations or the
+			/// package DLC directory, cannot be mapped, and files in writable storage
+			/// locations shouldn't be as they could change while mapped. Other than
+			/// files in a packed archive, files are therefore read into a buffer which
+			/// backs the returned object.
+			///
+			/// This is thread-safe.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param in_storageLocation - The storage location.
+			/// @param in_filePath - The file path.
+			///
+			/// @return The new memory mapped file. If the file cannot be opened null will
+			/// be returned.
+			//------------------------------------------------------------------------------
+			CSCore::MemoryMappedFileUPtr CreateMemoryMappedFile(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const override;
+			//------------------------------------------------------------------------------
+			/// Gets the size and last modification time of the given file without opening
+			/// it. Files inside the APK report the modification time of the APK itself.
+			/// This fails for files in a packed archive.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param in_storageLocation - The storage location.
+			/// @param in_filePath - The file path.
+			/// @param out_fileInfo - [Out] The file info.
+			///
+			/// @return Whether or not the file info could be retrieved.
+			//------------------------------------------------------------------------------
+			bool TryGetFileInfo(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath, FileInfo& out_fileInfo) const override;
+			//------------------------------------------------------------------------------
 			/// Creates the given directory. The full directory hierarchy will be created.
             ///
             /// This is thread-safe.
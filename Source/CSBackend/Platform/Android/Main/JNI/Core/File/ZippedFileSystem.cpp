@@ -28,8 +28,7 @@
 
 #include <CSBackend/Platform/Android/Main/JNI/Core/File/ZippedFileSystem.h>
 
-#include <CSBackend/Platform/Android/Main/JNI/Core/File/VirtualFileStream.h>
-
+#include <ChilliSource/Core/File/VirtualFileStream.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
 
@@ -122,7 +121,7 @@ namespace CSBackend
 
             std::unique_ptr<u8[]> buffer(new u8[info.uncompressed_size]);
             unzReadCurrentFile(unzipper, (voidp)buffer.get(), info.uncompressed_size);
-            output = CSCore::FileStreamUPtr(new VirtualFileStream(std::move(buffer), info.uncompressed_size, in_fileMode));
+            output = CSCore::FileStreamUPtr(new CSCore::VirtualFileStream(std::move(buffer), info.uncompressed_size, in_fileMode));
             if (output->IsValid() == false)
             {
                 output = nullptr;
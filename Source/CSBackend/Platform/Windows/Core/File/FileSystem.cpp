@@ -33,6 +33,7 @@
 #include <CSBackend/Platform/Windows/Core/String/WindowsStringUtils.h>
 #include <ChilliSource/Core/Base/Utils.h>
 #include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 
 #include <iostream>
@@ -258,6 +259,14 @@ namespace CSBackend
 			{
 				CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to write to read only storage location.");
 			}
+			else
+			{
+				CSCore::FileStreamUPtr archiveFileStream = CreateFileStreamFromPackedArchive(in_storageLocation, in_filePath, in_fileMode);
+				if (archiveFileStream != nullptr)
+				{
+					return archiveFileStream;
+				}
+			}
 
 			if (in_storageLocation == CSCore::StorageLocation::k_DLC && DoesFileExistInCachedDLC(in_filePath) == false && IsWriteMode(in_fileMode) == false)
 			{
@@ -282,6 +291,61 @@ namespace CSBackend
 		}
 		//--------------------------------------------------------------
 		//--------------------------------------------------------------
+		CSCore::MemoryMappedFileUPtr FileSystem::CreateMemoryMappedFile(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
+		{
+			CSCore::MemoryMappedFileUPtr archiveFile = CreateMemoryMappedFileFromPackedArchive(in_storageLocation, in_filePath);
+			if (archiveFile != nullptr)
+			{
+				return archiveFile;
+			}
+
+			//Only read-only locations are mapped. Files in writable locations could be changed or
+			//truncated while mapped, so they are read into a buffer instead.
+			switch (in_storageLocation)
+			{
+				case CSCore::StorageLocation::k_package:
+				case CSCore::StorageLocation::k_chilliSource:
+				{
+					auto absFilePath = GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath;
+					return CSCore::MemoryMappedFile::Create(absFilePath);
+				}
+				default:
+				{
+					return CSCore::FileSystem::CreateMemoryMappedFile(in_storageLocation, in_filePath);
+				}
+			}
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
+		bool FileSystem::TryGetFileInfo(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath, FileInfo& out_fileInfo) const
+		{
+			if (DoesFileExistInPackedArchive(in_storageLocation, in_filePath) == true)
+			{
+				return false;
+			}
+
+			std::string absFilePath;
+			if (in_storageLocation == CSCore::StorageLocation::k_DLC && DoesFileExistInCachedDLC(in_filePath) == false)
+			{
+				absFilePath = GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_package) + GetPackageDLCPath() + in_filePath;
+			}
+			else
+			{
+				absFilePath = GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath;
+			}
+
+			WIN32_FILE_ATTRIBUTE_DATA attributes;
+			if (GetFileAttributesEx(WindowsStringUtils::ConvertStandardPathToWindows(absFilePath).c_str(), GetFileExInfoStandard, &attributes) == FALSE || (attributes.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+			{
+				return false;
+			}
+
+			out_fileInfo.m_size = (static_cast<u64>(attributes.nFileSizeHigh) << 32) | static_cast<u64>(attributes.nFileSizeLow);
+			out_fileInfo.m_modificationTime = (static_cast<u64>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | static_cast<u64>(attributes.ftLastWriteTime.dwLowDateTime);
+			return true;
+		}
+		//--------------------------------------------------------------
+		//--------------------------------------------------------------
 		bool FileSystem::CreateDirectoryPath(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
 		{
 			CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to write to read only storage location.");
@@ -423,6 +487,9 @@ namespace CSBackend
 				output.insert(output.end(), filePaths.begin(), filePaths.end());
 			}
 
+			std::vector<std::string> archiveFilePaths = GetFilePathsInPackedArchive(in_storageLocation, in_directoryPath, in_recursive);
+			output.insert(output.end(), archiveFilePaths.begin(), archiveFilePaths.end());
+
 			std::sort(output.begin(), output.end());
 			std::vector<std::string>::iterator it = std::unique(output.begin(), output.end());
 			output.resize(it - output.begin());
@@ -446,6 +513,9 @@ namespace CSBackend
 				output.insert(output.end(), directoryPaths.begin(), directoryPaths.end());
 			}
 
+			std::vector<std::string> archiveDirectoryPaths = GetDirectoryPathsInPackedArchive(in_storageLocation, in_directoryPath, in_recursive);
+			output.insert(output.end(), archiveDirectoryPaths.begin(), archiveDirectoryPaths.end());
+
 			std::sort(output.begin(), output.end());
 			std::vector<std::string>::iterator it = std::unique(output.begin(), output.end());
 			output.resize(it - output.begin());
@@ -455,6 +525,11 @@ namespace CSBackend
 		//--------------------------------------------------------------
 		bool FileSystem::DoesFileExist(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
 		{
+			if (DoesFileExistInPackedArchive(in_storageLocation, in_filePath) == true)
+			{
+				return true;
+			}
+
 			switch (in_storageLocation)
 			{
 				case CSCore::StorageLocation::k_DLC:
@@ -489,6 +564,11 @@ namespace CSBackend
 		//--------------------------------------------------------------
 		bool FileSystem::DoesDirectoryExist(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
 		{
+			if (DoesDirectoryExistInPackedArchive(in_storageLocation, in_directoryPath) == true)
+			{
+				return true;
+			}
+
 			switch (in_storageLocation)
 			{
 				case CSCore::StorageLocation::k_DLC:
@@ -75,6 +75,34 @@ namespace CSBackend
             //--------------------------------------------------------------
             CSCore::FileStreamUPtr CreateFileStream(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath, CSCore::FileMode in_fileMode) const override;
             //--------------------------------------------------------------
+            /// Memory maps the given file in the given storage location. Only the
+            /// read-only package and chilli source storage locations are mapped;
+            /// files in other locations are read into a buffer which backs the
+            /// returned object.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The storage location.
+            /// @param The file path.
+            ///
+            /// @return The new memory mapped file, or null if the file
+            /// could not be mapped.
+            //--------------------------------------------------------------
+            CSCore::MemoryMappedFileUPtr CreateMemoryMappedFile(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const override;
+            //--------------------------------------------------------------
+            /// Gets the size and last modification time of the given file
+            /// without opening it. This fails for files in a packed archive.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The storage location.
+            /// @param The file path.
+            /// @param [Out] The file info.
+            ///
+            /// @return Whether or not the file info could be retrieved.
+            //--------------------------------------------------------------
+            bool TryGetFileInfo(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath, FileInfo& out_fileInfo) const override;
+            //--------------------------------------------------------------
             /// Creates the given directory. The full directory hierarchy
             /// will be created.
             ///
@@ -32,11 +32,13 @@
 
 #import <CSBackend/Platform/iOS/Core/String/NSStringUtils.h>
 
+#import <ChilliSource/Core/File/MemoryMappedFile.h>
 #import <ChilliSource/Core/String/StringUtils.h>
 
 #import <iostream>
 #import <UIKit/UIKit.h>
 #import <sys/types.h>
+#import <sys/stat.h>
 #import <sys/sysctl.h>
 
 namespace CSBackend
@@ -292,6 +294,14 @@ namespace CSBackend
             {
                 CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to write to read only storage location.");
             }
+            else
+            {
+                CSCore::FileStreamUPtr archiveFileStream = CreateFileStreamFromPackedArchive(in_storageLocation, in_filePath, in_fileMode);
+                if (archiveFileStream != nullptr)
+                {
+                    return archiveFileStream;
+                }
+            }
             
             if (in_storageLocation == CSCore::StorageLocation::k_DLC && DoesFileExistInCachedDLC(in_filePath) == false && IsWriteMode(in_fileMode) == false)
             {
@@ -316,6 +326,61 @@ namespace CSBackend
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
+        CSCore::MemoryMappedFileUPtr FileSystem::CreateMemoryMappedFile(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            CSCore::MemoryMappedFileUPtr archiveFile = CreateMemoryMappedFileFromPackedArchive(in_storageLocation, in_filePath);
+            if (archiveFile != nullptr)
+            {
+                return archiveFile;
+            }
+            
+            //Only read-only locations are mapped. Files in writable locations could be changed or
+            //truncated while mapped, so they are read into a buffer instead.
+            switch (in_storageLocation)
+            {
+                case CSCore::StorageLocation::k_package:
+                case CSCore::StorageLocation::k_chilliSource:
+                {
+                    auto absFilePath = GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath;
+                    return CSCore::MemoryMappedFile::Create(absFilePath);
+                }
+                default:
+                {
+                    return CSCore::FileSystem::CreateMemoryMappedFile(in_storageLocation, in_filePath);
+                }
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::TryGetFileInfo(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath, FileInfo& out_fileInfo) const
+        {
+            if (DoesFileExistInPackedArchive(in_storageLocation, in_filePath) == true)
+            {
+                return false;
+            }
+            
+            std::string absFilePath;
+            if (in_storageLocation == CSCore::StorageLocation::k_DLC && DoesFileExistInCachedDLC(in_filePath) == false)
+            {
+                absFilePath = GetAbsolutePathToStorageLocation(CSCore::StorageLocation::k_package) + GetPackageDLCPath() + in_filePath;
+            }
+            else
+            {
+                absFilePath = GetAbsolutePathToStorageLocation(in_storageLocation) + in_filePath;
+            }
+            
+            struct stat fileStats;
+            if (stat(absFilePath.c_str(), &fileStats) != 0 || S_ISREG(fileStats.st_mode) == false)
+            {
+                return false;
+            }
+            
+            out_fileInfo.m_size = static_cast<u64>(fileStats.st_size);
+            out_fileInfo.m_modificationTime = static_cast<u64>(fileStats.st_mtimespec.tv_sec) * 1000000000 + static_cast<u64>(fileStats.st_mtimespec.tv_nsec);
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
         bool FileSystem::CreateDirectoryPath(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
         {
             CS_ASSERT(IsStorageLocationWritable(in_storageLocation), "File System: Trying to write to read only storage location.");
@@ -509,6 +574,9 @@ namespace CSBackend
                     output = ConvertObjCToPath(Filtered);
                 }
                 
+                std::vector<std::string> archiveFilePaths = GetFilePathsInPackedArchive(in_storageLocation, in_directoryPath, in_recursive);
+                output.insert(output.end(), archiveFilePaths.begin(), archiveFilePaths.end());
+                
                 std::sort(output.begin(), output.end());
                 std::vector<std::string>::iterator it = std::unique(output.begin(), output.end());
                 output.resize(it - output.begin());
@@ -536,6 +604,9 @@ namespace CSBackend
                     output = ConvertObjCToPath(Filtered);
                 }
                 
+                std::vector<std::string> archiveDirectoryPaths = GetDirectoryPathsInPackedArchive(in_storageLocation, in_directoryPath, in_recursive);
+                output.insert(output.end(), archiveDirectoryPaths.begin(), archiveDirectoryPaths.end());
+                
                 std::sort(output.begin(), output.end());
                 std::vector<std::string>::iterator it = std::unique(output.begin(), output.end());
                 output.resize(it - output.begin());
@@ -547,6 +618,11 @@ namespace CSBackend
         //--------------------------------------------------------------
         bool FileSystem::DoesFileExist(CSCore::StorageLocation in_storageLocation, const std::string& in_filePath) const
         {
+            if (DoesFileExistInPackedArchive(in_storageLocation, in_filePath) == true)
+            {
+                return true;
+            }
+            
             if(in_storageLocation == CSCore::StorageLocation::k_package)
             {
                 if(DoesFileExistInPackage(in_filePath))
@@ -590,6 +666,11 @@ namespace CSBackend
         //--------------------------------------------------------------
         bool FileSystem::DoesDirectoryExist(CSCore::StorageLocation in_storageLocation, const std::string& in_directoryPath) const
         {
+            if (DoesDirectoryExistInPackedArchive(in_storageLocation, in_directoryPath) == true)
+            {
+                return true;
+            }
+            
             if(in_storageLocation == CSCore::StorageLocation::k_package)
             {
                 if(DoesDirectoryExistInPackage(in_directoryPath))
@@ -29,20 +29,21 @@
 #ifdef CS_TARGETPLATFORM_IOS
 
 #import <ChilliSource/ChilliSource.h>
+#import <ChilliSource/Core/Math/RandomEngine.h>
 
 #import <Foundation/Foundation.h>
 
-#include <random>
-
 //------------------------------------------------------------------------------
 /// An objective C container for a C++ random number generator. This is required
-/// to store the RNG in a NSDictionary without potential memory leaks.
+/// to store the RNG in a NSDictionary without potential memory leaks. This also
+/// stores the engine of the inner most Random::ScopedEngine on the thread.
 ///
 /// @author Ian Copland.
 //------------------------------------------------------------------------------
 @interface RNGContainer : NSObject
 {
-    std::mt19937 m_rng;
+    CSCore::RandomEngine m_rng;
+    CSCore::RandomEngine* m_scopedRng;
 }
 //------------------------------------------------------------------------------
 /// Initialises the container with the given random number generator.
@@ -51,13 +52,28 @@
 ///
 /// @param The RNG.
 //------------------------------------------------------------------------------
--(id) initWithRNG: (const std::mt19937&)in_rng;
+-(id) initWithRNG: (const CSCore::RandomEngine&)in_rng;
 //------------------------------------------------------------------------------
 /// @author Ian Copland
 ///
 /// @return The RNG.
 //------------------------------------------------------------------------------
--(std::mt19937&) rng;
+-(CSCore::RandomEngine&) rng;
+//------------------------------------------------------------------------------
+/// @author Carlos Artesano
+///
+/// @return The engine of the inner most scoped engine on this thread, or nil
+/// if there isn't one.
+//------------------------------------------------------------------------------
+-(CSCore::RandomEngine*) scopedRng;
+//------------------------------------------------------------------------------
+/// Sets the engine of the inner most scoped engine on this thread.
+///
+/// @author Carlos Artesano
+///
+/// @param The engine. Can be null.
+//------------------------------------------------------------------------------
+-(void) setScopedRng: (CSCore::RandomEngine*)in_scopedRng;
 //------------------------------------------------------------------------------
 /// Destroys the container and the RNG.
 ///
@@ -34,11 +34,12 @@
 
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
--(id) initWithRNG: (const std::mt19937&)in_rng
+-(id) initWithRNG: (const CSCore::RandomEngine&)in_rng
 {
     if(self = [super init])
 	{
         m_rng = in_rng;
+        m_scopedRng = nullptr;
 		return self;
 	}
     
@@ -46,12 +47,24 @@
 }
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
--(std::mt19937&) rng
+-(CSCore::RandomEngine&) rng
 {
     return m_rng;
 }
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
+-(CSCore::RandomEngine*) scopedRng
+{
+    return m_scopedRng;
+}
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
+-(void) setScopedRng: (CSCore::RandomEngine*)in_scopedRng
+{
+    m_scopedRng = in_scopedRng;
+}
+//------------------------------------------------------------------------------
+//------------------------------------------------------------------------------
 -(void) dealloc
 {
     [super dealloc];
@@ -343,12 +343,20 @@ namespace CSBackend
             
             m_hasMipMaps = in_mipMap;
             
+            //a full mip chain adds roughly a third to the size of the texture.
+            m_memoryUsage = in_desc.m_dataSize;
+            if(m_hasMipMaps == true)
+            {
+                m_memoryUsage += m_memoryUsage / 3;
+            }
+            
 #ifdef CS_TARGETPLATFORM_ANDROID
             if (GetStorageLocation() == CSCore::StorageLocation::k_none && in_restoreTextureDataEnabled == true)
             {
             	m_restoreTextureDataEnabled = true;
                 m_restorationDataSize = in_desc.m_dataSize;
                 m_restorationData = std::move(in_data);
+                m_memoryUsage += m_restorationDataSize;
             }
 #endif
             
@@ -389,6 +397,12 @@ namespace CSBackend
         u32 Texture::GetHeight() const
         {
             return m_height;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        u64 Texture::GetMemoryUsage() const
+        {
+            return m_memoryUsage;
         }
 		//--------------------------------------------------
 		//--------------------------------------------------
@@ -500,6 +514,7 @@ namespace CSBackend
         {
             m_width = 0;
             m_height = 0;
+            m_memoryUsage = 0;
             
             m_hasFilterModeChanged = true;
             m_hasWrapModeChanged = true;
@@ -143,6 +143,14 @@ namespace CSBackend
             /// @return The height of the texture in texels
             //--------------------------------------------------
             u32 GetHeight() const;
+            //--------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return An estimate of the memory used by the
+            /// texture in bytes, including any mip maps and
+            /// restoration data.
+            //--------------------------------------------------
+            u64 GetMemoryUsage() const override;
             
 #ifdef CS_TARGETPLATFORM_ANDROID
             //--------------------------------------------------
@@ -199,6 +207,7 @@ namespace CSBackend
             
             u32 m_width = 0;
             u32 m_height = 0;
+            u64 m_memoryUsage = 0;
             CSCore::ImageFormat m_format;
             CSCore::ImageCompression m_compression;
             
@@ -34,7 +34,9 @@
 #include <ChilliSource/Core/Base/PlatformSystem.h>
 #include <ChilliSource/Core/Base/Screen.h>
 #include <ChilliSource/Core/DialogueBox/DialogueBoxSystem.h>
+#include <ChilliSource/Core/Entity/Transform.h>
 #include <ChilliSource/Core/File/AppDataStore.h>
+#include <ChilliSource/Core/File/AsyncFileReader.h>
 #include <ChilliSource/Core/File/TaggedFilePathResolver.h>
 #include <ChilliSource/Core/Image/CSImageProvider.h>
 #include <ChilliSource/Core/Image/PNGImageProvider.h>
@@ -64,17 +66,25 @@
 #include <ChilliSource/Rendering/Material/MaterialProvider.h>
 #include <ChilliSource/Rendering/Material/MaterialFactory.h>
 #include <ChilliSource/Rendering/Model/Mesh.h>
+#include <ChilliSource/Rendering/Model/SkinnedAnimation.h>
 #include <ChilliSource/Rendering/Particle/CSParticleProvider.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDefFactory.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawableDefFactory.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDefFactory.h>
+#include <ChilliSource/Rendering/Shader/Shader.h>
+#include <ChilliSource/Rendering/Texture/Cubemap.h>
 #include <ChilliSource/Rendering/Texture/CubemapProvider.h>
+#include <ChilliSource/Rendering/Texture/Texture.h>
+#include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlasProvider.h>
 #include <ChilliSource/Rendering/Texture/TextureProvider.h>
 
 #include <ChilliSource/UI/Base/ComponentFactory.h>
+#include <ChilliSource/UI/Base/WidgetDef.h>
 #include <ChilliSource/UI/Base/WidgetDefProvider.h>
 #include <ChilliSource/UI/Base/WidgetFactory.h>
+#include <ChilliSource/UI/Base/WidgetTemplate.h>
 #include <ChilliSource/UI/Base/WidgetTemplateProvider.h>
 
 #include <algorithm>
@@ -366,6 +376,7 @@ namespace ChilliSource
             
 			m_taskScheduler = CreateSystem<TaskScheduler>();
             m_fileSystem = CreateSystem<FileSystem>();
+            CreateSystem<AsyncFileReader>();
             m_stateManager = CreateSystem<StateManager>();
             m_resourcePool = CreateSystem<ResourcePool>();
             m_taggedPathResolver = CreateSystem<TaggedFilePathResolver>();
@@ -423,6 +434,20 @@ namespace ChilliSource
 				}
 			}
             
+            //Register the engine resource types so they can be preloaded.
+            m_resourcePool->RegisterResourceType<LocalisedText>();
+            m_resourcePool->RegisterResourceType<Rendering::Cubemap>();
+            m_resourcePool->RegisterResourceType<Rendering::Font>();
+            m_resourcePool->RegisterResourceType<Rendering::Material>();
+            m_resourcePool->RegisterResourceType<Rendering::Mesh>();
+            m_resourcePool->RegisterResourceType<Rendering::ParticleEffect>();
+            m_resourcePool->RegisterResourceType<Rendering::Shader>();
+            m_resourcePool->RegisterResourceType<Rendering::SkinnedAnimation>();
+            m_resourcePool->RegisterResourceType<Rendering::Texture>();
+            m_resourcePool->RegisterResourceType<Rendering::TextureAtlas>();
+            m_resourcePool->RegisterResourceType<UI::WidgetDef>(false);
+            m_resourcePool->RegisterResourceType<UI::WidgetTemplate>(false);
+            
             //Initialise the render system prior to the OnInit() event.
             m_renderSystem->Init();
             
@@ -449,6 +474,9 @@ namespace ChilliSource
             }
             
             m_stateManager->UpdateStates(in_deltaTime);
+            
+            //propagate any transform changes made during the update and notify listeners once per transform.
+            Transform::UpdateChangedTransforms();
 		}
         //----------------------------------------------------
         //----------------------------------------------------
@@ -36,6 +36,7 @@
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Container/ParamDictionary.h>
 #include <ChilliSource/Core/Container/ParamDictionarySerialiser.h>
+#include <ChilliSource/Core/Container/PoolAllocator.h>
 #include <ChilliSource/Core/Container/random_access_iterator.h>
 #include <ChilliSource/Core/Container/VectorUtils.h>
 #include <ChilliSource/Core/Container/Property/IProperty.h>
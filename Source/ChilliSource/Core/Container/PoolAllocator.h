@@ -0,0 +1,289 @@
+//
+//  PoolAllocator.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_CONTAINER_POOLALLOCATOR_H_
+#define _CHILLISOURCE_CORE_CONTAINER_POOLALLOCATOR_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //-------------------------------------------------------------
+        /// A std compatible allocator which allocates single objects
+        /// from a free list shared by all allocators of the same type.
+        /// Memory is taken from the heap in chunks and is never given
+        /// back; freed objects are returned to the free list for reuse,
+        /// so creating and destroying many objects of the same type
+        /// doesn't churn the heap.
+        ///
+        /// As rebinding the allocator gives a separate free list per
+        /// type, this can be used with std::allocate_shared to pool
+        /// both the object and its reference count in a single block.
+        /// See MakePooledShared().
+        ///
+        /// Allocating or freeing more than one object at a time falls
+        /// back on the heap. The free lists are thread safe.
+        ///
+        /// @author Carlos Artesano
+        //-------------------------------------------------------------
+        template <typename TType> class PoolAllocator final
+        {
+        public:
+            typedef TType value_type;
+            typedef TType* pointer;
+            typedef const TType* const_pointer;
+            typedef TType& reference;
+            typedef const TType& const_reference;
+            typedef std::size_t size_type;
+            typedef std::ptrdiff_t difference_type;
+            
+            template <typename TOtherType> struct rebind
+            {
+                typedef PoolAllocator<TOtherType> other;
+            };
+            //-------------------------------------------------------------
+            /// Constructor
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------------
+            PoolAllocator() = default;
+            //-------------------------------------------------------------
+            /// Converting constructor. The allocator is stateless so
+            /// nothing is copied.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The allocator to convert from.
+            //-------------------------------------------------------------
+            template <typename TOtherType> PoolAllocator(const PoolAllocator<TOtherType>& in_allocator) {}
+            //-------------------------------------------------------------
+            /// Ensures that at least the given number of objects can be
+            /// allocated without needing to go to the heap. This can be
+            /// used to warm the pool before a burst of allocations.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The number of objects to reserve.
+            //-------------------------------------------------------------
+            static void Reserve(u32 in_numObjects)
+            {
+                Lock();
+                while (s_numFreeBlocks < in_numObjects)
+                {
+                    AllocateChunk();
+                }
+                Unlock();
+            }
+            //-------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The number of objects to allocate.
+            /// @param Unused locality hint.
+            ///
+            /// @return Uninitialised memory for the objects.
+            //-------------------------------------------------------------
+            TType* allocate(std::size_t in_count, const void* in_hint = nullptr)
+            {
+                if (in_count != 1)
+                {
+                    return static_cast<TType*>(::operator new(in_count * sizeof(TType)));
+                }
+                
+                Lock();
+                if (s_freeList == nullptr)
+                {
+                    AllocateChunk();
+                }
+                
+                Block* block = s_freeList;
+                s_freeList = block->m_next;
+                --s_numFreeBlocks;
+                Unlock();
+                
+                return reinterpret_cast<TType*>(block);
+            }
+            //-------------------------------------------------------------
+            /// Returns the memory to the free list. The objects must
+            /// already have been destroyed.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The memory to free.
+            /// @param The number of objects it was allocated for.
+            //-------------------------------------------------------------
+            void deallocate(TType* in_pointer, std::size_t in_count)
+            {
+                if (in_count != 1)
+                {
+                    ::operator delete(in_pointer);
+                    return;
+                }
+                
+                Block* block = reinterpret_cast<Block*>(in_pointer);
+                
+                Lock();
+                block->m_next = s_freeList;
+                s_freeList = block;
+                ++s_numFreeBlocks;
+                Unlock();
+            }
+            //-------------------------------------------------------------
+            /// Constructs an object in memory from this allocator.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The memory to construct in.
+            /// @param The constructor arguments.
+            //-------------------------------------------------------------
+            template <typename TOtherType, typename... TArgs> void construct(TOtherType* in_pointer, TArgs&&... in_args)
+            {
+                ::new(static_cast<void*>(in_pointer)) TOtherType(std::forward<TArgs>(in_args)...);
+            }
+            //-------------------------------------------------------------
+            /// Destroys an object in memory from this allocator.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The object to destroy.
+            //-------------------------------------------------------------
+            template <typename TOtherType> void destroy(TOtherType* in_pointer)
+            {
+                in_pointer->~TOtherType();
+            }
+            //-------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The maximum number of objects in one allocation.
+            //-------------------------------------------------------------
+            std::size_t max_size() const
+            {
+                return std::size_t(-1) / sizeof(TType);
+            }
+            
+        private:
+            
+            static const u32 k_blocksPerChunk = 64;
+            
+            union Block
+            {
+                Block* m_next;
+                typename std::aligned_storage<sizeof(TType), std::alignment_of<TType>::value>::type m_storage;
+            };
+            //-------------------------------------------------------------
+            /// Allocates a new chunk of blocks from the heap and adds
+            /// them to the free list. The lock must be held.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------------
+            static void AllocateChunk()
+            {
+                Block* chunk = static_cast<Block*>(::operator new(sizeof(Block) * k_blocksPerChunk));
+                for (u32 i = 0; i < k_blocksPerChunk; ++i)
+                {
+                    chunk[i].m_next = (i + 1 < k_blocksPerChunk) ? &chunk[i + 1] : s_freeList;
+                }
+                
+                s_freeList = chunk;
+                s_numFreeBlocks += k_blocksPerChunk;
+            }
+            //-------------------------------------------------------------
+            /// Acquires the free list lock. This spins as the lock is
+            /// only ever held for a handful of instructions.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------------
+            static void Lock()
+            {
+                while (s_lock.test_and_set(std::memory_order_acquire) == true)
+                {
+                }
+            }
+            //-------------------------------------------------------------
+            /// Releases the free list lock.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------------
+            static void Unlock()
+            {
+                s_lock.clear(std::memory_order_release);
+            }
+            
+            static std::atomic_flag s_lock;
+            static Block* s_freeList;
+            static u32 s_numFreeBlocks;
+        };
+        
+        template <typename TType> std::atomic_flag PoolAllocator<TType>::s_lock = ATOMIC_FLAG_INIT;
+        template <typename TType> typename PoolAllocator<TType>::Block* PoolAllocator<TType>::s_freeList = nullptr;
+        template <typename TType> u32 PoolAllocator<TType>::s_numFreeBlocks = 0;
+        
+        //-------------------------------------------------------------
+        /// Pool allocators are stateless so all are interchangeable.
+        ///
+        /// @author Carlos Artesano
+        //-------------------------------------------------------------
+        template <typename TLhsType, typename TRhsType> bool operator==(const PoolAllocator<TLhsType>& in_lhs, const PoolAllocator<TRhsType>& in_rhs)
+        {
+            return true;
+        }
+        //-------------------------------------------------------------
+        /// Pool allocators are stateless so all are interchangeable.
+        ///
+        /// @author Carlos Artesano
+        //-------------------------------------------------------------
+        template <typename TLhsType, typename TRhsType> bool operator!=(const PoolAllocator<TLhsType>& in_lhs, const PoolAllocator<TRhsType>& in_rhs)
+        {
+            return false;
+        }
+        //-------------------------------------------------------------
+        /// Creates a shared object with the object and its reference
+        /// count allocated as a single block from a pool allocator.
+        /// This is the preferred way to create components which are
+        /// frequently created and destroyed.
+        ///
+        /// @author Carlos Artesano
+        ///
+        /// @param The constructor arguments.
+        ///
+        /// @return The new shared object.
+        //-------------------------------------------------------------
+        template <typename TType, typename... TArgs> std::shared_ptr<TType> MakePooledShared(TArgs&&... in_args)
+        {
+            return std::allocate_shared<TType>(PoolAllocator<TType>(), std::forward<TArgs>(in_args)...);
+        }
+    }
+}
+
+#endif
@@ -35,6 +35,7 @@
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
 #include <ChilliSource/Core/Cryptographic/HashMD5.h>
 #include <ChilliSource/Core/Cryptographic/HashSHA1.h>
+#include <ChilliSource/Core/Cryptographic/HashXXHash64.h>
 #include <ChilliSource/Core/Cryptographic/OAuth.h>
 
 #endif
@@ -0,0 +1,198 @@
+//
+//  HashXXHash64.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Cryptographic/HashXXHash64.h>
+
+#include <cstring>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace HashXXHash64
+        {
+            namespace
+            {
+                const u64 k_prime1 = 11400714785074694791ULL;
+                const u64 k_prime2 = 14029467366897019727ULL;
+                const u64 k_prime3 = 1609587929392839161ULL;
+                const u64 k_prime4 = 9650029242287828579ULL;
+                const u64 k_prime5 = 2870177450012600261ULL;
+                
+                //-------------------------------------------------------------
+                /// @author Carlos Artesano
+                ///
+                /// @param The value.
+                /// @param The number of bits to rotate by.
+                ///
+                /// @return The value rotated left by the given number of bits.
+                //-------------------------------------------------------------
+                inline u64 RotateLeft(u64 in_value, u32 in_bits)
+                {
+                    return (in_value << in_bits) | (in_value >> (64 - in_bits));
+                }
+                //-------------------------------------------------------------
+                /// Reads a little endian 64-bit value from unaligned memory.
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The data.
+                ///
+                /// @return The value.
+                //-------------------------------------------------------------
+                inline u64 Read64(const u8* in_data)
+                {
+                    u64 value = 0;
+                    memcpy(&value, in_data, sizeof(u64));
+                    return value;
+                }
+                //-------------------------------------------------------------
+                /// Reads a little endian 32-bit value from unaligned memory.
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The data.
+                ///
+                /// @return The value.
+                //-------------------------------------------------------------
+                inline u32 Read32(const u8* in_data)
+                {
+                    u32 value = 0;
+                    memcpy(&value, in_data, sizeof(u32));
+                    return value;
+                }
+                //-------------------------------------------------------------
+                /// Applies a single round of the hash to an accumulator.
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The accumulator.
+                /// @param The input lane.
+                ///
+                /// @return The new accumulator.
+                //-------------------------------------------------------------
+                inline u64 Round(u64 in_accumulator, u64 in_input)
+                {
+                    in_accumulator += in_input * k_prime2;
+                    in_accumulator = RotateLeft(in_accumulator, 31);
+                    return in_accumulator * k_prime1;
+                }
+                //-------------------------------------------------------------
+                /// Merges one of the four accumulators into the hash.
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The hash.
+                /// @param The accumulator.
+                ///
+                /// @return The new hash.
+                //-------------------------------------------------------------
+                inline u64 MergeRound(u64 in_hash, u64 in_accumulator)
+                {
+                    in_hash ^= Round(0, in_accumulator);
+                    return in_hash * k_prime1 + k_prime4;
+                }
+            }
+            //-------------------------------------------------------------
+            //-------------------------------------------------------------
+            u64 GenerateHashCode(const std::string& in_value, u64 in_seed)
+            {
+                return GenerateHashCode(in_value.data(), static_cast<u32>(in_value.size()), in_seed);
+            }
+            //-------------------------------------------------------------
+            //-------------------------------------------------------------
+            u64 GenerateHashCode(const s8* in_data, u32 in_sizeInBytes, u64 in_seed)
+            {
+                const u8* data = reinterpret_cast<const u8*>(in_data);
+                const u8* end = data + in_sizeInBytes;
+                
+                u64 hash = 0;
+                if (in_sizeInBytes >= 32)
+                {
+                    const u8* limit = end - 32;
+                    u64 accumulator1 = in_seed + k_prime1 + k_prime2;
+                    u64 accumulator2 = in_seed + k_prime2;
+                    u64 accumulator3 = in_seed;
+                    u64 accumulator4 = in_seed - k_prime1;
+                    
+                    do
+                    {
+                        accumulator1 = Round(accumulator1, Read64(data));
+                        accumulator2 = Round(accumulator2, Read64(data + 8));
+                        accumulator3 = Round(accumulator3, Read64(data + 16));
+                        accumulator4 = Round(accumulator4, Read64(data + 24));
+                        data += 32;
+                    }
+                    while (data <= limit);
+                    
+                    hash = RotateLeft(accumulator1, 1) + RotateLeft(accumulator2, 7) + RotateLeft(accumulator3, 12) + RotateLeft(accumulator4, 18);
+                    hash = MergeRound(hash, accumulator1);
+                    hash = MergeRound(hash, accumulator2);
+                    hash = MergeRound(hash, accumulator3);
+                    hash = MergeRound(hash, accumulator4);
+                }
+                else
+                {
+                    hash = in_seed + k_prime5;
+                }
+                
+                hash += static_cast<u64>(in_sizeInBytes);
+                
+                while (data + 8 <= end)
+                {
+                    hash ^= Round(0, Read64(data));
+                    hash = RotateLeft(hash, 27) * k_prime1 + k_prime4;
+                    data += 8;
+                }
+                
+                if (data + 4 <= end)
+                {
+                    hash ^= static_cast<u64>(Read32(data)) * k_prime1;
+                    hash = RotateLeft(hash, 23) * k_prime2 + k_prime3;
+                    data += 4;
+                }
+                
+                while (data < end)
+                {
+                    hash ^= static_cast<u64>(*data) * k_prime5;
+                    hash = RotateLeft(hash, 11) * k_prime1;
+                    ++data;
+                }
+                
+                //final avalanche
+                hash ^= hash >> 33;
+                hash *= k_prime2;
+                hash ^= hash >> 29;
+                hash *= k_prime3;
+                hash ^= hash >> 32;
+                
+                return hash;
+            }
+        }
+    }
+}
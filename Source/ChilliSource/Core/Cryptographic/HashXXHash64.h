@@ -0,0 +1,75 @@
+//
+//  HashXXHash64.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_CRYPTOGRAPHIC_HASHXXHASH64_H_
+#define _CHILLISOURCE_CORE_CRYPTOGRAPHIC_HASHXXHASH64_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //-------------------------------------------------------------
+        /// An implementation of the 64-bit xxHash algorithm. This is
+        /// a fast non-cryptographic hash, suitable for generating
+        /// identifiers where the number of inputs is large enough that
+        /// 32-bit hashes would risk collisions.
+        ///
+        /// @author Carlos Artesano
+        //-------------------------------------------------------------
+        namespace HashXXHash64
+        {
+            //-------------------------------------------------------------
+            /// Generate Hash Code
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param String to hash
+            /// @param [Optional] The seed. Defaults to 0.
+            ///
+            /// @return 64-bit xxHash hash code
+            //-------------------------------------------------------------
+            u64 GenerateHashCode(const std::string& in_value, u64 in_seed = 0);
+            //-------------------------------------------------------------
+            /// Generate Hash Code
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Data to hash
+            /// @param Size of data in bytes
+            /// @param [Optional] The seed. Defaults to 0.
+            ///
+            /// @return 64-bit xxHash hash code
+            //-------------------------------------------------------------
+            u64 GenerateHashCode(const s8* in_data, u32 in_sizeInBytes, u64 in_seed = 0);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,422 @@
+//
+//  InlineDelegate.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_DELEGATE_INLINEDELEGATE_H_
+#define _CHILLISOURCE_CORE_DELEGATE_INLINEDELEGATE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ChilliSource
+{
+	namespace Core
+	{
+        //------------------------------------------------------------------
+        /// A delegate with the given signature which stores small callables,
+        /// such as member function delegates and lambdas with a few
+        /// captures, inline rather than on the heap. Larger callables fall
+        /// back on a heap allocation.
+        ///
+        /// Member function delegates are constructed directly from an
+        /// instance and a member function pointer, which unlike
+        /// MakeDelegate() never requires an allocation.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------
+        template <typename TReturnType, typename... TArgTypes> class InlineDelegate<TReturnType(TArgTypes...)> final
+        {
+        public:
+            //------------------------------------------------------------------
+            /// The size of the inline storage. Callables larger than this are
+            /// stored on the heap.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------
+            static const u32 k_inlineSize = 4 * sizeof(void*);
+            //------------------------------------------------------------------
+            /// Constructs an empty delegate.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------
+            InlineDelegate() = default;
+            //------------------------------------------------------------------
+            /// Constructs a delegate from any callable with a compatible
+            /// signature.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The callable.
+            //------------------------------------------------------------------
+            template <typename TCallable, typename = typename std::enable_if<!std::is_same<typename std::decay<TCallable>::type, InlineDelegate>::value>::type>
+            InlineDelegate(TCallable&& in_callable)
+            {
+                Store(std::forward<TCallable>(in_callable));
+            }
+            //------------------------------------------------------------------
+            /// Constructs a delegate to a member function. This is always
+            /// stored inline.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Instance whose function to call
+            /// @param Member function ptr, which may be const.
+            //------------------------------------------------------------------
+            template <typename TSender, typename TMemberFunction>
+            InlineDelegate(TSender* in_sender, TMemberFunction in_memberFunction)
+            {
+                static_assert(std::is_member_function_pointer<TMemberFunction>::value, "Must be constructed with a member function pointer.");
+                
+                Store(MemberFunctionCaller<TSender, TMemberFunction>(in_sender, in_memberFunction));
+            }
+            //------------------------------------------------------------------
+            /// Copy constructor
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The delegate to copy.
+            //------------------------------------------------------------------
+            InlineDelegate(const InlineDelegate& in_toCopy)
+            {
+                CopyFrom(in_toCopy);
+            }
+            //------------------------------------------------------------------
+            /// Move constructor
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The delegate to move.
+            //------------------------------------------------------------------
+            InlineDelegate(InlineDelegate&& in_toMove)
+            {
+                MoveFrom(in_toMove);
+            }
+            //------------------------------------------------------------------
+            /// Copy assignment
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The delegate to copy.
+            ///
+            /// @return This
+            //------------------------------------------------------------------
+            InlineDelegate& operator=(const InlineDelegate& in_toCopy)
+            {
+                if (this != &in_toCopy)
+                {
+                    Clear();
+                    CopyFrom(in_toCopy);
+                }
+                return *this;
+            }
+            //------------------------------------------------------------------
+            /// Move assignment
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The delegate to move.
+            ///
+            /// @return This
+            //------------------------------------------------------------------
+            InlineDelegate& operator=(InlineDelegate&& in_toMove)
+            {
+                if (this != &in_toMove)
+                {
+                    Clear();
+                    MoveFrom(in_toMove);
+                }
+                return *this;
+            }
+            //------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return Whether or not the delegate is set.
+            //------------------------------------------------------------------
+            explicit operator bool() const
+            {
+                return (m_invoke != nullptr);
+            }
+            //------------------------------------------------------------------
+            /// Calls the delegate. The delegate must be set.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The arguments.
+            ///
+            /// @return The return value of the delegate.
+            //------------------------------------------------------------------
+            TReturnType operator()(TArgTypes... in_args) const
+            {
+                return m_invoke(const_cast<void*>(static_cast<const void*>(&m_storage)), std::forward<TArgTypes>(in_args)...);
+            }
+            //------------------------------------------------------------------
+            /// Destructor
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------
+            ~InlineDelegate()
+            {
+                Clear();
+            }
+            
+        private:
+            
+            enum class Operation
+            {
+                k_copy,
+                k_move,
+                k_destroy
+            };
+            
+            typedef typename std::aligned_storage<k_inlineSize>::type Storage;
+            typedef TReturnType (*InvokeFunction)(void*, TArgTypes...);
+            typedef void (*ManageFunction)(Operation, void*, void*);
+            
+            //------------------------------------------------------------------
+            /// Calls a member function on an instance.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------
+            template <typename TSender, typename TMemberFunction> struct MemberFunctionCaller
+            {
+                MemberFunctionCaller(TSender* in_sender, TMemberFunction in_memberFunction)
+                : m_sender(in_sender), m_memberFunction(in_memberFunction)
+                {
+                }
+                
+                TReturnType operator()(TArgTypes... in_args) const
+                {
+                    return (m_sender->*m_memberFunction)(std::forward<TArgTypes>(in_args)...);
+                }
+                
+                TSender* m_sender;
+                TMemberFunction m_memberFunction;
+            };
+            //------------------------------------------------------------------
+            /// Whether or not the given callable type is stored inline.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------
+            template <typename TCallable> struct IsStoredInline
+            {
+                static const bool value = sizeof(TCallable) <= k_inlineSize && std::alignment_of<TCallable>::value <= std::alignment_of<Storage>::value;
+            };
+            //------------------------------------------------------------------
+            /// Stores the callable, choosing inline or heap storage.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The callable.
+            //------------------------------------------------------------------
+            template <typename TCallable> void Store(TCallable&& in_callable)
+            {
+                typedef typename std::decay<TCallable>::type Callable;
+                
+                if (IsNull(in_callable) == false)
+                {
+                    Store<Callable>(std::forward<TCallable>(in_callable), std::integral_constant<bool, IsStoredInline<Callable>::value>());
+                }
+            }
+            //------------------------------------------------------------------
+            /// Stores the callable inline.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The callable.
+            //------------------------------------------------------------------
+            template <typename TStoredCallable, typename TCallable> void Store(TCallable&& in_callable, std::true_type)
+            {
+                new (&m_storage) TStoredCallable(std::forward<TCallable>(in_callable));
+                m_invoke = &InvokeInline<TStoredCallable>;
+                m_manage = &ManageInline<TStoredCallable>;
+            }
+            //------------------------------------------------------------------
+            /// Stores the callable on the heap.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The callable.
+            //------------------------------------------------------------------
+            template <typename TStoredCallable, typename TCallable> void Store(TCallable&& in_callable, std::false_type)
+            {
+                new (&m_storage) TStoredCallable*(new TStoredCallable(std::forward<TCallable>(in_callable)));
+                m_invoke = &InvokeHeap<TStoredCallable>;
+                m_manage = &ManageHeap<TStoredCallable>;
+            }
+            //------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The callable.
+            ///
+            /// @return Whether the callable is a null std::function or
+            /// function pointer, which results in an empty delegate.
+            //------------------------------------------------------------------
+            template <typename TCallable> static bool IsNull(const TCallable& in_callable)
+            {
+                return false;
+            }
+            template <typename TSignature> static bool IsNull(const std::function<TSignature>& in_callable)
+            {
+                return !in_callable;
+            }
+            template <typename TFunctionReturnType, typename... TFunctionArgTypes> static bool IsNull(TFunctionReturnType (*in_callable)(TFunctionArgTypes...))
+            {
+                return (in_callable == nullptr);
+            }
+            //------------------------------------------------------------------
+            /// Invokes a callable stored inline.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------
+            template <typename TCallable> static TReturnType InvokeInline(void* in_storage, TArgTypes... in_args)
+            {
+                return (*static_cast<TCallable*>(in_storage))(std::forward<TArgTypes>(in_args)...);
+            }
+            //------------------------------------------------------------------
+            /// Invokes a callable stored on the heap.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------
+            template <typename TCallable> static TReturnType InvokeHeap(void* in_storage, TArgTypes... in_args)
+            {
+                return (**static_cast<TCallable**>(in_storage))(std::forward<TArgTypes>(in_args)...);
+            }
+            //------------------------------------------------------------------
+            /// Copies, moves or destroys a callable stored inline.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------
+            template <typename TCallable> static void ManageInline(Operation in_operation, void* in_destination, void* in_source)
+            {
+                switch (in_operation)
+                {
+                    case Operation::k_copy:
+                        new (in_destination) TCallable(*static_cast<const TCallable*>(in_source));
+                        break;
+                    case Operation::k_move:
+                        new (in_destination) TCallable(std::move(*static_cast<TCallable*>(in_source)));
+                        static_cast<TCallable*>(in_source)->~TCallable();
+                        break;
+                    case Operation::k_destroy:
+                        static_cast<TCallable*>(in_destination)->~TCallable();
+                        break;
+                }
+            }
+            //------------------------------------------------------------------
+            /// Copies, moves or destroys a callable stored on the heap.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------
+            template <typename TCallable> static void ManageHeap(Operation in_operation, void* in_destination, void* in_source)
+            {
+                switch (in_operation)
+                {
+                    case Operation::k_copy:
+                        new (in_destination) TCallable*(new TCallable(**static_cast<TCallable* const*>(in_source)));
+                        break;
+                    case Operation::k_move:
+                        new (in_destination) TCallable*(*static_cast<TCallable**>(in_source));
+                        break;
+                    case Operation::k_destroy:
+                        delete *static_cast<TCallable**>(in_destination);
+                        break;
+                }
+            }
+            //------------------------------------------------------------------
+            /// Copies the callable from the given delegate. This must be
+            /// empty.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The delegate to copy.
+            //------------------------------------------------------------------
+            void CopyFrom(const InlineDelegate& in_toCopy)
+            {
+                if (in_toCopy.m_invoke != nullptr)
+                {
+                    in_toCopy.m_manage(Operation::k_copy, &m_storage, const_cast<Storage*>(&in_toCopy.m_storage));
+                    m_invoke = in_toCopy.m_invoke;
+                    m_manage = in_toCopy.m_manage;
+                }
+            }
+            //------------------------------------------------------------------
+            /// Moves the callable from the given delegate, leaving it empty.
+            /// This must be empty.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The delegate to move.
+            //------------------------------------------------------------------
+            void MoveFrom(InlineDelegate& in_toMove)
+            {
+                if (in_toMove.m_invoke != nullptr)
+                {
+                    in_toMove.m_manage(Operation::k_move, &m_storage, &in_toMove.m_storage);
+                    m_invoke = in_toMove.m_invoke;
+                    m_manage = in_toMove.m_manage;
+                    in_toMove.m_invoke = nullptr;
+                    in_toMove.m_manage = nullptr;
+                }
+            }
+            //------------------------------------------------------------------
+            /// Destroys the stored callable, leaving the delegate empty.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------
+            void Clear()
+            {
+                if (m_invoke != nullptr)
+                {
+                    m_manage(Operation::k_destroy, &m_storage, nullptr);
+                    m_invoke = nullptr;
+                    m_manage = nullptr;
+                }
+            }
+            
+            Storage m_storage;
+            InvokeFunction m_invoke = nullptr;
+            ManageFunction m_manage = nullptr;
+        };
+        //------------------------------------------------------------------
+        /// Maps a std::function type to the inline delegate with the same
+        /// signature.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------
+        template <typename TDelegateType> struct ToInlineDelegate;
+        template <typename TSignature> struct ToInlineDelegate<std::function<TSignature>>
+        {
+            typedef InlineDelegate<TSignature> Type;
+        };
+	}
+}
+
+#endif
@@ -32,6 +32,8 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Entity/Component.h>
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Entity/Prefab.h>
 #include <ChilliSource/Core/Entity/Transform.h>
+#include <ChilliSource/Core/Entity/TransformHierarchy.h>
 
 #endif
\ No newline at end of file
@@ -61,6 +61,18 @@ namespace ChilliSource
 		}
         //----------------------------------------------------
         //----------------------------------------------------
+        u64 Component::GetSceneInsertionOrder() const
+        {
+            return m_sceneInsertionOrder;
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
+        bool Component::IsUpdatePhaseRequired(UpdatePhase in_phase) const
+        {
+            return (in_phase != UpdatePhase::k_parallelUpdate);
+        }
+        //----------------------------------------------------
+        //----------------------------------------------------
         void Component::RemoveFromEntity()
         {
             CS_ASSERT(m_entity != nullptr, "Must have an entity to remove from");
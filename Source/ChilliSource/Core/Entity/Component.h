@@ -41,6 +41,18 @@ namespace ChilliSource
 		public:
             CS_DECLARE_NOCOPY(Component);
             //----------------------------------------------------
+            /// The update phases a component can receive.
+            ///
+            /// @author Carlos Artesano
+            //----------------------------------------------------
+            enum class UpdatePhase
+            {
+                k_parallelUpdate,
+                k_update,
+                k_fixedUpdate,
+                k_total
+            };
+            //----------------------------------------------------
             /// Constructor
             ///
             /// @author S McGaw
@@ -72,6 +84,44 @@ namespace ChilliSource
             /// @author S Downie
             //----------------------------------------------------
             void RemoveFromEntity();
+            //----------------------------------------------------
+            /// Scene queries return components in this order. It
+            /// can also be used to determine which of a group of
+            /// components was added to the scene most recently.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return A number which increases each time any
+            /// component is added to a scene.
+            //----------------------------------------------------
+            u64 GetSceneInsertionOrder() const;
+            //----------------------------------------------------
+            /// Declares whether or not the component needs to
+            /// receive the given update phase. The scene only
+            /// iterates the components which require a phase, so
+            /// components which do nothing on update should
+            /// return false. This is queried once when the
+            /// component is added to a scene, so must always
+            /// return the same result.
+            ///
+            /// By default the update and fixed update phases are
+            /// required. A component which opts out of a phase
+            /// should be final, otherwise a subclass overriding
+            /// the corresponding update method would silently
+            /// never be called; the engine components which opt
+            /// out are final for this reason.
+            ///
+            /// Requiring the parallel update phase declares that
+            /// the component's OnParallelUpdate() only accesses
+            /// data belonging to its own entity.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The update phase.
+            ///
+            /// @return Whether or not the phase is required.
+            //----------------------------------------------------
+            virtual bool IsUpdatePhaseRequired(UpdatePhase in_phase) const;
 			
 		protected:
 		
@@ -121,6 +171,24 @@ namespace ChilliSource
             //----------------------------------------------------
             virtual void OnUpdate(f32 in_timeSinceLastUpdate){}
             //----------------------------------------------------
+            /// Called during the parallel update phase if the
+            /// component requires it. This occurs prior to the
+            /// update phase and may be called on any thread,
+            /// concurrently with components from other entities.
+            /// Components from entities in the same hierarchy are
+            /// always updated on the same thread. Implementations
+            /// must only read and write data belonging to their
+            /// own entity and must not add or remove entities or
+            /// components. The entity's transform can be changed,
+            /// though not re-parented; its transform changed event
+            /// is still notified at the end of the frame.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Time since last update in seconds
+            //----------------------------------------------------
+            virtual void OnParallelUpdate(f32 in_timeSinceLastUpdate){}
+            //----------------------------------------------------
             /// Fixed update is triggered at fixed time periods
             ///
             /// @author S Downie
@@ -170,6 +238,7 @@ namespace ChilliSource
         private:
             
             friend class Entity;
+            friend class Scene;
             //----------------------------------------------------
 			/// @author S Downie
             ///
@@ -180,6 +249,9 @@ namespace ChilliSource
 		private:
             
 			Entity * m_entity;
+            u32 m_scenePoolIndex = 0;
+            u32 m_sceneUpdateListIndices[static_cast<u32>(UpdatePhase::k_total)];
+            u64 m_sceneInsertionOrder = 0;
 		};
 	}
 }
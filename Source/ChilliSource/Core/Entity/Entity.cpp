@@ -27,10 +27,13 @@
 //
 
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Container/PoolAllocator.h>
+#include <ChilliSource/Core/Entity/TransformHierarchy.h>
 #include <ChilliSource/Core/Scene/Scene.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 
 #include <algorithm>
+#include <limits>
 
 namespace ChilliSource
 {
@@ -40,6 +43,7 @@ namespace ChilliSource
         {
             const EntitySPtr EntityNullPtr;
             const ComponentSPtr ComponentNullPtr;
+            const u32 k_noComponent = std::numeric_limits<u32>::max();
         }
         
         //------------------------------------------------------------------
@@ -48,6 +52,19 @@ namespace ChilliSource
 		{
 			return EntityUPtr(new Entity());
 		}
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        EntitySPtr Entity::CreatePooled()
+        {
+            PoolAllocator<Entity> allocator;
+            Entity* entity = new (allocator.allocate(1)) Entity();
+            
+            return EntitySPtr(entity, [](Entity* in_entity)
+            {
+                in_entity->~Entity();
+                PoolAllocator<Entity>().deallocate(in_entity, 1);
+            }, allocator);
+        }
 		//-------------------------------------------------------------
 		//-------------------------------------------------------------
 		void Entity::AddEntity(const EntitySPtr& in_child)
@@ -58,6 +75,7 @@ namespace ChilliSource
             CS_ASSERT(m_children.size() < static_cast<std::vector<EntitySPtr>::size_type>(std::numeric_limits<u32>::max()), "There are too many child entities. It cannot exceed "
                       + CSCore::ToString(std::numeric_limits<u32>::max()) + ".");
             
+            in_child->m_childIndex = static_cast<u32>(m_children.size());
             m_children.push_back(in_child);
             m_transform.AddChildTransform(&in_child->GetTransform());
             in_child->m_parent = this;
@@ -68,6 +86,14 @@ namespace ChilliSource
 				m_scene->Add(in_child);
 			}
 		}
+        //-------------------------------------------------------------
+        //-------------------------------------------------------------
+        void Entity::Reserve(u32 in_numComponents, u32 in_numChildren)
+        {
+            m_components.reserve(in_numComponents);
+            m_children.reserve(in_numChildren);
+            m_transform.ReserveChildTransforms(in_numChildren);
+        }
 		//-------------------------------------------------------------
 		//-------------------------------------------------------------
 		void Entity::RemoveEntity(Entity* in_child)
@@ -75,24 +101,21 @@ namespace ChilliSource
             CS_ASSERT(in_child != nullptr, "Cannot remove null child");
             CS_ASSERT(in_child->GetParent() == this, "Cannot remove entity that is not a child of this");
             
-			SharedEntityList::iterator it = std::find_if(m_children.begin(), m_children.end(), [in_child](const EntitySPtr& in_entity)
+            m_transform.RemoveChildTransform(&in_child->GetTransform());
+            
+            if(m_scene != nullptr)
             {
-                return in_entity.get() == in_child;
-            });
-			
-			if(it != m_children.end())
-			{
-				m_transform.RemoveChildTransform(&in_child->GetTransform());
-				
-				if(m_scene != nullptr)
-				{
-					m_scene->Remove(in_child);
-				}
-                
-                in_child->m_parent = nullptr;
-                std::swap(m_children.back(), *it);
-				m_children.pop_back();
-			}
+                m_scene->Remove(in_child);
+            }
+            
+            //the child index is read after removal from the scene as siblings may have been removed by scene callbacks.
+            const u32 childIndex = in_child->m_childIndex;
+            CS_ASSERT(childIndex < m_children.size() && m_children[childIndex].get() == in_child, "Child index is out of date.");
+            
+            in_child->m_parent = nullptr;
+            m_children[childIndex].swap(m_children.back());
+            m_children[childIndex]->m_childIndex = childIndex;
+            m_children.pop_back();
 		}
 		//-------------------------------------------------------------
 		//-------------------------------------------------------------
@@ -143,9 +166,28 @@ namespace ChilliSource
         //------------------------------------------------------------------
         const EntitySPtr& Entity::GetEntityWithName(const std::string& in_name) const
         {
+            //if the name has never been interned then no entity can have it.
+            InternedString name;
+            if (InternedString::TryGetExisting(in_name, name) == false)
+            {
+                return EntityNullPtr;
+            }
+            
+            return GetEntityWithName(name);
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        const EntitySPtr& Entity::GetEntityWithName(const InternedString& in_name) const
+        {
+            const Entity* entity = nullptr;
+            if (FindInNameIndex(in_name, false, entity) == true)
+            {
+                return (entity != nullptr) ? entity->m_parent->m_children[entity->m_childIndex] : EntityNullPtr;
+            }
+            
             for(SharedEntityList::const_iterator it = m_children.begin(); it != m_children.end(); ++it)
             {
-                if((*it)->GetName() == in_name)
+                if((*it)->m_name == in_name)
                 {
                     return (*it);
                 }
@@ -157,9 +199,27 @@ namespace ChilliSource
 		//------------------------------------------------------------------
 		const EntitySPtr& Entity::GetEntityWithNameRecursive(const std::string& in_name) const
 		{
+            InternedString name;
+            if (InternedString::TryGetExisting(in_name, name) == false)
+            {
+                return EntityNullPtr;
+            }
+            
+            return GetEntityWithNameRecursive(name);
+		}
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        const EntitySPtr& Entity::GetEntityWithNameRecursive(const InternedString& in_name) const
+        {
+            const Entity* entity = nullptr;
+            if (FindInNameIndex(in_name, true, entity) == true)
+            {
+                return (entity != nullptr) ? entity->m_parent->m_children[entity->m_childIndex] : EntityNullPtr;
+            }
+            
             for (SharedEntityList::const_iterator it = m_children.begin(); it != m_children.end(); ++it)
             {
-                if((*it)->GetName() == in_name)
+                if((*it)->m_name == in_name)
                 {
                     return (*it);
                 }
@@ -170,9 +230,48 @@ namespace ChilliSource
                     return entity;
                 }
             }
-			
-			return EntityNullPtr;
-		}
+            
+            return EntityNullPtr;
+        }
+        //------------------------------------------------------------------
+        //------------------------------------------------------------------
+        bool Entity::FindInNameIndex(const InternedString& in_name, bool in_recursive, const Entity*& out_entity) const
+        {
+            if (m_scene == nullptr || m_scene->IsNameIndexEnabled() == false || in_name.IsEmpty() == true)
+            {
+                return false;
+            }
+            
+            //siblings can share a name, in which case a search would find the earliest child.
+            out_entity = nullptr;
+            auto range = m_scene->m_nameIndex.equal_range(Scene::NameIndexKey(this, in_name));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (out_entity == nullptr || it->second->m_childIndex < out_entity->m_childIndex)
+                {
+                    out_entity = it->second;
+                }
+            }
+            
+            //a search is depth first, so descendants of any earlier children take precedence over a matching child.
+            if (in_recursive == true)
+            {
+                const u32 numPrecedingChildren = (out_entity != nullptr) ? out_entity->m_childIndex : static_cast<u32>(m_children.size());
+                for (u32 i = 0; i < numPrecedingChildren; ++i)
+                {
+                    const Entity* descendant = nullptr;
+                    m_children[i]->FindInNameIndex(in_name, true, descendant);
+                    
+                    if (descendant != nullptr)
+                    {
+                        out_entity = descendant;
+                        break;
+                    }
+                }
+            }
+            
+            return true;
+        }
         //------------------------------------------------------------------
         //------------------------------------------------------------------
         u32 Entity::GetNumEntities() const
@@ -195,7 +294,37 @@ namespace ChilliSource
 		//-------------------------------------------------------------
 		void Entity::SetScene(Scene* in_scene)
 		{
+            if (m_scene != nullptr)
+            {
+                for (const auto& component : m_components)
+                {
+                    m_scene->OnComponentRemoved(component.get());
+                }
+                
+                if (m_scene->m_transformHierarchy != nullptr)
+                {
+                    m_scene->m_transformHierarchy->Remove(&m_transform);
+                }
+                
+                m_scene->RemoveFromNameIndex(this);
+            }
+            
 			m_scene = in_scene;
+            
+            if (m_scene != nullptr)
+            {
+                for (const auto& component : m_components)
+                {
+                    m_scene->OnComponentAdded(component.get());
+                }
+                
+                if (m_scene->m_transformHierarchy != nullptr)
+                {
+                    m_scene->m_transformHierarchy->Add(&m_transform);
+                }
+                
+                m_scene->AddToNameIndex(this);
+            }
 		}
         //-------------------------------------------------------------
 		//-------------------------------------------------------------
@@ -207,6 +336,7 @@ namespace ChilliSource
                       + CSCore::ToString(std::numeric_limits<u32>::max()) + ".");
             
             m_components.push_back(in_component);
+            m_componentLookup.clear();
             
             in_component->SetEntity(this);
             
@@ -214,6 +344,7 @@ namespace ChilliSource
             
             if(GetScene() != nullptr)
             {
+                m_scene->OnComponentAdded(in_component.get());
                 in_component->OnAddedToScene();
                 if (m_appActive == true)
                 {
@@ -247,6 +378,7 @@ namespace ChilliSource
                             in_component->OnSuspend();
                         }
                         in_component->OnRemovedFromScene();
+                        m_scene->OnComponentRemoved(in_component);
                     }
                     
                     in_component->OnRemovedFromEntity();
@@ -254,6 +386,7 @@ namespace ChilliSource
                     
                     std::swap(m_components.back(), *it);
                     m_components.pop_back();
+                    m_componentLookup.clear();
                     return;
                 }
             }
@@ -277,6 +410,7 @@ namespace ChilliSource
                         component->OnSuspend();
                     }
                     component->OnRemovedFromScene();
+                    m_scene->OnComponentRemoved(component);
                 }
                 
                 component->OnRemovedFromEntity();
@@ -284,20 +418,34 @@ namespace ChilliSource
             }
             
             m_components.clear();
+            m_componentLookup.clear();
 		}
 		//-------------------------------------------------------------
 		//-------------------------------------------------------------
 		const ComponentSPtr& Entity::GetComponent(InterfaceIDType in_interfaceId) const
 		{
-			for(ComponentList::const_iterator itr = m_components.begin(); itr != m_components.end(); ++itr)
+            for (const auto& lookup : m_componentLookup)
+            {
+                if (lookup.first == in_interfaceId)
+                {
+                    return (lookup.second != k_noComponent) ? m_components[lookup.second] : ComponentNullPtr;
+                }
+            }
+            
+            //resolve the query once and remember the result until the component list changes.
+            u32 componentIndex = k_noComponent;
+			for (u32 i = 0; i < m_components.size(); ++i)
 			{
-                if((*itr)->IsA(in_interfaceId))
+                if (m_components[i]->IsA(in_interfaceId))
                 {
-                    return *itr;
+                    componentIndex = i;
+                    break;
                 }
 			}
+            
+            m_componentLookup.push_back(std::make_pair(in_interfaceId, componentIndex));
 			
-			return ComponentNullPtr;
+			return (componentIndex != k_noComponent) ? m_components[componentIndex] : ComponentNullPtr;
 		}
 		//-------------------------------------------------------------
 		//-------------------------------------------------------------
@@ -345,14 +493,36 @@ namespace ChilliSource
 		//-------------------------------------------------------------
 		void Entity::SetName(const std::string& in_name)
 		{
-			m_name = in_name;
+			SetName(InternedString(in_name));
 		}
+        //-------------------------------------------------------------
+        //-------------------------------------------------------------
+        void Entity::SetName(const InternedString& in_name)
+        {
+            if (m_scene != nullptr)
+            {
+                m_scene->RemoveFromNameIndex(this);
+            }
+            
+            m_name = in_name;
+            
+            if (m_scene != nullptr)
+            {
+                m_scene->AddToNameIndex(this);
+            }
+        }
 		//-------------------------------------------------------------
 		//-------------------------------------------------------------
 		const std::string & Entity::GetName() const
 		{
-			return m_name;
+			return m_name.GetString();
 		}
+        //-------------------------------------------------------------
+        //-------------------------------------------------------------
+        const InternedString& Entity::GetInternedName() const
+        {
+            return m_name;
+        }
         //-------------------------------------------------------------
 		//-------------------------------------------------------------
 		Scene* Entity::GetScene()
@@ -371,15 +541,6 @@ namespace ChilliSource
         {
             return m_transform;
         }
-        //----------------------------------------------------
-        //----------------------------------------------------
-        void Entity::OnUpdate(f32 in_timeSinceLastUpdate)
-        {
-            for(u32 i=0; i<m_components.size(); ++i)
-			{
-                m_components[i]->OnUpdate(in_timeSinceLastUpdate);
-			}
-        }
         //-------------------------------------------------------------
 		//-------------------------------------------------------------
 		void Entity::OnAddedToScene()
@@ -432,15 +593,6 @@ namespace ChilliSource
                 (*it)->OnRemovedFromScene();
             }
 		}
-        //----------------------------------------------------
-        //----------------------------------------------------
-        void Entity::OnFixedUpdate(f32 in_fixedTimeSinceLastUpdate)
-        {
-            for(u32 i=0; i<m_components.size(); ++i)
-			{
-                m_components[i]->OnFixedUpdate(in_fixedTimeSinceLastUpdate);
-			}
-        }
         //-------------------------------------------------------------
         //-------------------------------------------------------------
         void Entity::OnBackground()
@@ -473,9 +625,13 @@ namespace ChilliSource
         {
             RemoveAllComponents();
             RemoveAllChildren();
-            RemoveFromParent();
             
-            m_name = std::string();
+            if (m_parent != nullptr || m_scene != nullptr)
+            {
+                RemoveFromParent();
+            }
+            
+            SetName(InternedString());
             m_transform.Reset();
         }
 		//-------------------------------------------------------------
@@ -32,6 +32,7 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Entity/Component.h>
 #include <ChilliSource/Core/Entity/Transform.h>
+#include <ChilliSource/Core/String/InternedString.h>
 
 #ifdef CS_ENABLE_ENTITYLINKEDLIST
 #include <list>
@@ -68,6 +69,18 @@ namespace ChilliSource
             /// @return Entity
             //------------------------------------------------------------------
             static EntityUPtr Create();
+            //------------------------------------------------------------------
+            /// Factory method to create an empty entity where the entity and
+            /// its reference count are allocated from pools rather than the
+            /// heap. Prefer this for entities which are frequently created
+            /// and destroyed. Scene::CreateEntity() will also reuse recycled
+            /// entities.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return Entity
+            //------------------------------------------------------------------
+            static EntitySPtr CreatePooled();
             
             //----------------------------------------------------------------
             /// Destructor
@@ -265,6 +278,16 @@ namespace ChilliSource
 			/// @param Entity
 			//-------------------------------------------------------------
 			void AddEntity(const EntitySPtr& in_child);
+            //-------------------------------------------------------------
+            /// Reserves space for the given number of components and
+            /// children so they can be added without reallocating.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The number of components.
+            /// @param The number of child entities.
+            //-------------------------------------------------------------
+            void Reserve(u32 in_numComponents, u32 in_numChildren);
 			//-------------------------------------------------------------
 			/// Remove an entity as a child. This will unlink the transforms
             /// in a hierarchy and will unlink lifecycle and scene events
@@ -291,12 +314,24 @@ namespace ChilliSource
 			/// @param Name
 			//-------------------------------------------------------------
 			void SetName(const std::string& in_name);
+            //-------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The interned name.
+            //-------------------------------------------------------------
+            void SetName(const InternedString& in_name);
 			//-------------------------------------------------------------
 			/// @author S Downie
 			///
 			/// @return Entity name
 			//-------------------------------------------------------------
 			const std::string & GetName() const;
+            //-------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The interned entity name.
+            //-------------------------------------------------------------
+            const InternedString& GetInternedName() const;
 			//------------------------------------------------------------------
 			/// Return the parent entity of this entity. nullptr is returned if
 			/// there is no parent.
@@ -323,6 +358,19 @@ namespace ChilliSource
 			/// @return An entity with the specified name or null
 			//------------------------------------------------------------------
             const EntitySPtr& GetEntityWithName(const std::string& in_name) const;
+            //------------------------------------------------------------------
+            /// Search only immediate children to find an entity and return a pointer
+            /// to the first entity it finds with the name matching that given,
+            /// or nullptr if no match found. If the entity is in a scene with the
+            /// name index enabled this is a hash lookup.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The interned name.
+            ///
+            /// @return An entity with the specified name or null
+            //------------------------------------------------------------------
+            const EntitySPtr& GetEntityWithName(const InternedString& in_name) const;
 			//------------------------------------------------------------------
 			/// Recursively search the entity hierarchy in a depth-first manner
 			/// and return a pointer to the first entity it finds with the name matching
@@ -334,6 +382,19 @@ namespace ChilliSource
 			//------------------------------------------------------------------
 			const EntitySPtr& GetEntityWithNameRecursive(const std::string& in_name) const;
             //------------------------------------------------------------------
+            /// Recursively search the entity hierarchy in a depth-first manner
+            /// and return a pointer to the first entity it finds with the name
+            /// matching given, or nullptr if no match found. If the entity is in a
+            /// scene with the name index enabled this is a hash lookup.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The interned name.
+            ///
+            /// @return An entity with the specified name or null
+            //------------------------------------------------------------------
+            const EntitySPtr& GetEntityWithNameRecursive(const InternedString& in_name) const;
+            //------------------------------------------------------------------
             /// @author A Mackie
 			///
 			/// @return the number of child entities
@@ -369,6 +430,10 @@ namespace ChilliSource
             //-------------------------------------------------------------
 			Entity() = default;
             //-------------------------------------------------------------
+            /// The result of each query is remembered until the component
+            /// list next changes, so repeated queries for the same type
+            /// don't need to query each component.
+            ///
 			/// @author S Downie
 			///
             /// @param Component type to find
@@ -396,6 +461,27 @@ namespace ChilliSource
             /// into child entities
 			//-------------------------------------------------------------
 			const ComponentSPtr& GetComponentRecursive(InterfaceIDType in_interfaceId) const;
+            //-------------------------------------------------------------
+            /// Looks up the entity with the given name among the
+            /// children or descendants of this using the scene name
+            /// index. This returns the same entity as a search of
+            /// the hierarchy would. Children are looked up directly,
+            /// while a recursive lookup only descends into the
+            /// children which precede the first matching child.
+            /// This fails if the entity isn't in a scene with the
+            /// name index enabled.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The name to look up. Must not be empty.
+            /// @param Whether to consider all descendants rather than
+            /// only immediate children.
+            /// @param [Out] The matching entity, or null if there is
+            /// no match.
+            ///
+            /// @return Whether the index could be used.
+            //-------------------------------------------------------------
+            bool FindInNameIndex(const InternedString& in_name, bool in_recursive, const Entity*& out_entity) const;
             //-------------------------------------------------------------
 			/// @author S Downie
 			///
@@ -425,20 +511,6 @@ namespace ChilliSource
             /// @author Ian Copland
 			//-------------------------------------------------------------
 			void OnForeground();
-            //-------------------------------------------------------------
-            /// @author S Downie
-            ///
-            /// @param Time since last update in seconds
-            //-------------------------------------------------------------
-            void OnUpdate(f32 in_timeSinceLastUpdate);
-            //-------------------------------------------------------------
-            /// Fixed update is triggered at fixed time periods
-            ///
-            /// @author S Downie
-            ///
-            /// @param Time since last fixed update in seconds
-            //-------------------------------------------------------------
-            void OnFixedUpdate(f32 in_fixedTimeSinceLastUpdate);
             //-------------------------------------------------------------
 			/// Called when the application is backgrounded while the entity
             /// is in the scene. This will also be called when the entity is
@@ -466,13 +538,15 @@ namespace ChilliSource
 		private:
 			
 			ComponentList m_components;
+            mutable std::vector<std::pair<InterfaceIDType, u32>> m_componentLookup;
 			SharedEntityList m_children;
             
             Transform m_transform;
 			
-			std::string m_name;
+			InternedString m_name;
 			
 			Entity* m_parent = nullptr;
+            u32 m_childIndex = 0;
 			Scene* m_scene = nullptr;
             
             bool m_appActive = false;
@@ -0,0 +1,148 @@
+//
+//  Prefab.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Entity/Prefab.h>
+
+#include <ChilliSource/Core/Container/PoolAllocator.h>
+#include <ChilliSource/Core/Entity/Entity.h>
+
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        const u32 Prefab::k_noParent = std::numeric_limits<u32>::max();
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PrefabUPtr Prefab::Create()
+        {
+            return PrefabUPtr(new Prefab());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 Prefab::AddEntity(const std::string& in_name, u32 in_parentIndex)
+        {
+            CS_ASSERT(m_entities.empty() == (in_parentIndex == k_noParent), "Only the first entity in a prefab can have no parent.");
+            CS_ASSERT(in_parentIndex == k_noParent || in_parentIndex < m_entities.size(), "Parent entity must already be in the prefab.");
+            
+            EntityDesc desc;
+            desc.m_name = InternedString(in_name);
+            desc.m_parentIndex = in_parentIndex;
+            desc.m_scale = Vector3::k_one;
+            desc.m_orientation = Quaternion::k_identity;
+            m_entities.push_back(std::move(desc));
+            
+            if (in_parentIndex != k_noParent)
+            {
+                m_entities[in_parentIndex].m_numChildren++;
+            }
+            
+            return static_cast<u32>(m_entities.size() - 1);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void Prefab::SetTransform(u32 in_entityIndex, const Vector3& in_position, const Vector3& in_scale, const Quaternion& in_orientation)
+        {
+            CS_ASSERT(in_entityIndex < m_entities.size(), "Entity index out of bounds.");
+            
+            EntityDesc& desc = m_entities[in_entityIndex];
+            desc.m_hasTransform = true;
+            desc.m_position = in_position;
+            desc.m_scale = in_scale;
+            desc.m_orientation = in_orientation;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void Prefab::AddComponent(u32 in_entityIndex, const ComponentCreatorDelegate& in_componentCreator)
+        {
+            CS_ASSERT(in_entityIndex < m_entities.size(), "Entity index out of bounds.");
+            CS_ASSERT(in_componentCreator != nullptr, "Cannot add a null component creator.");
+            
+            m_entities[in_entityIndex].m_componentCreators.push_back(in_componentCreator);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 Prefab::GetNumEntities() const
+        {
+            return static_cast<u32>(m_entities.size());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        EntitySPtr Prefab::Instantiate() const
+        {
+            std::vector<EntitySPtr> entities;
+            Instantiate(1, entities);
+            return entities.front();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void Prefab::Instantiate(u32 in_count, std::vector<EntitySPtr>& out_entities) const
+        {
+            CS_ASSERT(m_entities.empty() == false, "Cannot instantiate an empty prefab.");
+            
+            PoolAllocator<Entity>::Reserve(in_count * static_cast<u32>(m_entities.size()));
+            out_entities.reserve(out_entities.size() + in_count);
+            
+            std::vector<Entity*> instance(m_entities.size());
+            for (u32 i = 0; i < in_count; ++i)
+            {
+                for (u32 j = 0; j < m_entities.size(); ++j)
+                {
+                    const EntityDesc& desc = m_entities[j];
+                    
+                    EntitySPtr entity = Entity::CreatePooled();
+                    entity->SetName(desc.m_name);
+                    entity->Reserve(static_cast<u32>(desc.m_componentCreators.size()), desc.m_numChildren);
+                    
+                    if (desc.m_hasTransform == true)
+                    {
+                        entity->GetTransform().SetPositionScaleOrientation(desc.m_position, desc.m_scale, desc.m_orientation);
+                    }
+                    
+                    for (const auto& componentCreator : desc.m_componentCreators)
+                    {
+                        entity->AddComponent(componentCreator());
+                    }
+                    
+                    instance[j] = entity.get();
+                    
+                    if (desc.m_parentIndex == k_noParent)
+                    {
+                        out_entities.push_back(std::move(entity));
+                    }
+                    else
+                    {
+                        instance[desc.m_parentIndex]->AddEntity(entity);
+                    }
+                }
+            }
+        }
+    }
+}
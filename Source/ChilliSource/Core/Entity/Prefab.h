@@ -0,0 +1,165 @@
+//
+//  Prefab.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_ENTITY_PREFAB_H_
+#define _CHILLISOURCE_CORE_ENTITY_PREFAB_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/String/InternedString.h>
+
+#include <functional>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// A template describing an entity hierarchy, which can be used to create
+        /// many copies of the hierarchy in one go. Each entity in the template has a
+        /// name, a local transform and a list of delegates which create its components.
+        ///
+        /// Instantiated entities are allocated from the entity pool and all storage
+        /// for their components and children is reserved up front. The resulting
+        /// root entities can then be added to a scene in a single batch using
+        /// Scene::Add().
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class Prefab final
+        {
+        public:
+            CS_DECLARE_NOCOPY(Prefab);
+            //------------------------------------------------------------------------------
+            /// A delegate which creates a new instance of a component.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The new component.
+            //------------------------------------------------------------------------------
+            typedef std::function<ComponentSPtr()> ComponentCreatorDelegate;
+            
+            static const u32 k_noParent;
+            //------------------------------------------------------------------------------
+            /// Factory method for creating a new empty prefab.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The new prefab.
+            //------------------------------------------------------------------------------
+            static PrefabUPtr Create();
+            //------------------------------------------------------------------------------
+            /// Adds an entity to the template. The first entity added is the root of the
+            /// hierarchy and cannot have a parent; all subsequent entities must have a
+            /// parent which has already been added.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The name of the entity.
+            /// @param The index of the parent entity, or k_noParent for the root.
+            ///
+            /// @return The index of the new entity.
+            //------------------------------------------------------------------------------
+            u32 AddEntity(const std::string& in_name, u32 in_parentIndex = k_noParent);
+            //------------------------------------------------------------------------------
+            /// Sets the local transform of the given entity in the template.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The index of the entity.
+            /// @param The local position.
+            /// @param The local scale.
+            /// @param The local orientation.
+            //------------------------------------------------------------------------------
+            void SetTransform(u32 in_entityIndex, const Vector3& in_position, const Vector3& in_scale, const Quaternion& in_orientation);
+            //------------------------------------------------------------------------------
+            /// Adds a component to the given entity in the template. The delegate is
+            /// called once for each instance of the entity.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The index of the entity.
+            /// @param The delegate which creates the component.
+            //------------------------------------------------------------------------------
+            void AddComponent(u32 in_entityIndex, const ComponentCreatorDelegate& in_componentCreator);
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The number of entities in the template.
+            //------------------------------------------------------------------------------
+            u32 GetNumEntities() const;
+            //------------------------------------------------------------------------------
+            /// Creates a single instance of the template.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The root entity of the new instance.
+            //------------------------------------------------------------------------------
+            EntitySPtr Instantiate() const;
+            //------------------------------------------------------------------------------
+            /// Creates a number of instances of the template.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The number of instances.
+            /// @param [Out] The list the root entity of each instance is appended to.
+            //------------------------------------------------------------------------------
+            void Instantiate(u32 in_count, std::vector<EntitySPtr>& out_entities) const;
+            
+        private:
+            //------------------------------------------------------------------------------
+            /// Describes a single entity in the template.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            struct EntityDesc
+            {
+                InternedString m_name;
+                u32 m_parentIndex = k_noParent;
+                u32 m_numChildren = 0;
+                bool m_hasTransform = false;
+                Vector3 m_position;
+                Vector3 m_scale;
+                Quaternion m_orientation;
+                std::vector<ComponentCreatorDelegate> m_componentCreators;
+            };
+            //------------------------------------------------------------------------------
+            /// Private to enforce use of the factory method.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            Prefab() = default;
+            
+            std::vector<EntityDesc> m_entities;
+        };
+    }
+}
+
+#endif
@@ -28,18 +28,145 @@
 
 #include <ChilliSource/Core/Entity/Transform.h>
 
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Entity/TransformHierarchy.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
 #include <algorithm>
+#include <limits>
 
 namespace ChilliSource
 {
     namespace Core
     {
+        namespace
+        {
+            const u32 k_notInChangedList = std::numeric_limits<u32>::max();
+            
+            //These are shared by every transform and are unsynchronised, so must only be
+            //accessed on the main thread.
+            std::vector<Transform*> g_changedTransforms;
+            std::vector<Transform*> g_processingTransforms;
+            std::vector<Transform*> g_flattenedTransforms;
+            u32 g_transformUpdateCount = 0;
+            bool g_isNotifyingTransforms = false;
+            
+            //Changes made on the current thread are deferred to this list, or null if they aren't deferred.
+            //Visual C++ and iOS don't support thread_local, so the compiler specific versions are used instead.
+#if defined (CS_TARGETPLATFORM_WINDOWS)
+            __declspec(thread) std::vector<Transform*>* g_deferredChanges = nullptr;
+#else
+            __thread std::vector<Transform*>* g_deferredChanges = nullptr;
+#endif
+        }
+        
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::UpdateChangedTransforms()
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Changed transforms can only be updated on the main thread.");
+            CS_ASSERT(g_isNotifyingTransforms == false, "Cannot update changed transforms while transforms are already being updated.");
+            
+            if (g_changedTransforms.empty() == true)
+            {
+                return;
+            }
+            
+            //zero is reserved for transforms which have never been notified.
+            if (++g_transformUpdateCount == 0)
+            {
+                ++g_transformUpdateCount;
+            }
+            
+            //anything changed during the notifications below will be processed next time.
+            g_processingTransforms.swap(g_changedTransforms);
+            for (Transform* transform : g_processingTransforms)
+            {
+                transform->m_changedListIndex = k_notInChangedList;
+            }
+            
+            //flatten each changed hierarchy breadth-first, updating world transforms as we go. If a changed
+            //transform is a descendant of one processed earlier it has already been visited and is skipped.
+            for (Transform* changedTransform : g_processingTransforms)
+            {
+                if (changedTransform->m_lastNotifiedUpdate == g_transformUpdateCount)
+                {
+                    continue;
+                }
+                
+                changedTransform->GetWorldTransform();
+                changedTransform->m_lastNotifiedUpdate = g_transformUpdateCount;
+                
+                std::size_t index = g_flattenedTransforms.size();
+                g_flattenedTransforms.push_back(changedTransform);
+                
+                for (; index < g_flattenedTransforms.size(); ++index)
+                {
+                    const Transform* parent = g_flattenedTransforms[index];
+                    for (Transform* child : parent->mChildTransforms)
+                    {
+                        if (child->m_lastNotifiedUpdate != g_transformUpdateCount)
+                        {
+                            child->m_lastNotifiedUpdate = g_transformUpdateCount;
+                            child->UpdateWorldTransform(parent->GetWorldTransformData());
+                            g_flattenedTransforms.push_back(child);
+                        }
+                    }
+                }
+            }
+            g_processingTransforms.clear();
+            
+            //notify once all world transforms are up to date. Listeners can destroy transforms, in which
+            //case the destructor will remove the transform from the flattened list.
+            g_isNotifyingTransforms = true;
+            for (std::size_t i = 0; i < g_flattenedTransforms.size(); ++i)
+            {
+                if (g_flattenedTransforms[i] != nullptr)
+                {
+                    g_flattenedTransforms[i]->mTransformChangedEvent.NotifyConnections();
+                }
+            }
+            g_isNotifyingTransforms = false;
+            
+            g_flattenedTransforms.clear();
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::BeginDeferringChanges(std::vector<Transform*>& out_changedTransforms)
+        {
+            CS_ASSERT(g_deferredChanges == nullptr, "Transform changes are already deferred on this thread.");
+            
+            g_deferredChanges = &out_changedTransforms;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::EndDeferringChanges()
+        {
+            CS_ASSERT(g_deferredChanges != nullptr, "Transform changes are not deferred on this thread.");
+            
+            g_deferredChanges = nullptr;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::CommitDeferredChanges(const std::vector<Transform*>& in_transforms)
+        {
+            CS_ASSERT(g_deferredChanges == nullptr, "Cannot commit deferred transform changes while changes are still deferred.");
+            
+            for (Transform* transform : in_transforms)
+            {
+                if (transform->m_hasDeferredChange == true)
+                {
+                    transform->m_hasDeferredChange = false;
+                    transform->AddToChangedList();
+                }
+            }
+        }
         //----------------------------------------------------------------
 		/// Constructor
         ///
         /// Default
 		//----------------------------------------------------------------
-        Transform::Transform() : mbIsTransformCacheValid(false), mbIsParentTransformCacheValid(false), mvScale(1,1,1), mpParentTransform(nullptr)
+        Transform::Transform() : mbIsTransformCacheValid(false), mbIsWorldTransformCacheValid(false), mvScale(1,1,1), mpParentTransform(nullptr), m_changedListIndex(k_notInChangedList)
         {
         
         }
@@ -67,7 +194,7 @@ namespace ChilliSource
             Core::Quaternion cRot(vRight, vUp, vForward);
             cRot.Normalise();
             
-            SetPositionScaleOrientation(invPos, mvScale, cRot);
+            SetPositionScaleOrientation(invPos, GetScaleData(), cRot);
 		}
         //----------------------------------------------------------------
         /// Set Position Scale Orientation
@@ -78,9 +205,9 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void Transform::SetPositionScaleOrientation(const Vector3& invPos, const Vector3& invScale, const Quaternion& invOrientation)
         {
-            mvPosition = invPos;
-            mvScale = invScale;
-            mqOrientation = invOrientation;
+            GetPositionData() = invPos;
+            GetScaleData() = invScale;
+            GetOrientationData() = invOrientation;
             
             OnTransformChanged();
         }
@@ -93,12 +220,14 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::SetPosition(f32 infX, f32 infY, f32 infZ)
 		{
-            if(mvPosition.x == infX && mvPosition.y == infY && mvPosition.z == infZ)
+			Vector3& position = GetPositionData();
+			
+            if(position.x == infX && position.y == infY && position.z == infZ)
                 return;
             
-			mvPosition.x = infX;
-			mvPosition.y = infY;
-			mvPosition.z = infZ;
+			position.x = infX;
+			position.y = infY;
+			position.z = infZ;
             
 			OnTransformChanged();
 		}
@@ -109,10 +238,10 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::SetPosition(const Vector3 &invPos)
 		{
-            if(mvPosition == invPos)
+            if(GetPositionData() == invPos)
                 return;
             
-			mvPosition = invPos;
+			GetPositionData() = invPos;
             
 			OnTransformChanged();
 		}
@@ -121,72 +250,66 @@ namespace ChilliSource
 		///
 		/// @return The position of the object 
 		//----------------------------------------------------------------
-		const Vector3& Transform::GetLocalPosition() const
+		Vector3 Transform::GetLocalPosition() const
 		{
-			return mvPosition;
+			return GetPositionData();
 		}
 		//----------------------------------------------------------------
 		/// Get Local Scale
 		///
 		/// @return The scale of object
 		//----------------------------------------------------------------
-		const Vector3& Transform::GetLocalScale() const
+		Vector3 Transform::GetLocalScale() const
 		{
-            return mvScale;
+            return GetScaleData();
 		}
         //----------------------------------------------------------------
 		/// Get World Position
 		///
 		/// @return The relative position of the object 
 		//----------------------------------------------------------------
-		const Vector3& Transform::GetWorldPosition() const
+		Vector3 Transform::GetWorldPosition() const
 		{
             if(mpParentTransform)
             {
-                mvWorldPosition = GetWorldTransform().GetTranslation();
-                return mvWorldPosition;
+                return GetWorldTransform().GetTranslation();
             }
             
-			return mvPosition;
+			return GetPositionData();
 		}
 		//----------------------------------------------------------------
 		/// Get World Scale
 		///
 		/// @return The relative scale of object
 		//----------------------------------------------------------------
-		const Vector3& Transform::GetWorldScale() const
+		Vector3 Transform::GetWorldScale() const
 		{
-            if(mpParentTransform)
-			{
-				mvWorldScale = mpParentTransform->GetWorldScale() * mvScale;
-                return mvWorldScale;
-			}
-			
-			return mvScale;
+            ValidateWorldTransform();
+            
+			return m_worldScale;
 		}
         //----------------------------------------------------------------
 		/// Get Local Orientation
 		///
 		/// @return Orientation quaternion
 		//----------------------------------------------------------------
-		const Quaternion& Transform::GetLocalOrientation() const
+		Quaternion Transform::GetLocalOrientation() const
 		{
-			return mqOrientation;
+			return GetOrientationData();
 		}
         //----------------------------------------------------------------
 		/// Get World Orientation
 		///
 		/// @return Orientation quaternion relative to parent
 		//----------------------------------------------------------------
-		const Quaternion& Transform::GetWorldOrientation() const
+		Quaternion Transform::GetWorldOrientation() const
 		{
             if(mpParentTransform)
             {
-                mqWorldOrientation = Core::Quaternion(GetWorldTransform());
-                return mqWorldOrientation;
+                return Core::Quaternion(GetWorldTransform());
             }
             
-            return mqOrientation;
+            return GetOrientationData();
 		}
 		//----------------------------------------------------------------
 		/// Move By
@@ -197,9 +320,11 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::MoveBy(f32 infX, f32 infY, f32 infZ)
 		{
-			mvPosition.x += infX;
-			mvPosition.y += infY;
-			mvPosition.z += infZ;
+			Vector3& position = GetPositionData();
+			
+			position.x += infX;
+			position.y += infY;
+			position.z += infZ;
 			
 			OnTransformChanged();
 		}
@@ -210,7 +335,7 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::MoveBy(const Vector3 &invPos)
 		{
-			mvPosition += invPos;
+			GetPositionData() += invPos;
 			
 			OnTransformChanged();
 		}
@@ -221,10 +346,10 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::SetOrientation(const Quaternion & inqOrientation)
 		{
-            if(mqOrientation == inqOrientation)
+            if(GetOrientationData() == inqOrientation)
                 return;
             
-			mqOrientation = inqOrientation;
+			GetOrientationData() = inqOrientation;
 			
 			OnTransformChanged();
 		}
@@ -285,7 +410,7 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::RotateBy(const Vector3 &vAxis, f32 infAngleRads)
 		{
-			mqOrientation = mqOrientation * Quaternion(vAxis,infAngleRads);
+			GetOrientationData() = GetOrientationData() * Quaternion(vAxis,infAngleRads);
 			
 			OnTransformChanged();
 		}
@@ -313,7 +438,7 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::RotateTo(const Vector3 &vAxis, f32 infAngleRads)
 		{
-			mqOrientation = Quaternion(vAxis,infAngleRads);
+			GetOrientationData() = Quaternion(vAxis,infAngleRads);
 			
 			OnTransformChanged();
 		}
@@ -326,9 +451,11 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::ScaleBy(f32 inScale)
 		{
-			mvScale.x *= inScale;
-			mvScale.y *= inScale;
-			mvScale.z *= inScale;
+			Vector3& scale = GetScaleData();
+			
+			scale.x *= inScale;
+			scale.y *= inScale;
+			scale.z *= inScale;
 						  
 			OnTransformChanged();
 		}
@@ -343,9 +470,11 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::ScaleBy(f32 inX, f32 inY, f32 inZ)
 		{
-			mvScale.x *= inX;
-			mvScale.y *= inY;
-			mvScale.z *= inZ;
+			Vector3& scale = GetScaleData();
+			
+			scale.x *= inX;
+			scale.y *= inY;
+			scale.z *= inZ;
 			
 			OnTransformChanged();
 		}
@@ -358,9 +487,11 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::ScaleBy(const Vector3 &Vec)
 		{
-			mvScale.x *= Vec.x;
-			mvScale.y *= Vec.y;
-			mvScale.z *= Vec.z;
+			Vector3& scale = GetScaleData();
+			
+			scale.x *= Vec.x;
+			scale.y *= Vec.y;
+			scale.z *= Vec.z;
 			
 			OnTransformChanged();
 		}
@@ -373,12 +504,14 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::ScaleTo(f32 inScale)
 		{
-            if(mvScale.x == inScale && mvScale.y == inScale && mvScale.z == inScale)
+			Vector3& scale = GetScaleData();
+			
+            if(scale.x == inScale && scale.y == inScale && scale.z == inScale)
                 return;
             
-			mvScale.x = inScale;
-			mvScale.y = inScale;
-			mvScale.z = inScale;
+			scale.x = inScale;
+			scale.y = inScale;
+			scale.z = inScale;
 			
 			OnTransformChanged();
 		}
@@ -393,12 +526,14 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::ScaleTo(f32 inX, f32 inY, f32 inZ)
 		{
-            if(mvScale.x == inX && mvScale.y == inY && mvScale.z == inZ)
+			Vector3& scale = GetScaleData();
+			
+            if(scale.x == inX && scale.y == inY && scale.z == inZ)
                 return;
             
-			mvScale.x = inX;
-			mvScale.y = inY;
-			mvScale.z = inZ;
+			scale.x = inX;
+			scale.y = inY;
+			scale.z = inZ;
 			
 			OnTransformChanged();
 		}
@@ -411,10 +546,10 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		void Transform::ScaleTo(const Vector3 &Vec)
 		{
-            if(mvScale == Vec)
+            if(GetScaleData() == Vec)
                 return;
             
-			mvScale = Vec;
+			GetScaleData() = Vec;
 			
 			OnTransformChanged();
 		}
@@ -423,50 +558,27 @@ namespace ChilliSource
         ///
         /// @return The currently cached transform (rebuilds if invalid)
         //----------------------------------------------------------------
-        const Matrix4& Transform::GetLocalTransform() const
+        Matrix4 Transform::GetLocalTransform() const
         {
             //Check if the transform needs to be re-calculated
             if(!mbIsTransformCacheValid)
             {
                 mbIsTransformCacheValid = true;
-                mmatTransform = Matrix4::CreateTransform(mvPosition, mvScale, mqOrientation);
+                GetLocalTransformData() = Matrix4::CreateTransform(GetPositionData(), GetScaleData(), GetOrientationData());
             }
             
-            return mmatTransform;
+            return GetLocalTransformData();
         }
         //----------------------------------------------------------------
         /// Get World Transform
         ///
         /// @return The tranform in relation to its parent transform
         //----------------------------------------------------------------
-        const Matrix4& Transform::GetWorldTransform() const
+        Matrix4 Transform::GetWorldTransform() const
         {
-            //If we have a parent transform we must apply it to
-            //our local transform to get the relative transformation
-            if(mpParentTransform)
-            {
-                //Our parent has changed so we must re-calculate our transform
-                if(!mbIsParentTransformCacheValid)
-                {
-                    mbIsParentTransformCacheValid = true;
-					
-                    //Calculate the relative transform with our new parent transform
-					mmatWorldTransform = GetLocalTransform() * mpParentTransform->GetWorldTransform();
-                }
-                //Our local transform has changed therefore we must update
-                else if(!mbIsTransformCacheValid)
-                {
-                    //Calculate the relative transformation from our cached parent
-					mmatWorldTransform = GetLocalTransform() * mpParentTransform->GetWorldTransform();
-                }
-            }
-            //We do not have a parent so our relative transform is actually just our local one
-            else if(!mbIsTransformCacheValid)
-            {
-                mmatWorldTransform = GetLocalTransform();
-            }
+            ValidateWorldTransform();
             
-			return mmatWorldTransform;
+			return GetWorldTransformData();
         }
         //----------------------------------------------------------------
         /// Set World Transform
@@ -480,19 +592,18 @@ namespace ChilliSource
             //Change the local transform to match the given world matrix
             if (mpParentTransform)
             {
-                mmatTransform = inmatTransform * CSCore::Matrix4::Inverse(mpParentTransform->GetWorldTransform());
+                GetLocalTransformData() = inmatTransform * CSCore::Matrix4::Inverse(mpParentTransform->GetWorldTransform());
             }
             else
             {
-                mmatTransform = inmatTransform;
+                GetLocalTransformData() = inmatTransform;
             }
 
-            mmatTransform.Decompose(mvPosition, mvScale, mqOrientation);
+            GetLocalTransformData().Decompose(GetPositionData(), GetScaleData(), GetOrientationData());
 
             OnTransformChanged();
 
             mbIsTransformCacheValid = true;
-            mbIsParentTransformCacheValid = false;
         }
         //----------------------------------------------------------------
         /// Set Local Transform
@@ -503,9 +614,9 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void Transform::SetLocalTransform(const Matrix4& inmatTransform)
         {
-            inmatTransform.Decompose(mvPosition, mvScale, mqOrientation);
+            inmatTransform.Decompose(GetPositionData(), GetScaleData(), GetOrientationData());
             
-            mmatTransform = inmatTransform;
+            GetLocalTransformData() = inmatTransform;
             
             OnTransformChanged();
             
@@ -518,7 +629,8 @@ namespace ChilliSource
         //----------------------------------------------------------------
         bool Transform::IsTransformValid() const
         {
-            return mbIsTransformCacheValid && mbIsParentTransformCacheValid;
+            //changes are always propagated to descendants, so ancestors don't need to be checked.
+            return mbIsTransformCacheValid && mbIsWorldTransformCacheValid;
         }
         //----------------------------------------------------------------
         /// Set Parent Transform
@@ -530,8 +642,15 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void Transform::SetParentTransform(Transform* inpTransform)
         {
+            CS_ASSERT(g_deferredChanges == nullptr, "Cannot change the parent of a transform while changes are deferred.");
+            
             mpParentTransform = inpTransform;
             
+            if (m_hierarchy != nullptr)
+            {
+                m_hierarchy->OnHierarchyChanged();
+            }
+            
             OnParentTransformChanged();
         }
 		//----------------------------------------------------------------
@@ -555,6 +674,12 @@ namespace ChilliSource
 			inpTransform->SetParentTransform(this);
 			mChildTransforms.push_back(inpTransform);
 		}
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::ReserveChildTransforms(u32 in_numChildren)
+        {
+            mChildTransforms.reserve(in_numChildren);
+        }
 		//----------------------------------------------------------------
 		/// Remove Child Transform
 		///
@@ -607,44 +732,226 @@ namespace ChilliSource
         //----------------------------------------------------------------
         /// On Transform Changed 
         ///
-        /// Triggered when our transform changes so we can 
-        /// notify any dependant transforms
+        /// Triggered when our transform changes. This flags the cached 
+        /// world transforms of this and its descendants as invalid and
+        /// queues the transform changed notification.
         //----------------------------------------------------------------
         void Transform::OnTransformChanged()
         {
             mbIsTransformCacheValid = false;
+            InvalidateWorldTransform();
             
-            for(std::vector<Transform*>::iterator it = mChildTransforms.begin(); it != mChildTransforms.end(); ++it)
+            if (g_deferredChanges != nullptr)
+            {
+                if (m_hasDeferredChange == false)
+                {
+                    m_hasDeferredChange = true;
+                    g_deferredChanges->push_back(this);
+                }
+            }
+            else
             {
-                (*it)->OnParentTransformChanged();
+                AddToChangedList();
             }
-            
-            mTransformChangedEvent.NotifyConnections();
         }
         //----------------------------------------------------------------
         /// On Parent Transform Changed 
         ///
-        /// Triggered when our parent transform changes so we can 
+        /// Triggered when our parent transform is replaced so we can 
         /// recalculate our transform
         //----------------------------------------------------------------
         void Transform::OnParentTransformChanged()
         {
-            mbIsParentTransformCacheValid = false;
-            
             OnTransformChanged();
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
+        void Transform::AddToChangedList()
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Transforms can only be changed on the main thread unless changes are deferred.");
+            
+            if (m_changedListIndex == k_notInChangedList)
+            {
+                m_changedListIndex = static_cast<u32>(g_changedTransforms.size());
+                g_changedTransforms.push_back(this);
+            }
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        u32 Transform::GetChangeCount() const
+        {
+            //The world transform must be valid for a later change to an ancestor to
+            //reach this transform and increment the count.
+            ValidateWorldTransform();
+            return m_changeCount;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::InvalidateWorldTransform()
+        {
+            if (mbIsWorldTransformCacheValid == false)
+            {
+                return;
+            }
+            
+            mbIsWorldTransformCacheValid = false;
+            ++m_changeCount;
+            
+            for (Transform* child : mChildTransforms)
+            {
+                child->InvalidateWorldTransform();
+            }
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::ValidateWorldTransform() const
+        {
+            if (mbIsWorldTransformCacheValid == true)
+            {
+                return;
+            }
+            
+            //If we have a parent transform we must apply it to
+            //our local transform to get the relative transformation
+            if (mpParentTransform != nullptr)
+            {
+                mpParentTransform->ValidateWorldTransform();
+                UpdateWorldTransform(mpParentTransform->GetWorldTransformData());
+            }
+            //We do not have a parent so our relative transform is actually just our local one
+            else
+            {
+                GetWorldTransformData() = GetLocalTransform();
+                m_worldScale = GetScaleData();
+                mbIsWorldTransformCacheValid = true;
+            }
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::UpdateWorldTransform(const Matrix4& in_parentWorldTransform) const
+        {
+            CS_ASSERT(mpParentTransform != nullptr, "Cannot update world transform from a parent without a parent.");
+            
+            if (mbIsWorldTransformCacheValid == false)
+            {
+                GetWorldTransformData() = GetLocalTransform() * in_parentWorldTransform;
+                m_worldScale = mpParentTransform->m_worldScale * GetScaleData();
+                mbIsWorldTransformCacheValid = true;
+            }
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        Vector3& Transform::GetPositionData()
+        {
+            return (m_hierarchy != nullptr) ? m_hierarchy->m_positions[m_hierarchyIndex] : mvPosition;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        const Vector3& Transform::GetPositionData() const
+        {
+            return (m_hierarchy != nullptr) ? m_hierarchy->m_positions[m_hierarchyIndex] : mvPosition;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        Vector3& Transform::GetScaleData()
+        {
+            return (m_hierarchy != nullptr) ? m_hierarchy->m_scales[m_hierarchyIndex] : mvScale;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        const Vector3& Transform::GetScaleData() const
+        {
+            return (m_hierarchy != nullptr) ? m_hierarchy->m_scales[m_hierarchyIndex] : mvScale;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        Quaternion& Transform::GetOrientationData()
+        {
+            return (m_hierarchy != nullptr) ? m_hierarchy->m_orientations[m_hierarchyIndex] : mqOrientation;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        const Quaternion& Transform::GetOrientationData() const
+        {
+            return (m_hierarchy != nullptr) ? m_hierarchy->m_orientations[m_hierarchyIndex] : mqOrientation;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        Matrix4& Transform::GetLocalTransformData() const
+        {
+            return (m_hierarchy != nullptr) ? m_hierarchy->m_localTransforms[m_hierarchyIndex] : mmatTransform;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        Matrix4& Transform::GetWorldTransformData() const
+        {
+            return (m_hierarchy != nullptr) ? m_hierarchy->m_worldTransforms[m_hierarchyIndex] : mmatWorldTransform;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Transform::RemoveFromChangedList()
+        {
+            if (m_changedListIndex != k_notInChangedList)
+            {
+                CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Changed transforms can only be removed on the main thread.");
+                CS_ASSERT(m_changedListIndex < g_changedTransforms.size() && g_changedTransforms[m_changedListIndex] == this, "Changed transform list is corrupt.");
+                
+                Transform* last = g_changedTransforms.back();
+                g_changedTransforms[m_changedListIndex] = last;
+                last->m_changedListIndex = m_changedListIndex;
+                g_changedTransforms.pop_back();
+                
+                m_changedListIndex = k_notInChangedList;
+            }
+            
+            //a transform destroyed while its change is deferred must not be committed.
+            if (m_hasDeferredChange == true)
+            {
+                if (g_deferredChanges != nullptr)
+                {
+                    g_deferredChanges->erase(std::remove(g_deferredChanges->begin(), g_deferredChanges->end(), this), g_deferredChanges->end());
+                }
+                
+                m_hasDeferredChange = false;
+            }
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
         void Transform::Reset()
         {
+            RemoveFromChangedList();
+            
             mbIsTransformCacheValid = false;
-            mbIsParentTransformCacheValid = false;
-            mvPosition = Vector3::k_zero;
-            mvScale = Vector3::k_one;
-            mqWorldOrientation = Quaternion::k_identity;
+            mbIsWorldTransformCacheValid = false;
+            ++m_changeCount;
+            GetPositionData() = Vector3::k_zero;
+            GetScaleData() = Vector3::k_one;
+            GetOrientationData() = Quaternion::k_identity;
             mpParentTransform = nullptr;
             mChildTransforms.clear();
             mTransformChangedEvent.CloseAllConnections();
+            
+            if (m_hierarchy != nullptr)
+            {
+                m_hierarchy->OnHierarchyChanged();
+            }
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        Transform::~Transform()
+        {
+            RemoveFromChangedList();
+            
+            if (m_hierarchy != nullptr)
+            {
+                m_hierarchy->Remove(this);
+            }
+            
+            //if this is destroyed by a listener during notification it must not be notified.
+            if (g_isNotifyingTransforms == true && m_lastNotifiedUpdate == g_transformUpdateCount)
+            {
+                std::replace(g_flattenedTransforms.begin(), g_flattenedTransforms.end(), this, static_cast<Transform*>(nullptr));
+            }
         }
     }
 }
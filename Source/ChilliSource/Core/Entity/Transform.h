@@ -36,16 +36,96 @@
 #include <ChilliSource/Core/Math/Quaternion.h>
 
 #include <functional>
+#include <vector>
 
 namespace ChilliSource
 {
     namespace Core
     {
+        //----------------------------------------------------------------
+        /// Describes the position, scale and orientation of an object
+        /// relative to its parent transform.
+        ///
+        /// Changing a transform flags its cached world transform, and those
+        /// of its descendants, as invalid. World transforms are lazily
+        /// recalculated when they are next queried, so they are always
+        /// correct, while querying a transform which hasn't changed only
+        /// returns the cached value. Transform changed events are deferred until
+        /// UpdateChangedTransforms() is called, which the Application does
+        /// once per frame, so each transform receives at most one
+        /// notification per frame regardless of how many times it, or any
+        /// of its ancestors, were changed.
+        ///
+        /// A transform can be attached to a TransformHierarchy, in which 
+        /// case its data is stored contiguously in the hierarchy rather 
+        /// than in the transform itself. This is transparent to users of
+        /// the transform.
+        ///
+        /// Transforms are not thread-safe and should only be used on the
+        /// main thread, other than during a scene's parallel update
+        /// phase. While changes are deferred, transforms in separate
+        /// hierarchies may be changed concurrently, as changes on each
+        /// thread are held in a list for that thread until committed on
+        /// the main thread rather than added to the shared list of
+        /// changed transforms.
+        //----------------------------------------------------------------
         class Transform
         {
         public:
+            CS_DECLARE_NOCOPY(Transform);
+            
             typedef std::function<void()> TransformChangedDelegate;
             
+            //----------------------------------------------------------------
+            /// Updates the world transform of every transform which has 
+            /// changed since the last call, along with their descendants, and
+            /// notifies their transform changed events. Each changed 
+            /// hierarchy is flattened and processed breadth-first so parents
+            /// are always updated prior to their children.
+            ///
+            /// This is called once per frame by the Application and should
+            /// only be called on the main thread.
+            ///
+            /// @author Carlos Artesano
+            //----------------------------------------------------------------
+            static void UpdateChangedTransforms();
+            //----------------------------------------------------------------
+            /// Starts deferring transform changes made on the calling
+            /// thread. While deferred, a changed transform still invalidates
+            /// its own and its descendants' world transforms, but rather
+            /// than being added to the shared list of changed transforms it
+            /// is added to the given list, which must later be passed to
+            /// CommitDeferredChanges() on the main thread. Parents cannot be
+            /// changed while changes are deferred.
+            ///
+            /// This is used by the scene during the parallel update phase.
+            /// Changes made on other threads are unaffected.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param [Out] The list which each transform changed on this
+            /// thread is added to. Must outlive the call to
+            /// EndDeferringChanges().
+            //----------------------------------------------------------------
+            static void BeginDeferringChanges(std::vector<Transform*>& out_changedTransforms);
+            //----------------------------------------------------------------
+            /// Stops deferring transform changes made on the calling thread.
+            ///
+            /// @author Carlos Artesano
+            //----------------------------------------------------------------
+            static void EndDeferringChanges();
+            //----------------------------------------------------------------
+            /// Adds each of the given transforms which has a deferred change
+            /// to the list of changed transforms. This should only be called
+            /// on the main thread once the thread which deferred them has
+            /// stopped deferring changes.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The transforms to commit.
+            //----------------------------------------------------------------
+            static void CommitDeferredChanges(const std::vector<Transform*>& in_transforms);
+            
             Transform();
             //----------------------------------------------------------
             /// Set Look At
@@ -83,13 +163,13 @@ namespace ChilliSource
 			///
 			/// @return The position of the object 
 			//----------------------------------------------------------------
-			const Vector3& GetLocalPosition() const;
+			Vector3 GetLocalPosition() const;
             //----------------------------------------------------------------
 			/// Get World Position
 			///
 			/// @return The relative position of the object 
 			//----------------------------------------------------------------
-			const Vector3& GetWorldPosition() const;
+			Vector3 GetWorldPosition() const;
 			//----------------------------------------------------------------
 			/// Move By
 			///
@@ -115,13 +195,13 @@ namespace ChilliSource
 			///
 			/// @return Orientation quaternion
 			//----------------------------------------------------------------
-			const Quaternion& GetLocalOrientation() const;
+			Quaternion GetLocalOrientation() const;
             //----------------------------------------------------------------
 			/// Get World Orientation
 			///
 			/// @return Orientation quaternion relative to parent tranform
 			//----------------------------------------------------------------
-			const Quaternion& GetWorldOrientation() const;
+			Quaternion GetWorldOrientation() const;
 			//----------------------------------------------------------------
 			/// Rotate X By
 			///
@@ -243,25 +323,25 @@ namespace ChilliSource
 			///
 			/// @return The scale of object
 			//----------------------------------------------------------------
-			const Vector3& GetLocalScale() const;
+			Vector3 GetLocalScale() const;
             //----------------------------------------------------------------
 			/// Get World Scale
 			///
 			/// @return The relative scale of object
 			//----------------------------------------------------------------
-			const Vector3& GetWorldScale() const;
+			Vector3 GetWorldScale() const;
             //----------------------------------------------------------------
 			/// Get Local Transform
 			///
 			/// @return The currently cached transform (rebuilds if invalid)
 			//----------------------------------------------------------------
-			const Matrix4& GetLocalTransform() const;
+			Matrix4 GetLocalTransform() const;
             //----------------------------------------------------------------
             /// Get World Transform
             ///
             /// @return The tranform in relation to its parent transform
             //----------------------------------------------------------------
-			const Matrix4& GetWorldTransform() const;
+			Matrix4 GetWorldTransform() const;
             //----------------------------------------------------------------
             /// Set World Transform
             ///
@@ -307,6 +387,15 @@ namespace ChilliSource
             /// @param Transform object
             //----------------------------------------------------------------
             void AddChildTransform(Transform* inpTransform);
+            //----------------------------------------------------------------
+            /// Reserves space for the given number of child transforms so
+            /// they can be added without reallocating.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The number of child transforms.
+            //----------------------------------------------------------------
+            void ReserveChildTransforms(u32 in_numChildren);
 			//----------------------------------------------------------------
             /// Remove Child Transform
             ///
@@ -333,6 +422,19 @@ namespace ChilliSource
             /// @return TransformChangedDelegate event
             //----------------------------------------------------------------
             IConnectableEvent<TransformChangedDelegate>& GetTransformChangedEvent();
+            //----------------------------------------------------------------
+            /// The change count is incremented whenever the world transform
+            /// of this transform is invalidated, either directly or through
+            /// a change to an ancestor. As the transform changed event is
+            /// deferred until the end of the frame, anything caching data
+            /// derived from the world transform should compare against this
+            /// before using the cache so it is never out of date.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The change count.
+            //----------------------------------------------------------------
+            u32 GetChangeCount() const;
             
             //----------------------------------------------------------------
             /// Resets the transform back to identity and removes any
@@ -341,37 +443,109 @@ namespace ChilliSource
             /// @author S Downie
             //----------------------------------------------------------------
             void Reset();
+            //----------------------------------------------------------------
+            /// Destructor
+            ///
+            /// @author Carlos Artesano
+            //----------------------------------------------------------------
+            ~Transform();
             
         private:
             
             //----------------------------------------------------------------
             /// On Transform Changed 
             ///
-            /// Triggered when our transform changes so we can 
-            /// notify any dependant transforms
+            /// Triggered when our transform changes. This flags the cached 
+            /// world transforms of this and its descendants as invalid and
+            /// queues the transform changed notification.
             //----------------------------------------------------------------
             void OnTransformChanged();
             //----------------------------------------------------------------
             /// On Parent Transform Changed 
             ///
-            /// Triggered when our parent transform changes so we can 
+            /// Triggered when our parent transform is replaced so we can 
             /// recalculate our transform
             //----------------------------------------------------------------
             void OnParentTransformChanged();
+            //----------------------------------------------------------------
+            /// Flags the cached world transform of this transform and all of
+            /// its descendants as invalid. A transform whose world transform
+            /// is invalid never has a descendant with a valid world transform,
+            /// so descendants which are already invalid aren't visited.
+            ///
+            /// @author Carlos Artesano
+            //----------------------------------------------------------------
+            void InvalidateWorldTransform();
+            //----------------------------------------------------------------
+            /// Recalculates the cached world transform and world scale, and
+            /// those of any ancestors, if they are out of date.
+            ///
+            /// @author Carlos Artesano
+            //----------------------------------------------------------------
+            void ValidateWorldTransform() const;
+            //----------------------------------------------------------------
+            /// Recalculates the cached world transform from the given parent
+            /// world transform, and the cached world scale from the parent's
+            /// world scale, if they are out of date.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The parent's world transform. The parent's world
+            /// transform and world scale must be up to date.
+            //----------------------------------------------------------------
+            void UpdateWorldTransform(const Matrix4& in_parentWorldTransform) const;
+            //----------------------------------------------------------------
+            /// Adds the transform to the list of transforms waiting to
+            /// notify their transform changed event if it isn't already in
+            /// it. The list is shared by all transforms and isn't
+            /// synchronised, so this must only be called on the main
+            /// thread. Changes made on other threads must be deferred and
+            /// later committed on the main thread.
+            ///
+            /// @author Carlos Artesano
+            //----------------------------------------------------------------
+            void AddToChangedList();
+            //----------------------------------------------------------------
+            /// Removes the transform from the list of transforms waiting to
+            /// notify their transform changed event, or from the calling
+            /// thread's list of deferred changes.
+            ///
+            /// @author Carlos Artesano
+            //----------------------------------------------------------------
+            void RemoveFromChangedList();
+            //----------------------------------------------------------------
+            /// The following provide access to the transform's data, which
+            /// lives in the owning transform hierarchy if it has one, or in
+            /// the transform itself otherwise. Hierarchy storage can move
+            /// when transforms are added or the hierarchy is re-ordered, so
+            /// the returned references must not be held onto; the public
+            /// accessors return by value for this reason.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The data.
+            //----------------------------------------------------------------
+            Vector3& GetPositionData();
+            const Vector3& GetPositionData() const;
+            Vector3& GetScaleData();
+            const Vector3& GetScaleData() const;
+            Quaternion& GetOrientationData();
+            const Quaternion& GetOrientationData() const;
+            Matrix4& GetLocalTransformData() const;
+            Matrix4& GetWorldTransformData() const;
             
         private:
+            friend class TransformHierarchy;
+            
             
             mutable Matrix4 mmatTransform;
             mutable Matrix4 mmatWorldTransform;
+            mutable Vector3 m_worldScale = Vector3::k_one;
             
             Vector3 mvPosition;
 			Vector3 mvScale;
 			Quaternion mqOrientation;
             
-            mutable Vector3 mvWorldPosition;
-			mutable Vector3 mvWorldScale;
-			mutable Quaternion mqWorldOrientation;
-            
             Event<TransformChangedDelegate> mTransformChangedEvent;
             
             Transform* mpParentTransform;
@@ -379,7 +553,15 @@ namespace ChilliSource
 			std::vector<Transform*> mChildTransforms;
             
             mutable bool mbIsTransformCacheValid;
-            mutable bool mbIsParentTransformCacheValid;
+            mutable bool mbIsWorldTransformCacheValid;
+            
+            u32 m_changedListIndex;
+            u32 m_lastNotifiedUpdate = 0;
+            u32 m_changeCount = 0;
+            bool m_hasDeferredChange = false;
+            
+            TransformHierarchy* m_hierarchy = nullptr;
+            u32 m_hierarchyIndex = 0;
         };
     }
 }
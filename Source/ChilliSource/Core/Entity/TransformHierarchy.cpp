@@ -0,0 +1,286 @@
+//
+//  TransformHierarchy.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Entity/TransformHierarchy.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Entity/Transform.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const u32 k_noParent = std::numeric_limits<u32>::max();
+            const u32 k_minParallelLevelSize = 1024;
+            const u32 k_parallelChunkSize = 256;
+            
+            //------------------------------------------------------------------------------
+            /// Re-orders the given array using the given order, where each element of the
+            /// order is the current index of the value which should end up at that index.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The order.
+            /// @param [In/Out] The array to re-order.
+            //------------------------------------------------------------------------------
+            template <typename TType> void Reorder(const std::vector<u32>& in_order, std::vector<TType>& inout_array)
+            {
+                std::vector<TType> reordered;
+                reordered.reserve(inout_array.size());
+                
+                for (u32 index : in_order)
+                {
+                    reordered.push_back(inout_array[index]);
+                }
+                
+                inout_array.swap(reordered);
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TransformHierarchy::Add(Transform* in_transform)
+        {
+            CS_ASSERT(in_transform != nullptr, "Cannot add a null transform.");
+            CS_ASSERT(in_transform->m_hierarchy == nullptr, "Cannot add a transform which already belongs to a hierarchy.");
+            CS_ASSERT(m_transforms.size() < static_cast<std::size_t>(k_noParent), "Too many transforms in hierarchy.");
+            
+            m_positions.push_back(in_transform->mvPosition);
+            m_scales.push_back(in_transform->mvScale);
+            m_orientations.push_back(in_transform->mqOrientation);
+            m_localTransforms.push_back(in_transform->mmatTransform);
+            m_worldTransforms.push_back(in_transform->mmatWorldTransform);
+            m_parentIndices.push_back(k_noParent);
+            m_transforms.push_back(in_transform);
+            
+            in_transform->m_hierarchy = this;
+            in_transform->m_hierarchyIndex = static_cast<u32>(m_transforms.size() - 1);
+            
+            m_isSorted = false;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TransformHierarchy::Remove(Transform* in_transform)
+        {
+            CS_ASSERT(in_transform != nullptr, "Cannot remove a null transform.");
+            CS_ASSERT(in_transform->m_hierarchy == this, "Cannot remove a transform which doesn't belong to this hierarchy.");
+            
+            const u32 index = in_transform->m_hierarchyIndex;
+            CS_ASSERT(index < m_transforms.size() && m_transforms[index] == in_transform, "Transform hierarchy is corrupt.");
+            
+            in_transform->m_hierarchy = nullptr;
+            in_transform->mvPosition = m_positions[index];
+            in_transform->mvScale = m_scales[index];
+            in_transform->mqOrientation = m_orientations[index];
+            in_transform->mmatTransform = m_localTransforms[index];
+            in_transform->mmatWorldTransform = m_worldTransforms[index];
+            
+            const u32 lastIndex = static_cast<u32>(m_transforms.size() - 1);
+            if (index != lastIndex)
+            {
+                m_positions[index] = m_positions[lastIndex];
+                m_scales[index] = m_scales[lastIndex];
+                m_orientations[index] = m_orientations[lastIndex];
+                m_localTransforms[index] = m_localTransforms[lastIndex];
+                m_worldTransforms[index] = m_worldTransforms[lastIndex];
+                m_transforms[index] = m_transforms[lastIndex];
+                m_transforms[index]->m_hierarchyIndex = index;
+            }
+            
+            m_positions.pop_back();
+            m_scales.pop_back();
+            m_orientations.pop_back();
+            m_localTransforms.pop_back();
+            m_worldTransforms.pop_back();
+            m_parentIndices.pop_back();
+            m_transforms.pop_back();
+            
+            m_isSorted = false;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TransformHierarchy::Reserve(u32 in_numTransforms)
+        {
+            m_positions.reserve(in_numTransforms);
+            m_scales.reserve(in_numTransforms);
+            m_orientations.reserve(in_numTransforms);
+            m_localTransforms.reserve(in_numTransforms);
+            m_worldTransforms.reserve(in_numTransforms);
+            m_parentIndices.reserve(in_numTransforms);
+            m_transforms.reserve(in_numTransforms);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 TransformHierarchy::GetNumTransforms() const
+        {
+            return static_cast<u32>(m_transforms.size());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TransformHierarchy::UpdateWorldTransforms()
+        {
+            if (m_isSorted == false)
+            {
+                SortByDepth();
+            }
+            
+            if (m_transforms.empty() == true)
+            {
+                return;
+            }
+            
+            //The roots of the hierarchy may have a parent outside of it, so are updated
+            //serially using the transform's own lazy evaluation.
+            for (u32 i = 0; i < m_levelOffsets[1]; ++i)
+            {
+                m_transforms[i]->GetWorldTransform();
+            }
+            
+            auto taskScheduler = Application::Get()->GetTaskScheduler();
+            std::vector<TaskScheduler::GenericTaskType> tasks;
+            
+            for (u32 level = 1; level + 1 < m_levelOffsets.size(); ++level)
+            {
+                const u32 levelStart = m_levelOffsets[level];
+                const u32 levelEnd = m_levelOffsets[level + 1];
+                
+                if (levelEnd - levelStart < k_minParallelLevelSize)
+                {
+                    UpdateWorldTransformRange(levelStart, levelEnd);
+                }
+                else
+                {
+                    tasks.clear();
+                    for (u32 chunkStart = levelStart; chunkStart < levelEnd; chunkStart += k_parallelChunkSize)
+                    {
+                        const u32 chunkEnd = std::min(chunkStart + k_parallelChunkSize, levelEnd);
+                        tasks.push_back([=]()
+                        {
+                            UpdateWorldTransformRange(chunkStart, chunkEnd);
+                        });
+                    }
+                    
+                    taskScheduler->ExecuteTasks(tasks);
+                }
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TransformHierarchy::OnHierarchyChanged()
+        {
+            m_isSorted = false;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TransformHierarchy::SortByDepth()
+        {
+            const u32 numTransforms = static_cast<u32>(m_transforms.size());
+            
+            //calculate the depth of each transform within this hierarchy. Transforms whose
+            //parent belongs to a different hierarchy, or none at all, are treated as roots.
+            std::vector<u32> depths(numTransforms, 0);
+            u32 maxDepth = 0;
+            for (u32 i = 0; i < numTransforms; ++i)
+            {
+                const Transform* parent = m_transforms[i]->mpParentTransform;
+                while (parent != nullptr && parent->m_hierarchy == this)
+                {
+                    ++depths[i];
+                    parent = parent->mpParentTransform;
+                }
+                
+                maxDepth = std::max(maxDepth, depths[i]);
+            }
+            
+            //counting sort by depth, preserving the existing order within each level.
+            m_levelOffsets.assign(maxDepth + 2, 0);
+            for (u32 depth : depths)
+            {
+                ++m_levelOffsets[depth + 1];
+            }
+            for (u32 level = 1; level < m_levelOffsets.size(); ++level)
+            {
+                m_levelOffsets[level] += m_levelOffsets[level - 1];
+            }
+            
+            std::vector<u32> insertionPoints(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+            std::vector<u32> order(numTransforms);
+            for (u32 i = 0; i < numTransforms; ++i)
+            {
+                order[insertionPoints[depths[i]]++] = i;
+            }
+            
+            Reorder(order, m_positions);
+            Reorder(order, m_scales);
+            Reorder(order, m_orientations);
+            Reorder(order, m_localTransforms);
+            Reorder(order, m_worldTransforms);
+            Reorder(order, m_transforms);
+            
+            for (u32 i = 0; i < numTransforms; ++i)
+            {
+                m_transforms[i]->m_hierarchyIndex = i;
+            }
+            
+            for (u32 i = 0; i < numTransforms; ++i)
+            {
+                const Transform* parent = m_transforms[i]->mpParentTransform;
+                m_parentIndices[i] = (parent != nullptr && parent->m_hierarchy == this) ? parent->m_hierarchyIndex : k_noParent;
+            }
+            
+            m_isSorted = true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void TransformHierarchy::UpdateWorldTransformRange(u32 in_start, u32 in_end)
+        {
+            for (u32 i = in_start; i < in_end; ++i)
+            {
+                CS_ASSERT(m_parentIndices[i] != k_noParent, "Only non-root transforms can be updated from their parent.");
+                
+                m_transforms[i]->UpdateWorldTransform(m_worldTransforms[m_parentIndices[i]]);
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        TransformHierarchy::~TransformHierarchy()
+        {
+            while (m_transforms.empty() == false)
+            {
+                Remove(m_transforms.back());
+            }
+        }
+    }
+}
@@ -0,0 +1,163 @@
+//
+//  TransformHierarchy.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_ENTITY_TRANSFORMHIERARCHY_H_
+#define _CHILLISOURCE_CORE_ENTITY_TRANSFORMHIERARCHY_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// Contiguous storage for the data of a group of transforms. While a transform
+        /// is attached to a hierarchy its local position, scale, orientation and its
+        /// cached local and world matrices live in the hierarchy's arrays rather than
+        /// in the transform itself; the Transform object continues to work as normal,
+        /// acting as a handle into this storage.
+        ///
+        /// The arrays are kept sorted by depth in the transform hierarchy, so parents
+        /// always precede their children. This allows all world transforms to be
+        /// brought up to date in a single linear pass, with each depth level split
+        /// across the task scheduler when it is large enough.
+        ///
+        /// This is typically owned by a Scene which has contiguous transforms enabled.
+        /// It is not thread-safe and should only be used on the main thread.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class TransformHierarchy final
+        {
+        public:
+            CS_DECLARE_NOCOPY(TransformHierarchy);
+            //------------------------------------------------------------------------------
+            /// Constructor.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            TransformHierarchy() = default;
+            //------------------------------------------------------------------------------
+            /// Moves the data for the given transform into the hierarchy. The transform
+            /// must not already belong to a hierarchy.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The transform to add.
+            //------------------------------------------------------------------------------
+            void Add(Transform* in_transform);
+            //------------------------------------------------------------------------------
+            /// Moves the data for the given transform out of the hierarchy and back into
+            /// the transform itself.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The transform to remove. Must belong to this hierarchy.
+            //------------------------------------------------------------------------------
+            void Remove(Transform* in_transform);
+            //------------------------------------------------------------------------------
+            /// Reserves space for the given total number of transforms so they can be
+            /// added without reallocating.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The total number of transforms.
+            //------------------------------------------------------------------------------
+            void Reserve(u32 in_numTransforms);
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The number of transforms in the hierarchy.
+            //------------------------------------------------------------------------------
+            u32 GetNumTransforms() const;
+            //------------------------------------------------------------------------------
+            /// Brings the world transform of every transform in the hierarchy up to date.
+            /// Only transforms which have changed, or have a changed ancestor, are
+            /// recalculated. Each depth level is processed in turn; levels containing
+            /// enough transforms are split into chunks and processed in parallel on the
+            /// task scheduler.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void UpdateWorldTransforms();
+            //------------------------------------------------------------------------------
+            /// Destructor. Any remaining transforms are removed from the hierarchy.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            ~TransformHierarchy();
+            
+        private:
+            friend class Transform;
+            
+            //------------------------------------------------------------------------------
+            /// Called by attached transforms when their parent changes, requiring the
+            /// depth order to be recalculated.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void OnHierarchyChanged();
+            //------------------------------------------------------------------------------
+            /// Re-orders the transform data by depth and recalculates the parent indices
+            /// and level offsets.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void SortByDepth();
+            //------------------------------------------------------------------------------
+            /// Updates the world transforms of the given range of non-root transforms.
+            /// The parents of each must already be up to date.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The index of the first transform.
+            /// @param The index after the last transform.
+            //------------------------------------------------------------------------------
+            void UpdateWorldTransformRange(u32 in_start, u32 in_end);
+            
+            std::vector<Vector3> m_positions;
+            std::vector<Vector3> m_scales;
+            std::vector<Quaternion> m_orientations;
+            std::vector<Matrix4> m_localTransforms;
+            std::vector<Matrix4> m_worldTransforms;
+            std::vector<u32> m_parentIndices;
+            std::vector<Transform*> m_transforms;
+            
+            std::vector<u32> m_levelOffsets;
+            bool m_isSorted = true;
+        };
+    }
+}
+
+#endif
@@ -31,11 +31,15 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/ForwardDeclarations.h>
+#include <ChilliSource/Core/Container/PoolAllocator.h>
+#include <ChilliSource/Core/Delegate/InlineDelegate.h>
 #include <ChilliSource/Core/Event/EventConnection.h>
 #include <ChilliSource/Core/Event/IConnectableEvent.h>
 #include <ChilliSource/Core/Event/IDisconnectableEvent.h>
 
-#include <vector>
+#include <cstddef>
+#include <new>
+#include <type_traits>
 
 namespace ChilliSource
 {
@@ -47,11 +51,23 @@ namespace ChilliSource
         /// Objects should though expose the IConnectableEvent interface
         /// to prevent other objects invoking the event.
         ///
+        /// Listeners are stored in an intrusive list of nodes, each holding
+        /// an inline delegate. Each node shares a single pooled allocation
+        /// with the connection which refers to it. Opening and closing
+        /// connections therefore doesn't touch the heap, and notifying an
+        /// event with no listeners costs a single check. Nodes closed during
+        /// notification are kept alive until it finishes, so a listener can
+        /// safely destroy its own connection.
+        ///
         /// @author S Downie
         //-----------------------------------------------------------------
         template <typename TDelegateType> class Event final : public IConnectableEvent<TDelegateType>, public IDisconnectableEvent
         {
         public:
+            
+            typedef typename IConnectableEvent<TDelegateType>::InlineDelegateType InlineDelegateType;
+            using IConnectableEvent<TDelegateType>::OpenConnection;
+            
             //-------------------------------------------------------------
             /// Constructor
             ///
@@ -66,6 +82,7 @@ namespace ChilliSource
             ~Event()
             {
                 CloseAllConnections();
+                DeleteClosedNodes();
             }
             //-------------------------------------------------------------
             /// No copying of events is allowed. If you wish to make a
@@ -86,14 +103,7 @@ namespace ChilliSource
 			//-------------------------------------------------------------
 			Event(Event&& in_moveFrom)
 			{
-				CloseAllConnections();
-
-				m_isNotifying = in_moveFrom.m_isNotifying;
-				m_connections = std::move(in_moveFrom.m_connections);
-				for (auto& connectionContainer : m_connections)
-				{
-					connectionContainer.m_connection->SetOwningEvent(this);
-				}
+				MoveConnections(in_moveFrom);
 			}
 			//-------------------------------------------------------------
 			/// Although we don't want events to be copyable, we do want
@@ -109,13 +119,7 @@ namespace ChilliSource
 			Event& operator= (Event&& in_moveFrom)
 			{
 				CloseAllConnections();
-
-				m_isNotifying = in_moveFrom.m_isNotifying;
-				m_connections = std::move(in_moveFrom.m_connections);
-				for (auto& connectionContainer : m_connections)
-				{
-					connectionContainer.m_connection->SetOwningEvent(this);
-				}
+                MoveConnections(in_moveFrom);
 
 				return *this;
 			}
@@ -131,15 +135,45 @@ namespace ChilliSource
             //-------------------------------------------------------------
             EventConnectionUPtr OpenConnection(const TDelegateType& in_delegate) override
             {
-                EventConnectionUPtr connection(new EventConnection());
+                return OpenInlineConnection(InlineDelegateType(in_delegate));
+            }
+            //-------------------------------------------------------------
+            /// Opens a new connection to the event with an inline delegate.
+            /// While this connection remains in scope the delegate will be
+            /// notified of events
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Delegate to notify
+            ///
+            /// @return Scoped connection
+            //-------------------------------------------------------------
+            EventConnectionUPtr OpenInlineConnection(InlineDelegateType&& in_delegate) override
+            {
+                CS_ASSERT(static_cast<bool>(in_delegate) == true, "Cannot open a connection with a null delegate.");
+                
+                //the node is constructed in the same pooled block as the connection.
+                Connection* connection = new Connection();
+                ConnectionBlock* block = ConnectionBlock::FromConnection(connection);
+                ConnectionNode* node = new (&block->m_node) ConnectionNode(std::move(in_delegate));
+                block->m_isNodeAlive = true;
+                
+                node->m_connection = connection;
+                connection->m_node = node;
                 connection->SetOwningEvent(this);
-            
-                ConnectionDesc desc;
-                desc.m_delegate = in_delegate;
-                desc.m_connection = connection.get();
-                m_connections.push_back(desc);
-            
-                return connection;
+                
+                node->m_previous = m_lastNode;
+                if (m_lastNode != nullptr)
+                {
+                    m_lastNode->m_next = node;
+                }
+                else
+                {
+                    m_firstNode = node;
+                }
+                m_lastNode = node;
+                
+                return EventConnectionUPtr(connection);
             }
             //-------------------------------------------------------------
             /// Close connection to the event. The connection will
@@ -151,26 +185,48 @@ namespace ChilliSource
             //-------------------------------------------------------------
             void CloseConnection(EventConnection* in_connection) override
             {
-                for(u32 i=0; i<m_connections.size(); ++i)
+                ConnectionNode* node = static_cast<Connection*>(in_connection)->m_node;
+                
+                //any notifications in progress must skip the node without touching it again.
+                for (NotifyCursor* cursor = m_notifyCursors; cursor != nullptr; cursor = cursor->m_outer)
                 {
-                    ConnectionDesc& desc = m_connections[i];
-                    if(desc.m_connection == in_connection)
+                    if (cursor->m_next == node)
+                    {
+                        cursor->m_next = (node == cursor->m_last) ? nullptr : node->m_next;
+                    }
+                    
+                    if (cursor->m_last == node)
                     {
-                        if(m_isNotifying == false)
-                        {
-                            m_connections.erase(m_connections.begin() + i);
-                        }
-                        else
-                        {
-                            desc.m_connection = nullptr;
-                        }
-                        
-                        return;
+                        cursor->m_last = node->m_previous;
                     }
                 }
+                
+                if (node->m_previous != nullptr)
+                {
+                    node->m_previous->m_next = node->m_next;
+                }
+                else
+                {
+                    m_firstNode = node->m_next;
+                }
+                
+                if (node->m_next != nullptr)
+                {
+                    node->m_next->m_previous = node->m_previous;
+                }
+                else
+                {
+                    m_lastNode = node->m_previous;
+                }
+                
+                ReleaseNode(node);
             }
             //-------------------------------------------------------------
-            /// Notify connections that the event has occurred
+            /// Notify connections that the event has occurred. Connections
+            /// opened during notification aren't notified until the next
+            /// time the event occurs, and connections closed during
+            /// notification aren't notified at all. Listeners may close or
+            /// destroy their own connection while being notified.
             ///
             /// @author S Downie
             ///
@@ -178,22 +234,35 @@ namespace ChilliSource
             //-------------------------------------------------------------
             template <typename... TArgTypes> void NotifyConnections(TArgTypes&&... in_args)
             {
-                m_isNotifying = true;
+                if (m_firstNode == nullptr)
+                {
+                    return;
+                }
                 
-                //Take a snapshot of the number of delegates so any new ones added
-                //during the notify loop aren't notified themseleves.
-                auto numConnections = m_connections.size();
-				for (typename ConnectionList::size_type i = 0; i < numConnections; ++i)
+                //The cursor is registered with the event so that nodes closed by a
+                //listener can be stepped over and are kept alive until notification
+                //ends, and the last node is noted so that nodes opened by a listener
+                //aren't notified.
+                NotifyCursor cursor;
+                cursor.m_next = m_firstNode;
+                cursor.m_last = m_lastNode;
+                cursor.m_outer = m_notifyCursors;
+                m_notifyCursors = &cursor;
+                
+                while (cursor.m_next != nullptr)
                 {
-                    if(m_connections[i].m_connection != nullptr)
-                    {
-                        m_connections[i].m_delegate(std::forward<TArgTypes>(in_args)...);
-                    }
+                    ConnectionNode* node = cursor.m_next;
+                    cursor.m_next = (node == cursor.m_last) ? nullptr : node->m_next;
+                    
+                    node->m_delegate(std::forward<TArgTypes>(in_args)...);
                 }
                 
-                m_isNotifying = false;
+                m_notifyCursors = cursor.m_outer;
                 
-                RemoveClosedConnections();
+                if (m_notifyCursors == nullptr)
+                {
+                    DeleteClosedNodes();
+                }
             }
             //-------------------------------------------------------------
             /// Closes all the currently open connections
@@ -202,53 +271,248 @@ namespace ChilliSource
             //-------------------------------------------------------------
             void CloseAllConnections()
             {
-                for(u32 i=0; i<m_connections.size(); ++i)
+                ConnectionNode* node = m_firstNode;
+                while (node != nullptr)
                 {
-                    if(m_connections[i].m_connection != nullptr)
-                    {
-                        m_connections[i].m_connection->SetOwningEvent(nullptr);
-                    }
+                    ConnectionNode* next = node->m_next;
+                    
+                    node->m_connection->SetOwningEvent(nullptr);
+                    ReleaseNode(node);
+                    
+                    node = next;
                 }
                 
-                m_connections.clear();
+                m_firstNode = nullptr;
+                m_lastNode = nullptr;
+                
+                for (NotifyCursor* cursor = m_notifyCursors; cursor != nullptr; cursor = cursor->m_outer)
+                {
+                    cursor->m_next = nullptr;
+                    cursor->m_last = nullptr;
+                }
             }
     
         private:
-    
+            
+            class Connection;
+            
             //-------------------------------------------------------------------------
-            /// Remove from the list any connections that have been flagged as closed
+            /// An entry in the intrusive list of listeners, holding the delegate to
+            /// notify. Nodes are owned by the event rather than the connection so a
+            /// node can outlive its connection while its delegate is being invoked.
+            /// Nodes are constructed in the same block as their connection.
             ///
-            /// @author S Downie
+            /// @author Carlos Artesano
             //-------------------------------------------------------------------------
-            void RemoveClosedConnections()
+            struct ConnectionNode final
             {
-                for(typename ConnectionList::iterator it = m_connections.begin(); it != m_connections.end(); )
+                //-------------------------------------------------------------------------
+                /// Constructor
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The delegate to notify.
+                //-------------------------------------------------------------------------
+                ConnectionNode(InlineDelegateType&& in_delegate)
+                : m_delegate(std::move(in_delegate))
                 {
-                    if(it->m_connection == nullptr)
-                    {
-                        it = m_connections.erase(it);
-                    }
-                    else
+                }
+                
+                InlineDelegateType m_delegate;
+                Connection* m_connection = nullptr;
+                ConnectionNode* m_previous = nullptr;
+                ConnectionNode* m_next = nullptr;
+            };
+            //-------------------------------------------------------------------------
+            /// The connection handed out to listeners, which refers to its node in
+            /// the list. Each connection is allocated from a pool in a block which
+            /// also holds its node.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------------------------
+            class Connection final : public EventConnection
+            {
+            public:
+                //-------------------------------------------------------------------------
+                /// Allocates a block for the connection and its node from the pool.
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The size of the connection.
+                ///
+                /// @return The memory for the connection.
+                //-------------------------------------------------------------------------
+                static void* operator new(std::size_t in_size)
+                {
+                    ConnectionBlock* block = PoolAllocator<ConnectionBlock>().allocate(1);
+                    block->m_isConnectionAlive = true;
+                    block->m_isNodeAlive = false;
+                    return &block->m_connection;
+                }
+                //-------------------------------------------------------------------------
+                /// Returns the block to the pool, unless the node is still alive as
+                /// it was closed during notification. In that case the event frees
+                /// the block once the node is destroyed.
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The memory for the connection.
+                //-------------------------------------------------------------------------
+                static void operator delete(void* in_pointer)
+                {
+                    ConnectionBlock* block = ConnectionBlock::FromConnection(in_pointer);
+                    block->m_isConnectionAlive = false;
+                    if (block->m_isNodeAlive == false)
                     {
-                        ++it;
+                        PoolAllocator<ConnectionBlock>().deallocate(block, 1);
                     }
                 }
-            }
-    
-        private:
-                                    
-            struct ConnectionDesc
+                //-------------------------------------------------------------------------
+                /// Destructor. This closes the connection while the node can still be
+                /// reached.
+                ///
+                /// @author Carlos Artesano
+                //-------------------------------------------------------------------------
+                ~Connection()
+                {
+                    Close();
+                }
+                
+                ConnectionNode* m_node = nullptr;
+            };
+            //-------------------------------------------------------------------------
+            /// The memory for a connection and its node. Either may be destroyed
+            /// first; the block is returned to the pool once both have been.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------------------------
+            struct ConnectionBlock final
             {
-                TDelegateType m_delegate;
-                EventConnection* m_connection = nullptr;
+                //-------------------------------------------------------------------------
+                /// @author Carlos Artesano
+                ///
+                /// @param The memory of a connection.
+                ///
+                /// @return The block containing the connection.
+                //-------------------------------------------------------------------------
+                static ConnectionBlock* FromConnection(void* in_connection)
+                {
+                    return reinterpret_cast<ConnectionBlock*>(static_cast<u8*>(in_connection) - offsetof(ConnectionBlock, m_connection));
+                }
+                //-------------------------------------------------------------------------
+                /// @author Carlos Artesano
+                ///
+                /// @param The memory of a node.
+                ///
+                /// @return The block containing the node.
+                //-------------------------------------------------------------------------
+                static ConnectionBlock* FromNode(void* in_node)
+                {
+                    return reinterpret_cast<ConnectionBlock*>(static_cast<u8*>(in_node) - offsetof(ConnectionBlock, m_node));
+                }
+                
+                typename std::aligned_storage<sizeof(Connection), std::alignment_of<Connection>::value>::type m_connection;
+                typename std::aligned_storage<sizeof(ConnectionNode), std::alignment_of<ConnectionNode>::value>::type m_node;
+                bool m_isConnectionAlive;
+                bool m_isNodeAlive;
             };
+            //-------------------------------------------------------------------------
+            /// The progress of a notification which is in progress. Nested
+            /// notifications form a stack of cursors.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------------------------
+            struct NotifyCursor
+            {
+                ConnectionNode* m_next;
+                ConnectionNode* m_last;
+                NotifyCursor* m_outer;
+            };
+            //-------------------------------------------------------------------------
+            /// Destroys a node which has been unlinked from the list. If the event is
+            /// being notified the node may still be in use, so it is instead added
+            /// to the list of closed nodes to be destroyed once notification ends.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The node to release.
+            //-------------------------------------------------------------------------
+            void ReleaseNode(ConnectionNode* in_node)
+            {
+                in_node->m_connection = nullptr;
+                in_node->m_previous = nullptr;
+                
+                if (m_notifyCursors == nullptr)
+                {
+                    DestroyNode(in_node);
+                }
+                else
+                {
+                    in_node->m_next = m_firstClosedNode;
+                    m_firstClosedNode = in_node;
+                }
+            }
+            //-------------------------------------------------------------------------
+            /// Destroys all nodes which were closed during notification.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------------------------
+            void DeleteClosedNodes()
+            {
+                while (m_firstClosedNode != nullptr)
+                {
+                    ConnectionNode* next = m_firstClosedNode->m_next;
+                    DestroyNode(m_firstClosedNode);
+                    m_firstClosedNode = next;
+                }
+            }
+            //-------------------------------------------------------------------------
+            /// Destroys the given node, returning its block to the pool if the
+            /// connection has also been destroyed.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The node to destroy.
+            //-------------------------------------------------------------------------
+            static void DestroyNode(ConnectionNode* in_node)
+            {
+                ConnectionBlock* block = ConnectionBlock::FromNode(in_node);
+                in_node->~ConnectionNode();
+                block->m_isNodeAlive = false;
+                if (block->m_isConnectionAlive == false)
+                {
+                    PoolAllocator<ConnectionBlock>().deallocate(block, 1);
+                }
+            }
+            //-------------------------------------------------------------------------
+            /// Takes the connections from the given event, which must not be
+            /// notifying. This must have no connections.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The event to move from.
+            //-------------------------------------------------------------------------
+            void MoveConnections(Event& in_moveFrom)
+            {
+                CS_ASSERT(in_moveFrom.m_notifyCursors == nullptr, "Cannot move an event while it is being notified.");
+                
+                m_firstNode = in_moveFrom.m_firstNode;
+                m_lastNode = in_moveFrom.m_lastNode;
+                in_moveFrom.m_firstNode = nullptr;
+                in_moveFrom.m_lastNode = nullptr;
+                
+                for (ConnectionNode* node = m_firstNode; node != nullptr; node = node->m_next)
+                {
+                    node->m_connection->SetOwningEvent(this);
+                }
+            }
     
-            typedef std::vector<ConnectionDesc> ConnectionList;
-            ConnectionList m_connections;
-        
-            bool m_isNotifying = false;
+            ConnectionNode* m_firstNode = nullptr;
+            ConnectionNode* m_lastNode = nullptr;
+            ConnectionNode* m_firstClosedNode = nullptr;
+            NotifyCursor* m_notifyCursors = nullptr;
         };
     }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -48,11 +48,12 @@ namespace ChilliSource
         public:
             
             //----------------------------------------------------------------
-            /// Destructor
+            /// Destructor. This is virtual as events store their listeners
+            /// in their own subclass of connection.
             ///
             /// @author S Downie
             //----------------------------------------------------------------
-            ~EventConnection();
+            virtual ~EventConnection();
             //----------------------------------------------------------------
 			/// Sets the event this is connected to. This should only be called
 			/// by Event itself, don't call manually.
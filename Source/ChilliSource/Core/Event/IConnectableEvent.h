@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/ForwardDeclarations.h>
+#include <ChilliSource/Core/Delegate/InlineDelegate.h>
 
 namespace ChilliSource
 {
@@ -49,6 +50,8 @@ namespace ChilliSource
         {
         public:
             
+            typedef typename ToInlineDelegate<TDelegateType>::Type InlineDelegateType;
+            
             //-------------------------------------------------------------
             /// Constructor
             ///
@@ -75,6 +78,36 @@ namespace ChilliSource
             /// @return Scoped connection
             //-------------------------------------------------------------
             virtual EventConnectionUPtr OpenConnection(const TDelegateType& in_delegate) = 0;
+            //-------------------------------------------------------------
+            /// Opens a new connection to the event with an inline delegate.
+            /// Small lambdas passed to this are stored without any heap
+            /// allocation. While this connection remains in scope the
+            /// delegate will be notified of events
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Delegate to notify
+            ///
+            /// @return Scoped connection
+            //-------------------------------------------------------------
+            virtual EventConnectionUPtr OpenInlineConnection(InlineDelegateType&& in_delegate) = 0;
+            //-------------------------------------------------------------
+            /// Opens a new connection to the event which calls the given
+            /// member function. This should be preferred over passing
+            /// MakeDelegate() as it never requires a heap allocation for
+            /// the delegate.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Instance whose function to call
+            /// @param Member function ptr
+            ///
+            /// @return Scoped connection
+            //-------------------------------------------------------------
+            template <typename TSender, typename TMemberFunction> EventConnectionUPtr OpenConnection(TSender* in_sender, TMemberFunction in_memberFunction)
+            {
+                return OpenInlineConnection(InlineDelegateType(in_sender, in_memberFunction));
+            }
 			//-------------------------------------------------------------
 			/// Virtual destructor
 			///
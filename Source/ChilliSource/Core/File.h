@@ -31,11 +31,17 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/File/AppDataStore.h>
+#include <ChilliSource/Core/File/AsyncFileReader.h>
 #include <ChilliSource/Core/File/CSBinaryChunk.h>
 #include <ChilliSource/Core/File/CSBinaryInputStream.h>
+#include <ChilliSource/Core/File/CSBinaryOutputStream.h>
 #include <ChilliSource/Core/File/FileStream.h>
 #include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+#include <ChilliSource/Core/File/MemoryReader.h>
+#include <ChilliSource/Core/File/PackedArchive.h>
 #include <ChilliSource/Core/File/StorageLocation.h>
 #include <ChilliSource/Core/File/TaggedFilePathResolver.h>
+#include <ChilliSource/Core/File/VirtualFileStream.h>
 
 #endif
\ No newline at end of file
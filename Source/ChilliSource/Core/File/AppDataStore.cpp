@@ -320,7 +320,7 @@ namespace ChilliSource
 				if (fileStream != nullptr)
                 {
 					fileStream->SeekG(0, SeekDir::k_end);
-					u32 encryptedDataSize = fileStream->TellG();
+					u32 encryptedDataSize = static_cast<u32>(fileStream->TellG());
 					fileStream->SeekG(0, SeekDir::k_beginning);
                     
                     std::unique_ptr<s8[]> encryptedData(new s8[encryptedDataSize]);
@@ -0,0 +1,550 @@
+//
+//  AsyncFileReader.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/File/AsyncFileReader.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Delegate/MakeDelegate.h>
+#include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+#include <algorithm>
+#include <map>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const u32 k_numIOThreads = 1;
+            const u32 k_maxRequestsPerBatch = 64;
+            const u64 k_readAheadSize = 64 * 1024;
+            const u64 k_maxCoalesceGap = 16 * 1024;
+            const u32 k_maxCachedSpans = 8;
+            const u64 k_pageSize = 4096;
+            
+            //------------------------------------------------------------------------------
+            /// Touches each page of the given memory mapped file so that the pages are
+            /// faulted in on the calling thread rather than during decoding.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_file - The memory mapped file.
+            //------------------------------------------------------------------------------
+            void PrefetchPages(const MemoryMappedFile* in_file)
+            {
+                const volatile u8* data = in_file->GetData();
+                const u64 size = in_file->GetSize();
+                
+                u8 sink = 0;
+                for (u64 offset = 0; offset < size; offset += k_pageSize)
+                {
+                    sink ^= data[offset];
+                }
+                
+                volatile u8 result = sink;
+                (void)result;
+            }
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param in_offset - The offset of the range.
+            /// @param in_size - The size of the range.
+            /// @param in_dataSize - The size of the data the range should lie within.
+            ///
+            /// @return Whether or not the range lies within the data.
+            //------------------------------------------------------------------------------
+            bool IsRangeWithin(u64 in_offset, u64 in_size, u64 in_dataSize)
+            {
+                return (in_offset <= in_dataSize && in_size <= in_dataSize - in_offset);
+            }
+        }
+        
+        CS_DEFINE_NAMEDTYPE(AsyncFileReader);
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        AsyncFileReaderUPtr AsyncFileReader::Create()
+        {
+            return AsyncFileReaderUPtr(new AsyncFileReader());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        AsyncFileReader::AsyncFileReader()
+            : m_numPendingRequests(0), m_isFinished(false)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool AsyncFileReader::IsA(InterfaceIDType in_interfaceId) const
+        {
+            return (AsyncFileReader::InterfaceID == in_interfaceId);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::ReadFile(StorageLocation in_storageLocation, const std::string& in_filePath, const ReadDelegate& in_delegate, CompletionThread in_completionThread)
+        {
+            CS_ASSERT(in_delegate != nullptr, "Cannot read a file with a null delegate.");
+            
+            Request request;
+            request.m_storageLocation = in_storageLocation;
+            request.m_filePath = in_filePath;
+            request.m_wholeFile = true;
+            request.m_delegate = in_delegate;
+            request.m_completionThread = in_completionThread;
+            QueueRequest(std::move(request));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::Read(StorageLocation in_storageLocation, const std::string& in_filePath, u64 in_offset, u64 in_size, const ReadDelegate& in_delegate, CompletionThread in_completionThread)
+        {
+            CS_ASSERT(in_delegate != nullptr, "Cannot read a file with a null delegate.");
+            
+            Request request;
+            request.m_storageLocation = in_storageLocation;
+            request.m_filePath = in_filePath;
+            request.m_offset = in_offset;
+            request.m_size = in_size;
+            request.m_delegate = in_delegate;
+            request.m_completionThread = in_completionThread;
+            QueueRequest(std::move(request));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::ReadFiles(StorageLocation in_storageLocation, const std::vector<std::string>& in_filePaths, const BatchReadDelegate& in_delegate, CompletionThread in_completionThread)
+        {
+            CS_ASSERT(in_delegate != nullptr, "Cannot read files with a null delegate.");
+            
+            if (in_filePaths.empty() == true)
+            {
+                Dispatch([=]()
+                {
+                    in_delegate(std::vector<ReadResult>());
+                }, in_completionThread);
+                return;
+            }
+            
+            //The individual reads complete on the IO thread and only the final one
+            //dispatches the batch delegate to the requested thread.
+            auto results = std::make_shared<std::vector<ReadResult>>(in_filePaths.size());
+            auto numRemaining = std::make_shared<std::atomic<u32>>(static_cast<u32>(in_filePaths.size()));
+            
+            std::unique_lock<std::mutex> lock(m_requestMutex);
+            for (u32 i = 0; i < in_filePaths.size(); ++i)
+            {
+                Request request;
+                request.m_storageLocation = in_storageLocation;
+                request.m_filePath = in_filePaths[i];
+                request.m_wholeFile = true;
+                request.m_completeOnIOThread = true;
+                request.m_delegate = [=](const ReadResult& in_result)
+                {
+                    (*results)[i] = in_result;
+                    
+                    if (--(*numRemaining) == 0)
+                    {
+                        Dispatch([=]()
+                        {
+                            in_delegate(*results);
+                        }, in_completionThread);
+                    }
+                };
+                
+                m_requests.push_back(std::move(request));
+                ++m_numPendingRequests;
+            }
+            lock.unlock();
+            
+            m_requestCondition.notify_all();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 AsyncFileReader::GetNumPendingRequests() const
+        {
+            return m_numPendingRequests;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::OnInit()
+        {
+            m_fileSystem = Application::Get()->GetFileSystem();
+            CS_ASSERT(m_fileSystem != nullptr, "Async File Reader is missing required system: File System.");
+            
+            m_taskScheduler = Application::Get()->GetTaskScheduler();
+            CS_ASSERT(m_taskScheduler != nullptr, "Async File Reader is missing required system: Task Scheduler.");
+            
+            for (u32 i = 0; i < k_numIOThreads; ++i)
+            {
+                m_threads.push_back(std::thread(MakeDelegate(this, &AsyncFileReader::ProcessRequests)));
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::QueueRequest(Request in_request)
+        {
+            std::unique_lock<std::mutex> lock(m_requestMutex);
+            m_requests.push_back(std::move(in_request));
+            ++m_numPendingRequests;
+            lock.unlock();
+            
+            m_requestCondition.notify_one();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::ProcessRequests()
+        {
+            while (true)
+            {
+                std::vector<Request> batch;
+                
+                std::unique_lock<std::mutex> lock(m_requestMutex);
+                m_requestCondition.wait(lock, [&]()
+                {
+                    return (m_isFinished == true || m_requests.empty() == false);
+                });
+                
+                if (m_isFinished == true)
+                {
+                    return;
+                }
+                
+                while (m_requests.empty() == false && batch.size() < k_maxRequestsPerBatch)
+                {
+                    batch.push_back(std::move(m_requests.front()));
+                    m_requests.pop_front();
+                }
+                lock.unlock();
+                
+                //group the requests by file so that each file is only opened once per batch.
+                std::map<std::pair<StorageLocation, std::string>, std::vector<Request>> requestsByFile;
+                for (auto& request : batch)
+                {
+                    requestsByFile[std::make_pair(request.m_storageLocation, request.m_filePath)].push_back(std::move(request));
+                }
+                
+                for (auto& fileRequests : requestsByFile)
+                {
+                    ProcessFileRequests(fileRequests.second);
+                }
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::ProcessFileRequests(std::vector<Request>& in_requests)
+        {
+            CS_ASSERT(in_requests.empty() == false, "Cannot process an empty list of requests.");
+            
+            bool containsWholeFile = false;
+            for (const auto& request : in_requests)
+            {
+                if (request.m_wholeFile == true)
+                {
+                    containsWholeFile = true;
+                    break;
+                }
+            }
+            
+            if (containsWholeFile == false)
+            {
+                ProcessRangedRequests(in_requests);
+                return;
+            }
+            
+            //If the whole file is required, map it once and serve all of the requests
+            //from the mapping.
+            const Request& first = in_requests.front();
+            MemoryMappedFileCSPtr file = m_fileSystem->CreateMemoryMappedFile(first.m_storageLocation, first.m_filePath);
+            if (file != nullptr && file->IsMapped() == true)
+            {
+                PrefetchPages(file.get());
+            }
+            
+            for (const auto& request : in_requests)
+            {
+                ReadResult result;
+                if (file == nullptr)
+                {
+                    CS_LOG_ERROR("Async File Reader: Could not open file '" + request.m_filePath + "'.");
+                }
+                else if (request.m_wholeFile == true)
+                {
+                    result.m_success = true;
+                    result.m_file = file;
+                    result.m_data = file->GetData();
+                    result.m_dataSize = file->GetSize();
+                }
+                else if (IsRangeWithin(request.m_offset, request.m_size, file->GetSize()) == true)
+                {
+                    result.m_success = true;
+                    result.m_file = file;
+                    result.m_data = file->GetData() + request.m_offset;
+                    result.m_dataSize = request.m_size;
+                }
+                else
+                {
+                    CS_LOG_ERROR("Async File Reader: Read range lies outside of file '" + request.m_filePath + "'.");
+                }
+                
+                Complete(request, result);
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::ProcessRangedRequests(std::vector<Request>& in_requests)
+        {
+            //Only files in read-only storage locations are cached, as files in writable locations
+            //could change between reads.
+            const bool isCacheable = (m_fileSystem->IsStorageLocationWritable(in_requests.front().m_storageLocation) == false);
+            
+            std::vector<Request> uncachedRequests;
+            for (auto& request : in_requests)
+            {
+                if (isCacheable == false || TryReadFromCache(request) == false)
+                {
+                    uncachedRequests.push_back(std::move(request));
+                }
+            }
+            
+            if (uncachedRequests.empty() == true)
+            {
+                return;
+            }
+            
+            const StorageLocation storageLocation = uncachedRequests.front().m_storageLocation;
+            const std::string filePath = uncachedRequests.front().m_filePath;
+            
+            FileStreamUPtr fileStream = m_fileSystem->CreateFileStream(storageLocation, filePath, FileMode::k_readBinary);
+            if (fileStream == nullptr)
+            {
+                CS_LOG_ERROR("Async File Reader: Could not open file '" + filePath + "'.");
+                for (const auto& request : uncachedRequests)
+                {
+                    Complete(request, ReadResult());
+                }
+                return;
+            }
+            
+            fileStream->SeekG(0, SeekDir::k_end);
+            const u64 fileSize = static_cast<u64>(std::max(fileStream->TellG(), s64(0)));
+            
+            std::sort(uncachedRequests.begin(), uncachedRequests.end(), [](const Request& in_a, const Request& in_b)
+            {
+                return (in_a.m_offset < in_b.m_offset);
+            });
+            
+            u32 spanStartIndex = 0;
+            while (spanStartIndex < uncachedRequests.size())
+            {
+                const Request& spanStartRequest = uncachedRequests[spanStartIndex];
+                if (IsRangeWithin(spanStartRequest.m_offset, spanStartRequest.m_size, fileSize) == false)
+                {
+                    CS_LOG_ERROR("Async File Reader: Read range lies outside of file '" + filePath + "'.");
+                    Complete(spanStartRequest, ReadResult());
+                    ++spanStartIndex;
+                    continue;
+                }
+                
+                //extend the span to include the read ahead and any subsequent requests which
+                //lie within or close to it.
+                const u64 spanStart = spanStartRequest.m_offset;
+                u64 spanEnd = std::min(std::max(spanStart + spanStartRequest.m_size, spanStart + k_readAheadSize), fileSize);
+                
+                u32 spanEndIndex = spanStartIndex + 1;
+                while (spanEndIndex < uncachedRequests.size())
+                {
+                    const Request& request = uncachedRequests[spanEndIndex];
+                    if (request.m_offset > spanEnd + k_maxCoalesceGap || IsRangeWithin(request.m_offset, request.m_size, fileSize) == false)
+                    {
+                        break;
+                    }
+                    
+                    spanEnd = std::max(spanEnd, request.m_offset + request.m_size);
+                    ++spanEndIndex;
+                }
+                
+                const u64 spanSize = spanEnd - spanStart;
+                std::unique_ptr<u8[]> spanData(new u8[static_cast<size_t>(spanSize)]);
+                fileStream->SeekG(static_cast<s64>(spanStart), SeekDir::k_beginning);
+                fileStream->Read(reinterpret_cast<s8*>(spanData.get()), static_cast<s64>(spanSize));
+                
+                //Read() doesn't return the number of bytes read, but the stream position is
+                //only at the end of the span if all of it was read.
+                if (fileStream->TellG() != static_cast<s64>(spanEnd))
+                {
+                    CS_LOG_ERROR("Async File Reader: Failed to read from file '" + filePath + "'.");
+                    for (u32 i = spanStartIndex; i < spanEndIndex; ++i)
+                    {
+                        Complete(uncachedRequests[i], ReadResult());
+                    }
+                    
+                    spanStartIndex = spanEndIndex;
+                    continue;
+                }
+                
+                MemoryMappedFileCSPtr span = MemoryMappedFile::Create(std::move(spanData), spanSize);
+                for (u32 i = spanStartIndex; i < spanEndIndex; ++i)
+                {
+                    const Request& request = uncachedRequests[i];
+                    
+                    ReadResult result;
+                    result.m_success = true;
+                    result.m_file = span;
+                    result.m_data = span->GetData() + (request.m_offset - spanStart);
+                    result.m_dataSize = request.m_size;
+                    Complete(request, result);
+                }
+                
+                if (isCacheable == true)
+                {
+                    CachedSpan cachedSpan;
+                    cachedSpan.m_storageLocation = storageLocation;
+                    cachedSpan.m_filePath = filePath;
+                    cachedSpan.m_offset = spanStart;
+                    cachedSpan.m_data = span;
+                    AddToCache(std::move(cachedSpan));
+                }
+                
+                spanStartIndex = spanEndIndex;
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool AsyncFileReader::TryReadFromCache(const Request& in_request)
+        {
+            MemoryMappedFileCSPtr span;
+            u64 spanOffset = 0;
+            
+            std::unique_lock<std::mutex> lock(m_cacheMutex);
+            for (const auto& cachedSpan : m_readAheadCache)
+            {
+                if (cachedSpan.m_storageLocation == in_request.m_storageLocation && cachedSpan.m_filePath == in_request.m_filePath && in_request.m_offset >= cachedSpan.m_offset &&
+                    IsRangeWithin(in_request.m_offset - cachedSpan.m_offset, in_request.m_size, cachedSpan.m_data->GetSize()) == true)
+                {
+                    span = cachedSpan.m_data;
+                    spanOffset = cachedSpan.m_offset;
+                    break;
+                }
+            }
+            lock.unlock();
+            
+            if (span == nullptr)
+            {
+                return false;
+            }
+            
+            ReadResult result;
+            result.m_success = true;
+            result.m_file = span;
+            result.m_data = span->GetData() + (in_request.m_offset - spanOffset);
+            result.m_dataSize = in_request.m_size;
+            Complete(in_request, result);
+            
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::AddToCache(CachedSpan in_span)
+        {
+            std::unique_lock<std::mutex> lock(m_cacheMutex);
+            
+            m_readAheadCache.push_front(std::move(in_span));
+            if (m_readAheadCache.size() > k_maxCachedSpans)
+            {
+                m_readAheadCache.pop_back();
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::Complete(const Request& in_request, const ReadResult& in_result)
+        {
+            --m_numPendingRequests;
+            
+            if (m_isFinished == true)
+            {
+                return;
+            }
+            
+            if (in_request.m_completeOnIOThread == true)
+            {
+                in_request.m_delegate(in_result);
+                return;
+            }
+            
+            ReadDelegate delegate = in_request.m_delegate;
+            Dispatch([=]()
+            {
+                delegate(in_result);
+            }, in_request.m_completionThread);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::Dispatch(const std::function<void()>& in_task, CompletionThread in_completionThread)
+        {
+            if (m_isFinished == true)
+            {
+                return;
+            }
+            
+            switch (in_completionThread)
+            {
+                case CompletionThread::k_background:
+                    m_taskScheduler->ScheduleTask(in_task);
+                    break;
+                case CompletionThread::k_main:
+                    m_taskScheduler->ScheduleMainThreadTask(in_task);
+                    break;
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void AsyncFileReader::OnDestroy()
+        {
+            std::unique_lock<std::mutex> lock(m_requestMutex);
+            m_isFinished = true;
+            m_numPendingRequests -= static_cast<u32>(m_requests.size());
+            m_requests.clear();
+            lock.unlock();
+            
+            m_requestCondition.notify_all();
+            
+            for (auto& thread : m_threads)
+            {
+                thread.join();
+            }
+            m_threads.clear();
+            
+            m_readAheadCache.clear();
+            
+            m_taskScheduler = nullptr;
+            m_fileSystem = nullptr;
+        }
+    }
+}
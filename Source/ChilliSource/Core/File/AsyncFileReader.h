@@ -0,0 +1,314 @@
+//
+//  AsyncFileReader.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_FILE_ASYNCFILEREADER_H_
+#define _CHILLISOURCE_CORE_FILE_ASYNCFILEREADER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/StorageLocation.h>
+#include <ChilliSource/Core/System/AppSystem.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// A system for reading files asynchronously on dedicated IO threads. Resource
+        /// providers can issue reads and continue decoding when they complete rather
+        /// than blocking a task scheduler thread on disk access.
+        ///
+        /// Requests are queued and processed in batches. All requests in a batch
+        /// which target the same file are served by a single open of that file:
+        /// whole file reads are memory mapped, with the pages touched on the IO
+        /// thread so the decode doesn't stall on page faults, and ranged reads are
+        /// sorted and adjacent ranges are coalesced into a single read. Ranged reads
+        /// also read ahead and, for files in read-only storage locations, the most
+        /// recently read spans are kept so subsequent sequential reads don't need to
+        /// go to disk. Files in writable locations are never cached as they could
+        /// change between reads.
+        ///
+        /// The data in a read result is only guaranteed to remain valid for as long
+        /// as the result's file is kept alive.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class AsyncFileReader final : public AppSystem
+        {
+        public:
+            CS_DECLARE_NAMEDTYPE(AsyncFileReader);
+            //------------------------------------------------------------------------------
+            /// The thread on which a read completion delegate is called.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            enum class CompletionThread
+            {
+                k_background,
+                k_main
+            };
+            //------------------------------------------------------------------------------
+            /// The result of a single read. The data points into the given file, which
+            /// must be kept alive for as long as the data is in use.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            struct ReadResult
+            {
+                bool m_success = false;
+                MemoryMappedFileCSPtr m_file;
+                const u8* m_data = nullptr;
+                u64 m_dataSize = 0;
+            };
+            //------------------------------------------------------------------------------
+            /// Delegates called when reads complete.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            using ReadDelegate = std::function<void(const ReadResult& in_result)>;
+            using BatchReadDelegate = std::function<void(const std::vector<ReadResult>& in_results)>;
+            //------------------------------------------------------------------------------
+            /// Allows querying of whether or not this system implements the interface
+            /// described by the given interface Id.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_interfaceId - The interface Id.
+            ///
+            /// @return Whether or not the interface is implemented.
+            //------------------------------------------------------------------------------
+            bool IsA(InterfaceIDType in_interfaceId) const override;
+            //------------------------------------------------------------------------------
+            /// Queues a read of the entire contents of the given file. This is thread
+            /// safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location of the file.
+            /// @param in_filePath - The file path.
+            /// @param in_delegate - The delegate called when the read completes.
+            /// @param in_completionThread - [Optional] The thread the delegate is
+            /// called on. Defaults to a background thread.
+            //------------------------------------------------------------------------------
+            void ReadFile(StorageLocation in_storageLocation, const std::string& in_filePath, const ReadDelegate& in_delegate,
+                          CompletionThread in_completionThread = CompletionThread::k_background);
+            //------------------------------------------------------------------------------
+            /// Queues a read of the given range of the given file. The read fails if the
+            /// range lies outside of the file. This is thread safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location of the file.
+            /// @param in_filePath - The file path.
+            /// @param in_offset - The offset into the file in bytes.
+            /// @param in_size - The size of the range in bytes.
+            /// @param in_delegate - The delegate called when the read completes.
+            /// @param in_completionThread - [Optional] The thread the delegate is
+            /// called on. Defaults to a background thread.
+            //------------------------------------------------------------------------------
+            void Read(StorageLocation in_storageLocation, const std::string& in_filePath, u64 in_offset, u64 in_size, const ReadDelegate& in_delegate,
+                      CompletionThread in_completionThread = CompletionThread::k_background);
+            //------------------------------------------------------------------------------
+            /// Queues reads of the entire contents of each of the given files. The
+            /// delegate is called once all reads have completed, with the results in
+            /// the same order as the given paths. This is thread safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location of the files.
+            /// @param in_filePaths - The file paths.
+            /// @param in_delegate - The delegate called when all reads complete.
+            /// @param in_completionThread - [Optional] The thread the delegate is
+            /// called on. Defaults to a background thread.
+            //------------------------------------------------------------------------------
+            void ReadFiles(StorageLocation in_storageLocation, const std::vector<std::string>& in_filePaths, const BatchReadDelegate& in_delegate,
+                           CompletionThread in_completionThread = CompletionThread::k_background);
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The number of reads which are queued or in progress.
+            //------------------------------------------------------------------------------
+            u32 GetNumPendingRequests() const;
+            
+        private:
+            friend class Application;
+            //------------------------------------------------------------------------------
+            /// A single queued read.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            struct Request
+            {
+                StorageLocation m_storageLocation;
+                std::string m_filePath;
+                bool m_wholeFile = false;
+                u64 m_offset = 0;
+                u64 m_size = 0;
+                ReadDelegate m_delegate;
+                CompletionThread m_completionThread = CompletionThread::k_background;
+                bool m_completeOnIOThread = false;
+            };
+            //------------------------------------------------------------------------------
+            /// A span of a file which has previously been read by a ranged read.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            struct CachedSpan
+            {
+                StorageLocation m_storageLocation;
+                std::string m_filePath;
+                u64 m_offset = 0;
+                MemoryMappedFileCSPtr m_data;
+            };
+            //------------------------------------------------------------------------------
+            /// Factory method for creating a new instance of the system. This should
+            /// only be called by the Application.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The new instance.
+            //------------------------------------------------------------------------------
+            static AsyncFileReaderUPtr Create();
+            //------------------------------------------------------------------------------
+            /// Private constructor to force the use of the factory method.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            AsyncFileReader();
+            //------------------------------------------------------------------------------
+            /// Adds the given request to the queue and wakes an IO thread.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_request - The request.
+            //------------------------------------------------------------------------------
+            void QueueRequest(Request in_request);
+            //------------------------------------------------------------------------------
+            /// The IO thread loop. Waits for requests and processes them in batches
+            /// until the system is destroyed.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void ProcessRequests();
+            //------------------------------------------------------------------------------
+            /// Processes all requests in a batch which target the same file.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_requests - The requests. These must all target the same file.
+            //------------------------------------------------------------------------------
+            void ProcessFileRequests(std::vector<Request>& in_requests);
+            //------------------------------------------------------------------------------
+            /// Processes requests which only read ranges of a file. If the file is in a
+            /// read-only storage location, requests which lie within a cached span are
+            /// served from the cache. The rest are sorted and coalesced into as few
+            /// reads as possible.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_requests - The requests. These must all target the same file.
+            //------------------------------------------------------------------------------
+            void ProcessRangedRequests(std::vector<Request>& in_requests);
+            //------------------------------------------------------------------------------
+            /// Tries to serve the given ranged request from the read ahead cache.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_request - The request.
+            ///
+            /// @return Whether or not the request was served.
+            //------------------------------------------------------------------------------
+            bool TryReadFromCache(const Request& in_request);
+            //------------------------------------------------------------------------------
+            /// Adds the given span to the read ahead cache, evicting the oldest span
+            /// if the cache is full.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_span - The span.
+            //------------------------------------------------------------------------------
+            void AddToCache(CachedSpan in_span);
+            //------------------------------------------------------------------------------
+            /// Calls the request's delegate with the given result on the requested
+            /// thread. This does nothing if the system is being destroyed.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_request - The request.
+            /// @param in_result - The result.
+            //------------------------------------------------------------------------------
+            void Complete(const Request& in_request, const ReadResult& in_result);
+            //------------------------------------------------------------------------------
+            /// Schedules the given task on the given completion thread. This does
+            /// nothing if the system is being destroyed.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_task - The task.
+            /// @param in_completionThread - The thread to run the task on.
+            //------------------------------------------------------------------------------
+            void Dispatch(const std::function<void()>& in_task, CompletionThread in_completionThread);
+            //------------------------------------------------------------------------------
+            /// Starts the IO threads.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void OnInit() override;
+            //------------------------------------------------------------------------------
+            /// Stops the IO threads. Any requests which haven't been processed are
+            /// discarded.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void OnDestroy() override;
+            
+            FileSystem* m_fileSystem = nullptr;
+            TaskScheduler* m_taskScheduler = nullptr;
+            
+            std::vector<std::thread> m_threads;
+            std::deque<Request> m_requests;
+            std::mutex m_requestMutex;
+            std::condition_variable m_requestCondition;
+            std::atomic<u32> m_numPendingRequests;
+            std::atomic<bool> m_isFinished;
+            
+            std::deque<CachedSpan> m_readAheadCache;
+            std::mutex m_cacheMutex;
+        };
+    }
+}
+
+#endif
@@ -28,15 +28,21 @@
 
 #include <ChilliSource/Core/File/CSBinaryChunk.h>
 
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+
 namespace ChilliSource
 {
     namespace Core
     {
         //----------------------------------------------------------------
         //----------------------------------------------------------------
-        CSBinaryChunk::CSBinaryChunk(std::unique_ptr<u8[]> in_dataBlob, u32 in_dataSize)
-        : m_dataBlob(std::move(in_dataBlob)), m_dataSize(in_dataSize)
+        CSBinaryChunk::CSBinaryChunk(const MemoryMappedFileCSPtr& in_file, u32 in_offset, u32 in_dataSize)
+        : m_file(in_file), m_dataSize(in_dataSize)
         {
+            CS_ASSERT(m_file != nullptr, "Cannot create chunk from null file.");
+            CS_ASSERT(u64(in_offset) + u64(in_dataSize) <= m_file->GetSize(), "Chunk extends beyond the end of the file.");
+            
+            m_data = m_file->GetData() + in_offset;
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
@@ -48,7 +54,7 @@ namespace ChilliSource
         //----------------------------------------------------------------
         const u8* CSBinaryChunk::GetData() const
         {
-            return m_dataBlob.get();
+            return m_data;
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
@@ -65,17 +71,35 @@ namespace ChilliSource
                 CS_LOG_FATAL("Trying to read beyond the end of a Binary Chunk.");
             }
             
-            u8* output = m_dataBlob.get() + m_readPosition;
+            const u8* output = m_data + m_readPosition;
             m_readPosition += in_dataSize;
             return output;
         }
         //----------------------------------------------------------------
         //----------------------------------------------------------------
+        std::string CSBinaryChunk::ReadString()
+        {
+            const u32 length = Read<u32>();
+            if (length == 0)
+            {
+                return std::string();
+            }
+            
+            const u8* data = Read(length);
+            return std::string(reinterpret_cast<const char*>(data), length);
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
         std::unique_ptr<u8[]> CSBinaryChunk::ClaimData()
         {
+            std::unique_ptr<u8[]> output(new u8[m_dataSize]);
+            std::memcpy(output.get(), m_data, m_dataSize);
+            
+            m_file.reset();
+            m_data = nullptr;
             m_dataSize = 0;
             m_readPosition = 0;
-            return std::move(m_dataBlob);
+            return output;
         }
     }
 }
\ No newline at end of file
@@ -31,14 +31,17 @@
 
 #include <ChilliSource/ChilliSource.h>
 
+#include <cstring>
+
 namespace ChilliSource
 {
     namespace Core
     {
         //----------------------------------------------------------------------
         /// A single chunk within a Chilli Source binary "Chunked" file. The
-        /// contents of the chunk are loaded directly into memory on creation
-        /// meaning each call to Read() avoids further disc reads.
+        /// chunk is a view into the memory mapped file, meaning the
+        /// contents are read in place rather than copied. The chunk keeps
+        /// the memory mapped file alive for as long as it exists.
         ///
         /// CSBinaryChunk is thread agnostic and can be used and accessed on any
         /// thread but it is not thread-safe, so a single instance should not
@@ -97,31 +100,48 @@ namespace ChilliSource
             //----------------------------------------------------------------
             const u8* Read(u32 in_dataSize);
             //----------------------------------------------------------------
+            /// Reads a string from the chunk at the current read position.
+            /// The string should be stored as a 32-bit length followed by
+            /// the characters, as written by CSBinaryOutputStream.
+            ///
+            /// If this attempts to read beyond the end of the chunk a fatal
+            /// error will be logged.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The string.
+            //----------------------------------------------------------------
+            std::string ReadString();
+            //----------------------------------------------------------------
             /// Claims the chunks memory. This is used in cases where the
-            /// entire contents of the chunk is desired without having to
-            /// copy the data, for example image data. After this has been
-            /// called the chunk can no longer be used.
+            /// entire contents of the chunk is required in a buffer which
+            /// the caller owns, for example image data. As the chunk is a
+            /// view into read-only mapped memory this requires a copy;
+            /// where possible GetData() should be used instead. After this
+            /// has been called the chunk can no longer be used.
             ///
             /// @author Ian Copland
             ///
-            /// @return The size of the chunk in bytes.
+            /// @return A buffer containing the contents of the chunk.
             //----------------------------------------------------------------
             std::unique_ptr<u8[]> ClaimData();
         private:
             friend class CSBinaryInputStream;
             //----------------------------------------------------------------
-            /// Constructor. Creates the chunk with a pointer to the chunk
-            /// data blob. This is private to ensure only the CS Binary Input
-            /// Stream can instantiate it.
+            /// Constructor. Creates the chunk as a view into the given memory
+            /// mapped file. This is private to ensure only the CS Binary
+            /// Input Stream can instantiate it.
             ///
             /// @author Ian Copland
             ///
-            /// @param The chunk data blob.
+            /// @param The memory mapped file.
+            /// @param The offset of the chunk within the file.
             /// @param The chunk data size.
             //----------------------------------------------------------------
-            CSBinaryChunk(std::unique_ptr<u8[]> in_dataBlob, u32 in_dataSize);
+            CSBinaryChunk(const MemoryMappedFileCSPtr& in_file, u32 in_offset, u32 in_dataSize);
             
-            std::unique_ptr<u8[]> m_dataBlob;
+            MemoryMappedFileCSPtr m_file;
+            const u8* m_data = nullptr;
             u32 m_dataSize = 0;
             u32 m_readPosition = 0;
         };
@@ -129,8 +149,9 @@ namespace ChilliSource
         //----------------------------------------------------------------
         template <typename TType> TType CSBinaryChunk::Read()
         {
-            const u8* data = Read(sizeof(TType));
-            const TType output = *reinterpret_cast<const TType*>(data);
+            //chunks are not guaranteed to be aligned within the file, so copy rather than cast.
+            TType output;
+            std::memcpy(&output, Read(sizeof(TType)), sizeof(TType));
             return output;
         }
     }
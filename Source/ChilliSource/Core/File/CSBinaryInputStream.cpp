@@ -31,6 +31,8 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/File/CSBinaryChunk.h>
 #include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+#include <ChilliSource/Core/File/MemoryReader.h>
 
 namespace ChilliSource
 {
@@ -38,54 +40,39 @@ namespace ChilliSource
     {
         namespace
         {
+            const u32 k_headerSize = 20;
+            const u32 k_chunkEntrySize = 12;
+            
             //--------------------------------------------------------------
-            /// Reads the Chilli Source "Chunked" binary file header.
-            ///
-            /// @param Ian Copland
-            ///
-            /// @param The file stream.
-            /// @param [Out] The file format Id.
-            /// @param [Out] The file format version.
-            /// @param [Out] The number of entries in the chunk table.
-            ///
-            /// @return Whether reading the header was successful or not.
             //--------------------------------------------------------------
-            bool ReadHeader(FileStream* in_fileStream, const std::string& in_filePath, u32& out_fileFormatId, u32& out_fileFormatVersion, u32& out_numChunkTableEntries)
+            bool ReadHeader(MemoryReader& in_reader, const std::string& in_filePath, u32& out_fileFormatId, u32& out_fileFormatVersion, u32& out_numChunkTableEntries)
             {
-                CS_ASSERT(in_fileStream != nullptr, "File stream cannot be null.");
-                
-                //read the header data
-                const u32 k_headerSize = 20;
-                std::unique_ptr<u8[]> headerData(new u8[k_headerSize]);
-                in_fileStream->Read(reinterpret_cast<s8*>(headerData.get()), k_headerSize);
+                if (in_reader.GetRemainingSize() < k_headerSize)
+                {
+                    CS_LOG_ERROR("Chilli Source file is too small to contain a header: " + in_filePath);
+                    return false;
+                }
                 
                 //test file id.
-                if (headerData[0] != 'C' || headerData[1] != 'S' || headerData[2] != 'C' || headerData[3] != 'S')
+                const u8* fileId = in_reader.Read(4);
+                if (fileId[0] != 'C' || fileId[1] != 'S' || fileId[2] != 'C' || fileId[3] != 'S')
                 {
                     CS_LOG_ERROR("Invalid Chilli Source file identifier in file: " + in_filePath);
                     return false;
                 }
                 
                 //test file endianness.
-                const u32 k_endiannessCheckFlagOffset = 4;
-                u32 endiannessCheckFlag = *reinterpret_cast<const u32*>(headerData.get() + k_endiannessCheckFlagOffset);
+                u32 endiannessCheckFlag = in_reader.Read<u32>();
                 if (endiannessCheckFlag != 9999)
                 {
                     CS_LOG_ERROR("File is big endian, only little endian is currently supported: " + in_filePath);
                     return false;
                 }
                 
-                //read the file type
-                const u32 k_fileFormatIdOffset = 8;
-                out_fileFormatId = *reinterpret_cast<const u32*>(headerData.get() + k_fileFormatIdOffset);
-                
-                //read the file version
-                const u32 k_fileFormatVersionOffset = 12;
-                out_fileFormatVersion = *reinterpret_cast<const u32*>(headerData.get() + k_fileFormatVersionOffset);
-                
-                //read the number of chunk table entries
-                const u32 k_numChunkTableEntriesOffset = 16;
-                out_numChunkTableEntries = *reinterpret_cast<const u32*>(headerData.get() + k_numChunkTableEntriesOffset);
+                //read the file type, version and the number of chunk table entries.
+                out_fileFormatId = in_reader.Read<u32>();
+                out_fileFormatVersion = in_reader.Read<u32>();
+                out_numChunkTableEntries = in_reader.Read<u32>();
                 
                 return true;
             }
@@ -94,22 +81,23 @@ namespace ChilliSource
         //--------------------------------------------------------------
         //--------------------------------------------------------------
         CSBinaryInputStream::CSBinaryInputStream(StorageLocation in_storageLocation, const std::string& in_filePath)
+            : m_filePath(in_filePath)
         {
             FileSystem* fileSystem = Application::Get()->GetFileSystem();
             CS_ASSERT(fileSystem != nullptr, "CSBinaryInputStream missing required system: FileSystem.");
             
-            m_fileStream = fileSystem->CreateFileStream(in_storageLocation, in_filePath, FileMode::k_readBinary);
-            if (m_fileStream != nullptr)
+            m_file = fileSystem->CreateMemoryMappedFile(in_storageLocation, in_filePath);
+            if (m_file != nullptr)
             {
+                MemoryReader reader(m_file->GetData(), m_file->GetSize());
+                
                 u32 numChunkTableEntries;
-                if (ReadHeader(m_fileStream.get(), in_filePath, m_fileFormatId, m_fileFormatVersion, numChunkTableEntries) == false)
+                if (ReadHeader(reader, in_filePath, m_fileFormatId, m_fileFormatVersion, numChunkTableEntries) == false || ReadChunkTable(reader, numChunkTableEntries) == false)
                 {
-                    m_fileStream.reset();
+                    m_file.reset();
                     return;
                 }
                 
-                ReadChunkTable(numChunkTableEntries);
-                
                 m_isValid = true;
             }
         }
@@ -140,49 +128,41 @@ namespace ChilliSource
             auto chunkInfoIt = m_chunkInfoMap.find(in_chunkId);
             if (chunkInfoIt != m_chunkInfoMap.end())
             {
-                m_fileStream->SeekG(chunkInfoIt->second.m_offset, SeekDir::k_beginning);
-                CS_ASSERT(m_fileStream->TellG() == chunkInfoIt->second.m_offset, "Seek failed.");
-                
-                std::unique_ptr<u8[]> chunkData(new u8[chunkInfoIt->second.m_size]);
-                m_fileStream->Read(reinterpret_cast<s8*>(chunkData.get()), chunkInfoIt->second.m_size);
-                
-                return CSBinaryChunkUPtr(new CSBinaryChunk(std::move(chunkData), chunkInfoIt->second.m_size));
+                return CSBinaryChunkUPtr(new CSBinaryChunk(m_file, chunkInfoIt->second.m_offset, chunkInfoIt->second.m_size));
             }
             
             return nullptr;
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
-        void CSBinaryInputStream::ReadChunkTable(u32 in_numEntries)
+        bool CSBinaryInputStream::ReadChunkTable(MemoryReader& in_reader, u32 in_numEntries)
         {
-            const u32 k_chunkEntrySize = 12;
-            
-            //read the chunk table
-            const u32 chunkTableDataSize = k_chunkEntrySize * in_numEntries;
-            std::unique_ptr<u8[]> chunkTableData(new u8[chunkTableDataSize]);
-            m_fileStream->Read(reinterpret_cast<s8*>(chunkTableData.get()), chunkTableDataSize);
+            if (in_reader.GetRemainingSize() < u64(k_chunkEntrySize) * u64(in_numEntries))
+            {
+                CS_LOG_ERROR("Chunk table extends beyond the end of the file: " + m_filePath);
+                return false;
+            }
             
-            //iterate over the chunks
             for (u32 i = 0; i < in_numEntries; ++i)
             {
-                const u32 chunkOffset = i * k_chunkEntrySize;
-                
                 //get the chunk identifier
                 const u32 k_chunkIdSize = 4;
-                std::string chunkId(reinterpret_cast<const s8*>(chunkTableData.get() + chunkOffset), k_chunkIdSize);
+                std::string chunkId(reinterpret_cast<const s8*>(in_reader.Read(k_chunkIdSize)), k_chunkIdSize);
                 
                 ChunkInfo info;
+                info.m_offset = in_reader.Read<u32>();
+                info.m_size = in_reader.Read<u32>();
                 
-                //get the chunk offset.
-                const u32 k_offsetOffset = 4;
-                info.m_offset = *reinterpret_cast<const u32*>(chunkTableData.get() + chunkOffset + k_offsetOffset);
-                
-                //get the chunk size.
-                const u32 k_sizeOffset = 8;
-                info.m_size = *reinterpret_cast<const u32*>(chunkTableData.get() + chunkOffset + k_sizeOffset);
+                if (u64(info.m_offset) + u64(info.m_size) > in_reader.GetSize())
+                {
+                    CS_LOG_ERROR("Chunk '" + chunkId + "' extends beyond the end of the file: " + m_filePath);
+                    return false;
+                }
                 
                 m_chunkInfoMap.emplace(chunkId, info);
             }
+            
+            return true;
         }
     }
 }
@@ -39,9 +39,10 @@ namespace ChilliSource
     {
         //----------------------------------------------------------------------
         /// A file input stream for reading files that use Chilli Source's
-        /// "Chunked" binary file format. The input stream wraps around a
-        /// standard file stream and provides an easy and efficient API for
-        /// loading files.
+        /// "Chunked" binary file format. The input stream memory maps the
+        /// file and provides an easy and efficient API for loading files.
+        /// Chunks are views into the mapped file so reading a chunk does not
+        /// copy its contents.
         ///
         /// The Chilli Source "Chunked" file format has 3 sections. The header,
         /// the chunk table and the chunk data. The header contains basic file
@@ -122,10 +123,11 @@ namespace ChilliSource
             //--------------------------------------------------------------
             u32 GetFileFormatVersion() const;
             //--------------------------------------------------------------
-            /// Reads the contents of the requested chunk into memory and
-            /// returns it as a Binary Chunk to allow efficient and easy access
-            /// to the chunks contents. If the file doesn't contain the
-            /// requested chunk null will be returned.
+            /// Returns the requested chunk as a Binary Chunk to allow
+            /// efficient and easy access to the chunks contents. The chunk
+            /// shares ownership of the mapped file, so it can safely outlive
+            /// the stream. If the file doesn't contain the requested chunk
+            /// null will be returned.
             ///
             /// @author Ian Copland
             ///
@@ -152,11 +154,15 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
             ///
+            /// @param The reader, positioned at the start of the chunk table.
             /// @param The number of entries in the chunk table.
+            ///
+            /// @return Whether or not the chunk table was valid.
             //--------------------------------------------------------------
-            void ReadChunkTable(u32 in_numEntries);
+            bool ReadChunkTable(MemoryReader& in_reader, u32 in_numEntries);
             
-            FileStreamUPtr m_fileStream;
+            MemoryMappedFileSPtr m_file;
+            std::string m_filePath;
             bool m_isValid = false;
             u32 m_fileFormatId = 0;
             u32 m_fileFormatVersion = 0;
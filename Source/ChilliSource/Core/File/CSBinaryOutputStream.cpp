@@ -0,0 +1,174 @@
+//
+//  CSBinaryOutputStream.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/File/CSBinaryOutputStream.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const u32 k_headerSize = 20;
+            const u32 k_chunkEntrySize = 12;
+            const u32 k_chunkIdSize = 4;
+            const u32 k_endiannessCheckFlag = 9999;
+            
+            //--------------------------------------------------------------
+            /// Appends a 32-bit unsigned integer to the given buffer.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The value.
+            /// @param [Out] The buffer.
+            //--------------------------------------------------------------
+            void AppendU32(u32 in_value, std::vector<u8>& out_buffer)
+            {
+                const u8* data = reinterpret_cast<const u8*>(&in_value);
+                out_buffer.insert(out_buffer.end(), data, data + sizeof(u32));
+            }
+        }
+        
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        CSBinaryOutputStream::CSBinaryOutputStream(StorageLocation in_storageLocation, const std::string& in_filePath, u32 in_fileFormatId, u32 in_fileFormatVersion)
+            : m_fileFormatId(in_fileFormatId), m_fileFormatVersion(in_fileFormatVersion)
+        {
+            FileSystem* fileSystem = Application::Get()->GetFileSystem();
+            CS_ASSERT(fileSystem != nullptr, "CSBinaryOutputStream missing required system: FileSystem.");
+            
+            m_fileStream = fileSystem->CreateFileStream(in_storageLocation, in_filePath, FileMode::k_writeBinary);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool CSBinaryOutputStream::IsValid() const
+        {
+            return (m_fileStream != nullptr);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void CSBinaryOutputStream::BeginChunk(const std::string& in_chunkId)
+        {
+            CS_ASSERT(IsValid() == true, "Cannot write to an invalid output stream.");
+            CS_ASSERT(m_isChunkOpen == false, "Cannot begin a chunk while another is open.");
+            CS_ASSERT(in_chunkId.size() == k_chunkIdSize, "Chunk Ids must be 4 characters.");
+            
+            Chunk chunk;
+            chunk.m_id = in_chunkId;
+            m_chunks.push_back(std::move(chunk));
+            m_isChunkOpen = true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void CSBinaryOutputStream::Write(const u8* in_data, u32 in_dataSize)
+        {
+            CS_ASSERT(m_isChunkOpen == true, "Cannot write outside of a chunk.");
+            
+            std::vector<u8>& chunkData = m_chunks.back().m_data;
+            chunkData.insert(chunkData.end(), in_data, in_data + in_dataSize);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void CSBinaryOutputStream::WriteString(const std::string& in_string)
+        {
+            Write(static_cast<u32>(in_string.size()));
+            Write(reinterpret_cast<const u8*>(in_string.data()), static_cast<u32>(in_string.size()));
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void CSBinaryOutputStream::EndChunk()
+        {
+            CS_ASSERT(m_isChunkOpen == true, "Cannot end a chunk when none is open.");
+            
+            m_isChunkOpen = false;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool CSBinaryOutputStream::Close()
+        {
+            if (m_fileStream == nullptr)
+            {
+                return false;
+            }
+            
+            CS_ASSERT(m_isChunkOpen == false, "Cannot close the stream while a chunk is open.");
+            
+            std::vector<u8> headerAndTable;
+            headerAndTable.reserve(k_headerSize + k_chunkEntrySize * m_chunks.size());
+            
+            //header
+            headerAndTable.push_back('C');
+            headerAndTable.push_back('S');
+            headerAndTable.push_back('C');
+            headerAndTable.push_back('S');
+            AppendU32(k_endiannessCheckFlag, headerAndTable);
+            AppendU32(m_fileFormatId, headerAndTable);
+            AppendU32(m_fileFormatVersion, headerAndTable);
+            AppendU32(static_cast<u32>(m_chunks.size()), headerAndTable);
+            
+            //chunk table
+            u32 offset = k_headerSize + k_chunkEntrySize * static_cast<u32>(m_chunks.size());
+            for (const auto& chunk : m_chunks)
+            {
+                headerAndTable.insert(headerAndTable.end(), chunk.m_id.begin(), chunk.m_id.end());
+                AppendU32(offset, headerAndTable);
+                AppendU32(static_cast<u32>(chunk.m_data.size()), headerAndTable);
+                
+                offset += static_cast<u32>(chunk.m_data.size());
+            }
+            
+            m_fileStream->Write(reinterpret_cast<const s8*>(headerAndTable.data()), static_cast<s32>(headerAndTable.size()));
+            
+            //chunk data
+            for (const auto& chunk : m_chunks)
+            {
+                if (chunk.m_data.empty() == false)
+                {
+                    m_fileStream->Write(reinterpret_cast<const s8*>(chunk.m_data.data()), static_cast<s32>(chunk.m_data.size()));
+                }
+            }
+            
+            m_fileStream->Flush();
+            const bool succeeded = m_fileStream->IsValid();
+            
+            m_fileStream.reset();
+            m_chunks.clear();
+            
+            return succeeded;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        CSBinaryOutputStream::~CSBinaryOutputStream()
+        {
+            Close();
+        }
+    }
+}
@@ -0,0 +1,168 @@
+//
+//  CSBinaryOutputStream.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_FILE_CSBINARYOUTPUTSTREAM_H_
+#define _CHILLISOURCE_CORE_FILE_CSBINARYOUTPUTSTREAM_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <type_traits>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //----------------------------------------------------------------------
+        /// A file output stream for writing files that use Chilli Source's
+        /// "Chunked" binary file format. See CSBinaryInputStream for a
+        /// description of the format.
+        ///
+        /// Chunks are built up in memory using BeginChunk(), the Write()
+        /// methods and EndChunk(), and the file is written in full when the
+        /// stream is closed. As with the input stream, only little endian
+        /// output is supported.
+        ///
+        /// @author Carlos Artesano
+        //----------------------------------------------------------------------
+        class CSBinaryOutputStream final
+        {
+        public:
+            CS_DECLARE_NOCOPY(CSBinaryOutputStream);
+            //--------------------------------------------------------------
+            /// Constructor. Creates a new binary stream to the given file
+            /// path. Before use the IsValid() flag should be checked to
+            /// ensure that the stream has successfully be opened.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The storage location of the file.
+            /// @param The file path.
+            /// @param The CS file format Id.
+            /// @param The file format version number.
+            //--------------------------------------------------------------
+            CSBinaryOutputStream(StorageLocation in_storageLocation, const std::string& in_filePath, u32 in_fileFormatId, u32 in_fileFormatVersion);
+            //--------------------------------------------------------------
+            /// Returns whether or not the stream has successfully been
+            /// created and is ready for use.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return Whether or not the stream was successfully created.
+            //--------------------------------------------------------------
+            bool IsValid() const;
+            //--------------------------------------------------------------
+            /// Begins a new chunk. Any subsequent writes will be added to
+            /// this chunk until EndChunk() is called. Chunks cannot be
+            /// nested.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The 4 character unique identifier for the chunk.
+            //--------------------------------------------------------------
+            void BeginChunk(const std::string& in_chunkId);
+            //--------------------------------------------------------------
+            /// Writes a value to the current chunk.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The value.
+            //--------------------------------------------------------------
+            template <typename TType> void Write(const TType& in_value);
+            //--------------------------------------------------------------
+            /// Writes the given data to the current chunk.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The data.
+            /// @param The size of the data in bytes.
+            //--------------------------------------------------------------
+            void Write(const u8* in_data, u32 in_dataSize);
+            //--------------------------------------------------------------
+            /// Writes a string to the current chunk. This is stored as a
+            /// 32-bit length followed by the characters, without a null
+            /// terminator.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The string.
+            //--------------------------------------------------------------
+            void WriteString(const std::string& in_string);
+            //--------------------------------------------------------------
+            /// Ends the current chunk.
+            ///
+            /// @author Carlos Artesano
+            //--------------------------------------------------------------
+            void EndChunk();
+            //--------------------------------------------------------------
+            /// Writes the header, chunk table and chunk data to file and
+            /// closes the stream. This is called automatically on
+            /// destruction if it hasn't been already.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return Whether or not the file was successfully written.
+            //--------------------------------------------------------------
+            bool Close();
+            //--------------------------------------------------------------
+            /// Destructor
+            ///
+            /// @author Carlos Artesano
+            //--------------------------------------------------------------
+            ~CSBinaryOutputStream();
+            
+        private:
+            //--------------------------------------------------------------
+            /// A single chunk which is yet to be written.
+            ///
+            /// @author Carlos Artesano
+            //--------------------------------------------------------------
+            struct Chunk
+            {
+                std::string m_id;
+                std::vector<u8> m_data;
+            };
+            
+            FileStreamUPtr m_fileStream;
+            u32 m_fileFormatId = 0;
+            u32 m_fileFormatVersion = 0;
+            std::vector<Chunk> m_chunks;
+            bool m_isChunkOpen = false;
+        };
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        template <typename TType> void CSBinaryOutputStream::Write(const TType& in_value)
+        {
+            static_assert(std::is_arithmetic<TType>::value, "Only arithmetic types can be written directly.");
+            
+            Write(reinterpret_cast<const u8*>(&in_value), sizeof(TType));
+        }
+    }
+}
+
+#endif
@@ -41,6 +41,12 @@ namespace ChilliSource
 {
     namespace Core
     {
+        namespace
+        {
+            //The size of the chunks a file is read in while calculating a checksum. This is
+            //large enough that the hash is not dominated by the overhead of each read.
+            const u32 k_checksumChunkSize = 64 * 1024;
+        }
 		//------------------------------------------------------------------------------
 		//------------------------------------------------------------------------------
 		FileStream::FileStream(const std::string& in_filePath, FileMode in_fileMode)
@@ -69,31 +75,30 @@ namespace ChilliSource
         {
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
-            s32 dwCurrentPos = TellG();
+            s64 dwCurrentPos = TellG();
             
             // Get file size
             SeekG(0, SeekDir::k_end);
-            u32 udwLength = TellG();
+            u64 udwLength = static_cast<u64>(TellG());
             
             SeekG(0);
             
-            const u32 kudwChunkSize = 256;
-            s8 byData[kudwChunkSize];
+            std::unique_ptr<s8[]> byData(new s8[k_checksumChunkSize]);
             
             MD5 Hash;
             
-            while(udwLength >= kudwChunkSize)
+            while(udwLength >= k_checksumChunkSize)
             {
-                Read(byData, kudwChunkSize);
-                Hash.update(byData, kudwChunkSize);
-                udwLength -= kudwChunkSize;
+                Read(byData.get(), k_checksumChunkSize);
+                Hash.update(byData.get(), k_checksumChunkSize);
+                udwLength -= k_checksumChunkSize;
             }
             
             // Last chunk
             if(udwLength > 0)
             {
-                Read(byData, udwLength);
-                Hash.update(byData, udwLength);
+                Read(byData.get(), udwLength);
+                Hash.update(byData.get(), static_cast<u32>(udwLength));
             }
             
             SeekG(dwCurrentPos);
@@ -108,33 +113,32 @@ namespace ChilliSource
         {
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
-            s32 dwCurrentPos = TellG();
+            s64 dwCurrentPos = TellG();
             
             // Get file size
             SeekG(0, SeekDir::k_end);
-            u32 udwLength = TellG();
+            u64 udwLength = static_cast<u64>(TellG());
             
             SeekG(0);
             
-            const u32 kudwChunkSize = 256;
-            s8 byData[kudwChunkSize];
+            std::unique_ptr<s8[]> byData(new s8[k_checksumChunkSize]);
             
             CSHA1 Hash;
             Hash.Reset();
             
-            while(udwLength >= kudwChunkSize)
+            while(udwLength >= k_checksumChunkSize)
             {
-                Read(byData, kudwChunkSize);
+                Read(byData.get(), k_checksumChunkSize);
                 
-                Hash.Update(reinterpret_cast<u8*>(byData), kudwChunkSize);
-                udwLength -= kudwChunkSize;
+                Hash.Update(reinterpret_cast<u8*>(byData.get()), k_checksumChunkSize);
+                udwLength -= k_checksumChunkSize;
             }
             
             // Last chunk
             if(udwLength > 0)
             {
-                Read(byData, udwLength);
-                Hash.Update(reinterpret_cast<u8*>(byData), udwLength);
+                Read(byData.get(), udwLength);
+                Hash.Update(reinterpret_cast<u8*>(byData.get()), static_cast<u32>(udwLength));
             }
             
             SeekG(dwCurrentPos);
@@ -185,7 +189,7 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		/// Get
 		//--------------------------------------------------------------------------------------------------
-		void FileStream::Get(s8 * outpbyString, s32 indwStreamSize)
+		void FileStream::Get(s8 * outpbyString, s64 indwStreamSize)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -194,7 +198,7 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		/// Get
 		//--------------------------------------------------------------------------------------------------
-		void FileStream::Get(s8 * outpbyString, s32 indwStreamSize, s8 inbyDelim)
+		void FileStream::Get(s8 * outpbyString, s64 indwStreamSize, s8 inbyDelim)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -233,7 +237,7 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		/// Get Line
 		//--------------------------------------------------------------------------------------------------
-		void FileStream::GetLine(s8 * outpbyString, s32 indwStreamSize)
+		void FileStream::GetLine(s8 * outpbyString, s64 indwStreamSize)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -242,7 +246,7 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		/// Get Line
 		//--------------------------------------------------------------------------------------------------
-		void FileStream::GetLine(s8 * outpbyString, s32 indwStreamSize, s8 inbyDelim)
+		void FileStream::GetLine(s8 * outpbyString, s64 indwStreamSize, s8 inbyDelim)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -251,7 +255,7 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		/// Ignore
 		//--------------------------------------------------------------------------------------------------
-		void FileStream::Ignore(s32 indwStreamSize, s8 inbyDelim)
+		void FileStream::Ignore(s64 indwStreamSize, s8 inbyDelim)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -269,7 +273,7 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		/// Read
 		//--------------------------------------------------------------------------------------------------
-		void FileStream::Read(s8* inpbyBuffer, s32 indwStreamSize)
+		void FileStream::Read(s8* inpbyBuffer, s64 indwStreamSize)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -296,16 +300,16 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		/// TellG
 		//--------------------------------------------------------------------------------------------------
-		s32 FileStream::TellG()
+		s64 FileStream::TellG()
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
-			return (s32)mFileStream.tellg();
+			return (s64)mFileStream.tellg();
 		}
 		//--------------------------------------------------------------------------------------------------
 		/// SeekG
 		//--------------------------------------------------------------------------------------------------
-		void FileStream::SeekG(s32 indwPosition)
+		void FileStream::SeekG(s64 indwPosition)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -314,7 +318,7 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		/// SeekG
 		//--------------------------------------------------------------------------------------------------
-		void FileStream::SeekG(s32 indwPosition, Core::SeekDir ineDir)
+		void FileStream::SeekG(s64 indwPosition, Core::SeekDir ineDir)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -355,7 +359,7 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		/// Write
 		//--------------------------------------------------------------------------------------------------
-		void FileStream::Write(const s8* inpbyChar, s32 indwStreamSize)
+		void FileStream::Write(const s8* inpbyChar, s64 indwStreamSize)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -373,16 +377,16 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		/// TellP
 		//--------------------------------------------------------------------------------------------------
-		s32 FileStream::TellP()
+		s64 FileStream::TellP()
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
-			return (s32)mFileStream.tellp();
+			return (s64)mFileStream.tellp();
 		}
 		//--------------------------------------------------------------------------------------------------
 		/// SeekP
 		//--------------------------------------------------------------------------------------------------
-		void FileStream::SeekP(s32 indwPosition)
+		void FileStream::SeekP(s64 indwPosition)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -391,7 +395,7 @@ namespace ChilliSource
 		//--------------------------------------------------------------------------------------------------
 		/// SeekP
 		//--------------------------------------------------------------------------------------------------
-		void FileStream::SeekP(s32 indwPosition, Core::SeekDir ineDir)
+		void FileStream::SeekP(s64 indwPosition, Core::SeekDir ineDir)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
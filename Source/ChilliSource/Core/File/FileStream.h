@@ -133,7 +133,7 @@ namespace ChilliSource
 			/// @param buffer for the output string.
 			/// @param The amount of bytes to read into the buffer.
 			//--------------------------------------------------------------------------------------------------
-			virtual void Get(s8 * outpbyString, s32 indwStreamSize);
+			virtual void Get(s8 * outpbyString, s64 indwStreamSize);
 			//--------------------------------------------------------------------------------------------------
 			/// Get
 			///
@@ -144,7 +144,7 @@ namespace ChilliSource
 			/// @param The amount of bytes to read into the buffer.
 			/// @param The delimiting character.
 			//--------------------------------------------------------------------------------------------------
-			virtual void Get(s8 * outpbyString, s32 indwStreamSize, s8 inbyDelim);
+			virtual void Get(s8 * outpbyString, s64 indwStreamSize, s8 inbyDelim);
 			//--------------------------------------------------------------------------------------------------
 			/// Get Line
 			///
@@ -177,7 +177,7 @@ namespace ChilliSource
 			/// @param buffer for the output string.
 			/// @param The amount of bytes to read into the buffer.
 			//--------------------------------------------------------------------------------------------------
-			virtual void GetLine(s8 * outpbyString, s32 indwStreamSize);
+			virtual void GetLine(s8 * outpbyString, s64 indwStreamSize);
 			//--------------------------------------------------------------------------------------------------
 			/// Get Line
 			///
@@ -188,7 +188,7 @@ namespace ChilliSource
 			/// @param The amount of bytes to read into the buffer.
 			/// @param The delimiting character.
 			//--------------------------------------------------------------------------------------------------
-			virtual void GetLine(s8 * outpbyString, s32 indwStreamSize, s8 inbyDelim);
+			virtual void GetLine(s8 * outpbyString, s64 indwStreamSize, s8 inbyDelim);
 			//--------------------------------------------------------------------------------------------------
 			/// Ignore
 			///
@@ -198,7 +198,7 @@ namespace ChilliSource
 			/// @param The amount of bytes to read into the buffer.
 			/// @param The delimiting character.
 			//--------------------------------------------------------------------------------------------------
-			virtual void Ignore(s32 indwStreamSize = 1, s8 inbyDelim = EOF);
+			virtual void Ignore(s64 indwStreamSize = 1, s8 inbyDelim = EOF);
 			//--------------------------------------------------------------------------------------------------
 			/// Peek
 			///
@@ -216,7 +216,7 @@ namespace ChilliSource
 			/// @param The buffer.
 			/// @param the stream size.
 			//--------------------------------------------------------------------------------------------------
-			virtual void Read(s8* inpbyBuffer, s32 indwStreamSize);
+			virtual void Read(s8* inpbyBuffer, s64 indwStreamSize);
 			//--------------------------------------------------------------------------------------------------
 			/// Put Back
 			///
@@ -236,7 +236,7 @@ namespace ChilliSource
 			///
 			/// @return the absolute position of the get pointer.
 			//--------------------------------------------------------------------------------------------------
-			virtual s32 TellG();
+			virtual s64 TellG();
 			//--------------------------------------------------------------------------------------------------
 			/// SeekG
 			///
@@ -244,7 +244,7 @@ namespace ChilliSource
 			///
 			/// @param the new position.
 			//--------------------------------------------------------------------------------------------------
-			virtual void SeekG(s32 indwPosition);
+			virtual void SeekG(s64 indwPosition);
 			//--------------------------------------------------------------------------------------------------
 			/// SeekG
 			///
@@ -253,7 +253,7 @@ namespace ChilliSource
 			/// @param the new position.
 			/// @param the direction from which to seek.
 			//--------------------------------------------------------------------------------------------------
-			virtual void SeekG(s32 indwPosition, SeekDir ineDir);
+			virtual void SeekG(s64 indwPosition, SeekDir ineDir);
 			//--------------------------------------------------------------------------------------------------
 			/// Sync
 			///
@@ -276,7 +276,7 @@ namespace ChilliSource
 			/// @param the data buffer.
 			/// @param the stream size.
 			//--------------------------------------------------------------------------------------------------
-			virtual void Write(const s8* inpbyChar, s32 indwStreamSize);
+			virtual void Write(const s8* inpbyChar, s64 indwStreamSize);
 			//--------------------------------------------------------------------------------------------------
 			/// Write
 			///
@@ -294,7 +294,7 @@ namespace ChilliSource
 			/// @param the stream size.
             /// @param Private AES key
 			//--------------------------------------------------------------------------------------------------
-            void WriteEncrypted(s8* inpbyChar, s32 indwStreamSize, const std::string& instrPrivateKey);
+            void WriteEncrypted(s8* inpbyChar, s64 indwStreamSize, const std::string& instrPrivateKey);
 			//--------------------------------------------------------------------------------------------------
 			/// Write Encrypted
 			///
@@ -309,7 +309,7 @@ namespace ChilliSource
 			///
 			/// @return the currently position of the put pointer
 			//--------------------------------------------------------------------------------------------------
-			virtual s32 TellP();
+			virtual s64 TellP();
 			//--------------------------------------------------------------------------------------------------
 			/// SeekP
 			///
@@ -317,7 +317,7 @@ namespace ChilliSource
 			///
 			/// @param the new position.
 			//--------------------------------------------------------------------------------------------------
-			virtual void SeekP(s32 indwPosition);
+			virtual void SeekP(s64 indwPosition);
 			//--------------------------------------------------------------------------------------------------
 			/// SeekP
 			///
@@ -326,7 +326,7 @@ namespace ChilliSource
 			/// @param the new position.
 			/// @param the direction from which to seek.
 			//--------------------------------------------------------------------------------------------------
-			virtual void SeekP(s32 indwPosition, SeekDir ineDir);
+			virtual void SeekP(s64 indwPosition, SeekDir ineDir);
 			//--------------------------------------------------------------------------------------------------
 			/// Flush
 			///
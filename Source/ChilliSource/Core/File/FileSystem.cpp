@@ -30,6 +30,8 @@
 
 #include <ChilliSource/Core/Cryptographic/HashMD5.h>
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+#include <ChilliSource/Core/File/PackedArchive.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 
 #ifdef CS_TARGETPLATFORM_IOS
@@ -117,12 +119,42 @@ namespace ChilliSource
                 return false;
             }
             
-            fileStream->Write(in_data, (s32)in_dataSize);
+            fileStream->Write(in_data, (s64)in_dataSize);
             
             return true;
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
+        MemoryMappedFileUPtr FileSystem::CreateMemoryMappedFile(StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            FileStreamUPtr fileStream = CreateFileStream(in_storageLocation, in_filePath, FileMode::k_readBinary);
+            if (fileStream == nullptr)
+            {
+                return nullptr;
+            }
+            
+            fileStream->SeekG(0, SeekDir::k_end);
+            const s64 length = fileStream->TellG();
+            fileStream->SeekG(0, SeekDir::k_beginning);
+            
+            if (length < 0)
+            {
+                return nullptr;
+            }
+            
+            std::unique_ptr<u8[]> data(new u8[static_cast<size_t>(length)]);
+            fileStream->Read(reinterpret_cast<s8*>(data.get()), length);
+            
+            return MemoryMappedFile::Create(std::move(data), static_cast<u64>(length));
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::TryGetFileInfo(StorageLocation in_storageLocation, const std::string& in_filePath, FileInfo& out_fileInfo) const
+        {
+            return false;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
         std::vector<std::string> FileSystem::GetFilePathsWithExtension(StorageLocation in_storageLocation, const std::string& in_directoryPath,  bool in_recursive, const std::string& in_extension) const
         {
             std::vector<std::string> filePaths = GetFilePaths(in_storageLocation, in_directoryPath, in_recursive);
@@ -168,6 +200,52 @@ namespace ChilliSource
         }
         //--------------------------------------------------------------
         //--------------------------------------------------------------
+        bool FileSystem::MountPackedArchive(StorageLocation in_storageLocation, const std::string& in_archiveFilePath)
+        {
+            CS_ASSERT(in_storageLocation == StorageLocation::k_package || in_storageLocation == StorageLocation::k_chilliSource, "Packed archives can only be mounted in the package or ChilliSource storage locations.");
+            
+            MemoryMappedFileCSPtr archiveFile = CreateMemoryMappedFile(in_storageLocation, in_archiveFilePath);
+            if (archiveFile == nullptr)
+            {
+                CS_LOG_ERROR("File System: Could not open packed archive '" + in_archiveFilePath + "'.");
+                return false;
+            }
+            
+            PackedArchiveCSPtr archive = PackedArchive::Create(archiveFile);
+            if (archive == nullptr)
+            {
+                CS_LOG_ERROR("File System: '" + in_archiveFilePath + "' is not a valid packed archive.");
+                return false;
+            }
+            
+            std::unique_lock<std::mutex> lock(m_packedArchiveMutex);
+            if (in_storageLocation == StorageLocation::k_package)
+            {
+                m_packageArchive = archive;
+            }
+            else
+            {
+                m_chilliSourceArchive = archive;
+            }
+            
+            return true;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void FileSystem::UnmountPackedArchive(StorageLocation in_storageLocation)
+        {
+            std::unique_lock<std::mutex> lock(m_packedArchiveMutex);
+            if (in_storageLocation == StorageLocation::k_package)
+            {
+                m_packageArchive.reset();
+            }
+            else if (in_storageLocation == StorageLocation::k_chilliSource)
+            {
+                m_chilliSourceArchive.reset();
+            }
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
         std::string FileSystem::GetFileChecksumSHA1(StorageLocation in_storageLocation, const std::string& in_filePath) const
         {
             FileStreamUPtr file = CreateFileStream(in_storageLocation, in_filePath, FileMode::k_readBinary);
@@ -230,7 +308,7 @@ namespace ChilliSource
 			{
 				//get the length of the file
 				file->SeekG(0, SeekDir::k_end);
-				s32 length = file->TellG();
+				u32 length = static_cast<u32>(file->TellG());
 				file->SeekG(0, SeekDir::k_beginning);
 
 				//read contents of file
@@ -291,8 +369,7 @@ namespace ChilliSource
 			{
 				//get the length of the file
 				file->SeekG(0, SeekDir::k_end);
-				s32 dwLength = file->TellG();
-				return dwLength;
+				return static_cast<u32>(file->TellG());
 			}
 
 			return 0;
@@ -345,5 +422,111 @@ namespace ChilliSource
                     return false;
             }
         }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        FileStreamUPtr FileSystem::CreateFileStreamFromPackedArchive(StorageLocation in_storageLocation, const std::string& in_filePath, FileMode in_fileMode) const
+        {
+            if (IsWriteMode(in_fileMode) == true || (in_storageLocation == StorageLocation::k_DLC && DoesFileExistInCachedDLC(in_filePath) == true))
+            {
+                return nullptr;
+            }
+            
+            std::string archivePath;
+            PackedArchiveCSPtr archive = GetPackedArchive(in_storageLocation, in_filePath, archivePath);
+            if (archive == nullptr)
+            {
+                return nullptr;
+            }
+            
+            return archive->CreateFileStream(archivePath, in_fileMode);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        MemoryMappedFileUPtr FileSystem::CreateMemoryMappedFileFromPackedArchive(StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            if (in_storageLocation == StorageLocation::k_DLC && DoesFileExistInCachedDLC(in_filePath) == true)
+            {
+                return nullptr;
+            }
+            
+            std::string archivePath;
+            PackedArchiveCSPtr archive = GetPackedArchive(in_storageLocation, in_filePath, archivePath);
+            if (archive == nullptr)
+            {
+                return nullptr;
+            }
+            
+            return archive->CreateMemoryMappedFile(archivePath);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::DoesFileExistInPackedArchive(StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            std::string archivePath;
+            PackedArchiveCSPtr archive = GetPackedArchive(in_storageLocation, in_filePath, archivePath);
+            return (archive != nullptr && archive->DoesFileExist(archivePath) == true);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        bool FileSystem::DoesDirectoryExistInPackedArchive(StorageLocation in_storageLocation, const std::string& in_directoryPath) const
+        {
+            std::string archivePath;
+            PackedArchiveCSPtr archive = GetPackedArchive(in_storageLocation, in_directoryPath, archivePath);
+            return (archive != nullptr && archive->DoesDirectoryExist(archivePath) == true);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        std::vector<std::string> FileSystem::GetFilePathsInPackedArchive(StorageLocation in_storageLocation, const std::string& in_directoryPath, bool in_recursive) const
+        {
+            std::string archivePath;
+            PackedArchiveCSPtr archive = GetPackedArchive(in_storageLocation, in_directoryPath, archivePath);
+            if (archive == nullptr)
+            {
+                return std::vector<std::string>();
+            }
+            
+            return archive->GetFilePaths(archivePath, in_recursive);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        std::vector<std::string> FileSystem::GetDirectoryPathsInPackedArchive(StorageLocation in_storageLocation, const std::string& in_directoryPath, bool in_recursive) const
+        {
+            std::string archivePath;
+            PackedArchiveCSPtr archive = GetPackedArchive(in_storageLocation, in_directoryPath, archivePath);
+            if (archive == nullptr)
+            {
+                return std::vector<std::string>();
+            }
+            
+            return archive->GetDirectoryPaths(archivePath, in_recursive);
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        PackedArchiveCSPtr FileSystem::GetPackedArchive(StorageLocation in_storageLocation, const std::string& in_path, std::string& out_archivePath) const
+        {
+            std::unique_lock<std::mutex> lock(m_packedArchiveMutex);
+            switch (in_storageLocation)
+            {
+                case StorageLocation::k_package:
+                    out_archivePath = in_path;
+                    return m_packageArchive;
+                case StorageLocation::k_chilliSource:
+                    out_archivePath = in_path;
+                    return m_chilliSourceArchive;
+                case StorageLocation::k_DLC:
+                {
+                    PackedArchiveCSPtr archive = m_packageArchive;
+                    lock.unlock();
+                    
+                    if (archive != nullptr)
+                    {
+                        out_archivePath = GetPackageDLCPath() + in_path;
+                    }
+                    return archive;
+                }
+                default:
+                    return nullptr;
+            }
+        }
     }
 }
@@ -57,6 +57,17 @@ namespace ChilliSource
 		public:
             CS_DECLARE_NAMEDTYPE(FileSystem);
             //------------------------------------------------------------------------------
+            /// A container for information on a single file which can be queried without
+            /// opening it.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            struct FileInfo final
+            {
+                u64 m_size = 0;
+                u64 m_modificationTime = 0;
+            };
+            //------------------------------------------------------------------------------
             /// Reads the contents of a file from disc if the file exists.
             ///
             /// This is thread-safe.
@@ -116,6 +127,46 @@ namespace ChilliSource
             //------------------------------------------------------------------------------
             virtual FileStreamUPtr CreateFileStream(StorageLocation in_storageLocation, const std::string& in_filePath, FileMode in_fileMode) const = 0;
             //------------------------------------------------------------------------------
+            /// Creates a read-only memory mapped view of the given file in the given
+            /// storage location. This allows the file to be parsed in place rather than
+            /// through many small reads from a file stream.
+            ///
+            /// The default implementation reads the entire file into a buffer which backs
+            /// the returned object; platforms which support mapping the given storage
+            /// location override this to map the file instead.
+            ///
+            /// This is thread-safe, as is the returned memory mapped file.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location.
+            /// @param in_filePath - The file path.
+            ///
+            /// @return The new memory mapped file. If the file cannot be opened null will
+            /// be returned.
+            //------------------------------------------------------------------------------
+            virtual MemoryMappedFileUPtr CreateMemoryMappedFile(StorageLocation in_storageLocation, const std::string& in_filePath) const;
+            //------------------------------------------------------------------------------
+            /// Gets the size and last modification time of the given file without opening
+            /// it. The modification time is in platform specific units, so it should only
+            /// be used to detect whether or not a file has changed.
+            ///
+            /// Not all files support this: the default implementation always fails, as
+            /// do files which are read from a mounted packed archive. Callers should fall
+            /// back to reading the file if this fails.
+            ///
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location.
+            /// @param in_filePath - The file path.
+            /// @param out_fileInfo - [Out] The file info.
+            ///
+            /// @return Whether or not the file info could be retrieved.
+            //------------------------------------------------------------------------------
+            virtual bool TryGetFileInfo(StorageLocation in_storageLocation, const std::string& in_filePath, FileInfo& out_fileInfo) const;
+            //------------------------------------------------------------------------------
             /// Creates the given directory. The full directory hierarchy will be created.
             ///
             /// This is thread-safe.
@@ -355,6 +406,42 @@ namespace ChilliSource
 			//------------------------------------------------------------------------------
             const std::string& GetPackageDLCPath() const;
             //------------------------------------------------------------------------------
+            /// Mounts the packed archive at the given path in the given storage location.
+            /// Once mounted the files in the archive are treated as if they are in the
+            /// root of the storage location, taking precedence over any loose files with
+            /// the same path. The archive file itself is opened once and all reads are
+            /// served from it. Archives can only be mounted in the read-only package and
+            /// ChilliSource storage locations, and mounting an archive in a location
+            /// which already has one mounted replaces it.
+            ///
+            /// Files in a mounted archive can be read, listed and queried but cannot be
+            /// accessed by absolute path.
+            ///
+            /// This is thread-safe, though archives should typically be mounted during
+            /// initialisation, before any resources are loaded.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location to mount the archive in.
+            /// This is also the storage location of the archive file.
+            /// @param in_archiveFilePath - The path to the archive file.
+            ///
+            /// @return Whether or not the archive was successfully mounted.
+            //------------------------------------------------------------------------------
+            bool MountPackedArchive(StorageLocation in_storageLocation, const std::string& in_archiveFilePath);
+            //------------------------------------------------------------------------------
+            /// Unmounts the packed archive in the given storage location, if there is
+            /// one. Files which have previously been read from the archive remain
+            /// valid.
+            ///
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location.
+            //------------------------------------------------------------------------------
+            void UnmountPackedArchive(StorageLocation in_storageLocation);
+            //------------------------------------------------------------------------------
             /// Calculate the SHA1 checksum of the file at the given directory
             ///
             /// This is thread-safe.
@@ -484,10 +571,113 @@ namespace ChilliSource
             /// @return whether or not the given file mode is a write mode
             //------------------------------------------------------------------------------
             bool IsWriteMode(Core::FileMode in_fileMode) const;
+            //------------------------------------------------------------------------------
+            /// Creates a file stream to the given file if it is in the packed archive
+            /// mounted for the given storage location. For the DLC storage location,
+            /// files in the DLC cache take precedence over the package archive.
+            ///
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location.
+            /// @param in_filePath - The file path.
+            /// @param in_fileMode - The file mode. Write modes always return null.
+            ///
+            /// @return The file stream, or null if the file isn't in a mounted archive.
+            //------------------------------------------------------------------------------
+            FileStreamUPtr CreateFileStreamFromPackedArchive(StorageLocation in_storageLocation, const std::string& in_filePath, FileMode in_fileMode) const;
+            //------------------------------------------------------------------------------
+            /// Creates a memory mapped file for the given file if it is in the packed
+            /// archive mounted for the given storage location. For the DLC storage
+            /// location, files in the DLC cache take precedence over the package archive.
+            ///
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location.
+            /// @param in_filePath - The file path.
+            ///
+            /// @return The memory mapped file, or null if the file isn't in a mounted
+            /// archive.
+            //------------------------------------------------------------------------------
+            MemoryMappedFileUPtr CreateMemoryMappedFileFromPackedArchive(StorageLocation in_storageLocation, const std::string& in_filePath) const;
+            //------------------------------------------------------------------------------
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location.
+            /// @param in_filePath - The file path.
+            ///
+            /// @return Whether or not the file is in the packed archive mounted for the
+            /// given storage location.
+            //------------------------------------------------------------------------------
+            bool DoesFileExistInPackedArchive(StorageLocation in_storageLocation, const std::string& in_filePath) const;
+            //------------------------------------------------------------------------------
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location.
+            /// @param in_directoryPath - The directory path.
+            ///
+            /// @return Whether or not the directory is in the packed archive mounted for
+            /// the given storage location.
+            //------------------------------------------------------------------------------
+            bool DoesDirectoryExistInPackedArchive(StorageLocation in_storageLocation, const std::string& in_directoryPath) const;
+            //------------------------------------------------------------------------------
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location.
+            /// @param in_directoryPath - The directory path.
+            /// @param in_recursive - Whether or not to include sub directories.
+            ///
+            /// @return The paths of the files in the given directory of the packed
+            /// archive mounted for the given storage location.
+            //------------------------------------------------------------------------------
+            std::vector<std::string> GetFilePathsInPackedArchive(StorageLocation in_storageLocation, const std::string& in_directoryPath, bool in_recursive) const;
+            //------------------------------------------------------------------------------
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location.
+            /// @param in_directoryPath - The directory path.
+            /// @param in_recursive - Whether or not to include sub directories.
+            ///
+            /// @return The paths of the sub directories of the given directory in the
+            /// packed archive mounted for the given storage location.
+            //------------------------------------------------------------------------------
+            std::vector<std::string> GetDirectoryPathsInPackedArchive(StorageLocation in_storageLocation, const std::string& in_directoryPath, bool in_recursive) const;
 
         private:
+            //------------------------------------------------------------------------------
+            /// Gets the packed archive which contains the given path. The DLC storage
+            /// location resolves to the package archive, with the path prefixed with
+            /// the package DLC path.
+            ///
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_storageLocation - The storage location.
+            /// @param in_path - The file or directory path.
+            /// @param out_archivePath - [Out] The path within the archive.
+            ///
+            /// @return The archive, or null if there isn't one mounted.
+            //------------------------------------------------------------------------------
+            PackedArchiveCSPtr GetPackedArchive(StorageLocation in_storageLocation, const std::string& in_path, std::string& out_archivePath) const;
+
             std::string m_packageDLCPath;
             mutable std::mutex m_packageDLCPathMutex;
+            
+            PackedArchiveCSPtr m_packageArchive;
+            PackedArchiveCSPtr m_chilliSourceArchive;
+            mutable std::mutex m_packedArchiveMutex;
 		};
 	}
 		
@@ -0,0 +1,241 @@
+//
+//  MemoryMappedFile.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+
+#ifdef CS_TARGETPLATFORM_WINDOWS
+#include <CSBackend/Platform/Windows/Core/String/WindowsStringUtils.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+#ifdef CS_TARGETPLATFORM_WINDOWS
+            //------------------------------------------------------------------------------
+            /// Maps the file at the given path using the windows API. The file and
+            /// mapping handles are closed once the view has been created; the view
+            /// keeps them alive internally until it is unmapped.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_absFilePath - The absolute path to the file.
+            /// @param out_data - [Out] The mapped data. Null if the file is empty.
+            /// @param out_size - [Out] The size of the file.
+            ///
+            /// @return Whether or not the file was successfully mapped.
+            //------------------------------------------------------------------------------
+            bool MapFile(const std::string& in_absFilePath, const u8*& out_data, u64& out_size)
+            {
+                std::wstring path = CSBackend::Windows::WindowsStringUtils::ConvertStandardPathToWindows(in_absFilePath);
+                HANDLE fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+                if (fileHandle == INVALID_HANDLE_VALUE)
+                {
+                    return false;
+                }
+                
+                LARGE_INTEGER fileSize;
+                if (GetFileSizeEx(fileHandle, &fileSize) == FALSE)
+                {
+                    CloseHandle(fileHandle);
+                    return false;
+                }
+                
+                out_size = static_cast<u64>(fileSize.QuadPart);
+                out_data = nullptr;
+                if (out_size == 0)
+                {
+                    CloseHandle(fileHandle);
+                    return true;
+                }
+                
+                HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                CloseHandle(fileHandle);
+                if (mappingHandle == nullptr)
+                {
+                    return false;
+                }
+                
+                out_data = reinterpret_cast<const u8*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+                CloseHandle(mappingHandle);
+                
+                return (out_data != nullptr);
+            }
+            //------------------------------------------------------------------------------
+            /// Unmaps data mapped with MapFile().
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_data - The mapped data.
+            /// @param in_size - The size of the mapped data.
+            //------------------------------------------------------------------------------
+            void UnmapFile(const u8* in_data, u64 in_size)
+            {
+                UnmapViewOfFile(in_data);
+            }
+#else
+            //------------------------------------------------------------------------------
+            /// Maps the file at the given path using mmap. The file descriptor is closed
+            /// once the mapping has been created, as the mapping remains valid without it.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_absFilePath - The absolute path to the file.
+            /// @param out_data - [Out] The mapped data. Null if the file is empty.
+            /// @param out_size - [Out] The size of the file.
+            ///
+            /// @return Whether or not the file was successfully mapped.
+            //------------------------------------------------------------------------------
+            bool MapFile(const std::string& in_absFilePath, const u8*& out_data, u64& out_size)
+            {
+                s32 fileDescriptor = open(in_absFilePath.c_str(), O_RDONLY);
+                if (fileDescriptor < 0)
+                {
+                    return false;
+                }
+                
+                struct stat fileStats;
+                if (fstat(fileDescriptor, &fileStats) != 0 || S_ISREG(fileStats.st_mode) == false)
+                {
+                    close(fileDescriptor);
+                    return false;
+                }
+                
+                out_size = static_cast<u64>(fileStats.st_size);
+                out_data = nullptr;
+                if (out_size == 0)
+                {
+                    close(fileDescriptor);
+                    return true;
+                }
+                
+                void* mapped = mmap(nullptr, static_cast<size_t>(out_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+                close(fileDescriptor);
+                if (mapped == MAP_FAILED)
+                {
+                    return false;
+                }
+                
+                out_data = reinterpret_cast<const u8*>(mapped);
+                return true;
+            }
+            //------------------------------------------------------------------------------
+            /// Unmaps data mapped with MapFile().
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_data - The mapped data.
+            /// @param in_size - The size of the mapped data.
+            //------------------------------------------------------------------------------
+            void UnmapFile(const u8* in_data, u64 in_size)
+            {
+                munmap(const_cast<u8*>(in_data), static_cast<size_t>(in_size));
+            }
+#endif
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        MemoryMappedFileUPtr MemoryMappedFile::Create(const std::string& in_absFilePath)
+        {
+            const u8* data = nullptr;
+            u64 size = 0;
+            if (MapFile(in_absFilePath, data, size) == false)
+            {
+                return nullptr;
+            }
+            
+            MemoryMappedFileUPtr output(new MemoryMappedFile());
+            output->m_data = data;
+            output->m_size = size;
+            output->m_isMapped = (data != nullptr);
+            return output;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        MemoryMappedFileUPtr MemoryMappedFile::Create(std::unique_ptr<u8[]> in_data, u64 in_dataSize)
+        {
+            CS_ASSERT(in_data != nullptr || in_dataSize == 0, "Cannot create a memory mapped file from a null buffer.");
+            
+            MemoryMappedFileUPtr output(new MemoryMappedFile());
+            output->m_ownedData = std::move(in_data);
+            output->m_data = output->m_ownedData.get();
+            output->m_size = in_dataSize;
+            return output;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        MemoryMappedFileUPtr MemoryMappedFile::Create(const MemoryMappedFileCSPtr& in_parent, u64 in_offset, u64 in_size)
+        {
+            CS_ASSERT(in_parent != nullptr, "Cannot create a view of a null memory mapped file.");
+            CS_ASSERT(in_offset <= in_parent->GetSize() && in_size <= in_parent->GetSize() - in_offset, "Memory mapped file view lies outside of the parent file.");
+            
+            MemoryMappedFileUPtr output(new MemoryMappedFile());
+            output->m_parent = in_parent;
+            output->m_data = (in_size > 0) ? in_parent->GetData() + in_offset : nullptr;
+            output->m_size = in_size;
+            output->m_isMapped = in_parent->IsMapped();
+            return output;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const u8* MemoryMappedFile::GetData() const
+        {
+            return m_data;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 MemoryMappedFile::GetSize() const
+        {
+            return m_size;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool MemoryMappedFile::IsMapped() const
+        {
+            return m_isMapped;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        MemoryMappedFile::~MemoryMappedFile()
+        {
+            if (m_isMapped == true && m_parent == nullptr)
+            {
+                UnmapFile(m_data, m_size);
+            }
+        }
+    }
+}
@@ -0,0 +1,141 @@
+//
+//  MemoryMappedFile.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_FILE_MEMORYMAPPEDFILE_H_
+#define _CHILLISOURCE_CORE_FILE_MEMORYMAPPEDFILE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// A read-only view of the entire contents of a file. Where possible the file
+        /// is memory mapped, allowing it to be parsed in place without first copying
+        /// it into a heap allocated buffer; pages are only brought in from disk as they
+        /// are accessed and can be discarded by the OS under memory pressure. Files
+        /// which cannot be mapped, such as those stored inside a compressed archive,
+        /// can instead be backed by a buffer which the memory mapped file takes
+        /// ownership of.
+        ///
+        /// Memory mapped files are immutable and therefore thread-safe. They are
+        /// typically shared between the objects which hold pointers into the mapped
+        /// data so that the mapping outlives them.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class MemoryMappedFile final
+        {
+        public:
+            CS_DECLARE_NOCOPY(MemoryMappedFile);
+            //------------------------------------------------------------------------------
+            /// Memory maps the file at the given absolute path. This is typically not
+            /// called directly; FileSystem::CreateMemoryMappedFile() should be used
+            /// instead.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_absFilePath - The absolute path to the file.
+            ///
+            /// @return The new memory mapped file, or null if the file could not be
+            /// opened or mapped.
+            //------------------------------------------------------------------------------
+            static MemoryMappedFileUPtr Create(const std::string& in_absFilePath);
+            //------------------------------------------------------------------------------
+            /// Creates a new memory mapped file backed by the given buffer rather than
+            /// an actual mapping. This is used as a fallback for files which cannot be
+            /// mapped.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_data - The buffer containing the file contents.
+            /// @param in_dataSize - The size of the buffer.
+            ///
+            /// @return The new memory mapped file.
+            //------------------------------------------------------------------------------
+            static MemoryMappedFileUPtr Create(std::unique_ptr<u8[]> in_data, u64 in_dataSize);
+            //------------------------------------------------------------------------------
+            /// Creates a new memory mapped file which is a view of a range of another
+            /// memory mapped file. This is used for files stored uncompressed inside an
+            /// archive. The parent file is kept alive for the lifetime of the view.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_parent - The memory mapped file to create a view of.
+            /// @param in_offset - The offset of the range within the parent.
+            /// @param in_size - The size of the range.
+            ///
+            /// @return The new memory mapped file.
+            //------------------------------------------------------------------------------
+            static MemoryMappedFileUPtr Create(const MemoryMappedFileCSPtr& in_parent, u64 in_offset, u64 in_size);
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return A pointer to the start of the file contents. This will be null if
+            /// the file is empty.
+            //------------------------------------------------------------------------------
+            const u8* GetData() const;
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The size of the file in bytes.
+            //------------------------------------------------------------------------------
+            u64 GetSize() const;
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return Whether or not the contents are actually memory mapped, rather
+            /// than backed by an owned buffer.
+            //------------------------------------------------------------------------------
+            bool IsMapped() const;
+            //------------------------------------------------------------------------------
+            /// Destructor. Unmaps the file.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            ~MemoryMappedFile();
+            
+        private:
+            //------------------------------------------------------------------------------
+            /// Constructor. Declared private to force the use of the factory methods.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            MemoryMappedFile() = default;
+            
+            const u8* m_data = nullptr;
+            u64 m_size = 0;
+            std::unique_ptr<u8[]> m_ownedData;
+            MemoryMappedFileCSPtr m_parent;
+            bool m_isMapped = false;
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,102 @@
+//
+//  MemoryReader.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/File/MemoryReader.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        MemoryReader::MemoryReader(const u8* in_data, u64 in_dataSize)
+            : m_data(in_data), m_dataSize(in_dataSize)
+        {
+            CS_ASSERT(m_data != nullptr || m_dataSize == 0, "Cannot read from null memory.");
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 MemoryReader::GetSize() const
+        {
+            return m_dataSize;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 MemoryReader::GetRemainingSize() const
+        {
+            return m_dataSize - m_readPosition;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u64 MemoryReader::GetReadPosition() const
+        {
+            return m_readPosition;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void MemoryReader::SetReadPosition(u64 in_readPosition)
+        {
+            if (in_readPosition > m_dataSize)
+            {
+                CS_LOG_FATAL("Trying to set the read position of a Memory Reader beyond the end of the data.");
+            }
+            
+            m_readPosition = in_readPosition;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const u8* MemoryReader::Read(u64 in_dataSize)
+        {
+            if (in_dataSize > GetRemainingSize())
+            {
+                CS_LOG_FATAL("Trying to read beyond the end of a Memory Reader.");
+            }
+            
+            const u8* output = m_data + m_readPosition;
+            m_readPosition += in_dataSize;
+            return output;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void MemoryReader::Read(u8* out_buffer, u64 in_dataSize)
+        {
+            CS_ASSERT(out_buffer != nullptr || in_dataSize == 0, "Cannot read into a null buffer.");
+            
+            if (in_dataSize > 0)
+            {
+                std::memcpy(out_buffer, Read(in_dataSize), static_cast<size_t>(in_dataSize));
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void MemoryReader::Skip(u64 in_dataSize)
+        {
+            Read(in_dataSize);
+        }
+    }
+}
@@ -0,0 +1,150 @@
+//
+//  MemoryReader.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_FILE_MEMORYREADER_H_
+#define _CHILLISOURCE_CORE_FILE_MEMORYREADER_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <cstring>
+#include <type_traits>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// Provides sequential reads from a block of memory, typically the contents of
+        /// a MemoryMappedFile. This allows file formats to be parsed in place: values
+        /// are read directly from the memory and blocks of data can be accessed without
+        /// being copied. The reader does not own the memory, so it must be kept alive
+        /// for the lifetime of the reader and any pointers it returns.
+        ///
+        /// Reading beyond the end of the memory is considered a fatal error. Parsers of
+        /// data which may be corrupt should check GetRemainingSize() before reading.
+        ///
+        /// This is not thread-safe.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class MemoryReader final
+        {
+        public:
+            //------------------------------------------------------------------------------
+            /// Constructor.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_data - The memory which should be read from.
+            /// @param in_dataSize - The size of the memory.
+            //------------------------------------------------------------------------------
+            MemoryReader(const u8* in_data, u64 in_dataSize);
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The total size of the memory.
+            //------------------------------------------------------------------------------
+            u64 GetSize() const;
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The number of bytes which are yet to be read.
+            //------------------------------------------------------------------------------
+            u64 GetRemainingSize() const;
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The current read position.
+            //------------------------------------------------------------------------------
+            u64 GetReadPosition() const;
+            //------------------------------------------------------------------------------
+            /// Sets the read position. This cannot be beyond the end of the memory.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_readPosition - The new read position.
+            //------------------------------------------------------------------------------
+            void SetReadPosition(u64 in_readPosition);
+            //------------------------------------------------------------------------------
+            /// Reads a value of the given type. The value is copied out of the memory so
+            /// it does not need to be correctly aligned. This should only be used with
+            /// arithmetic types or plain old data structures.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The value.
+            //------------------------------------------------------------------------------
+            template <typename TType> TType Read();
+            //------------------------------------------------------------------------------
+            /// Reads a block of the given size without copying it.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_dataSize - The size of the block.
+            ///
+            /// @return A pointer to the block within the memory. Note this is not
+            /// guaranteed to have any specific alignment.
+            //------------------------------------------------------------------------------
+            const u8* Read(u64 in_dataSize);
+            //------------------------------------------------------------------------------
+            /// Copies a block of the given size into the given buffer.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param out_buffer - [Out] The buffer to copy into.
+            /// @param in_dataSize - The size of the block.
+            //------------------------------------------------------------------------------
+            void Read(u8* out_buffer, u64 in_dataSize);
+            //------------------------------------------------------------------------------
+            /// Moves the read position forward by the given number of bytes.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_dataSize - The number of bytes to skip.
+            //------------------------------------------------------------------------------
+            void Skip(u64 in_dataSize);
+            
+        private:
+            const u8* m_data = nullptr;
+            u64 m_dataSize = 0;
+            u64 m_readPosition = 0;
+        };
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TType> TType MemoryReader::Read()
+        {
+            static_assert(std::is_arithmetic<TType>::value || std::is_pod<TType>::value, "Only arithmetic and POD types can be read.");
+            
+            TType output;
+            std::memcpy(&output, Read(sizeof(TType)), sizeof(TType));
+            return output;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,345 @@
+//
+//  PackedArchive.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/File/PackedArchive.h>
+
+#include <ChilliSource/Core/Cryptographic/HashXXHash64.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+#include <ChilliSource/Core/File/MemoryReader.h>
+#include <ChilliSource/Core/File/VirtualFileStream.h>
+#include <ChilliSource/Core/String/StringUtils.h>
+#include <ChilliSource/Core/String/ToString.h>
+
+#include <zlib.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const u32 k_magicNumber = 0x4B505343; //'CSPK'
+            const u32 k_version = 1;
+            const u64 k_headerSize = 32;
+            const u64 k_entrySize = 48;
+            
+            const u32 k_directoryFlag = 1 << 0;
+            const u32 k_compressedFlag = 1 << 1;
+            
+            //------------------------------------------------------------------------------
+            /// Converts the given file or directory path to the form used in the
+            /// archive: forward slashes, relative to the root, and with a trailing slash
+            /// if it is a directory.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_path - The path.
+            /// @param in_isDirectory - Whether or not the path is a directory path.
+            ///
+            /// @return The archive path.
+            //------------------------------------------------------------------------------
+            std::string ToArchivePath(const std::string& in_path, bool in_isDirectory)
+            {
+                std::string path = (in_isDirectory == true) ? StringUtils::StandardiseDirectoryPath(in_path) : StringUtils::StandardiseFilePath(in_path);
+                
+                u32 start = 0;
+                while (start < path.size() && path[start] == '/')
+                {
+                    ++start;
+                }
+                
+                return path.substr(start);
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PackedArchiveUPtr PackedArchive::Create(const MemoryMappedFileCSPtr& in_archiveFile)
+        {
+            CS_ASSERT(in_archiveFile != nullptr, "Cannot create a packed archive from a null file.");
+            
+            PackedArchiveUPtr archive(new PackedArchive(in_archiveFile));
+            if (archive->ReadTableOfContents() == false)
+            {
+                return nullptr;
+            }
+            
+            return archive;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PackedArchive::PackedArchive(const MemoryMappedFileCSPtr& in_archiveFile)
+            : m_archiveFile(in_archiveFile)
+        {
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        MemoryMappedFileUPtr PackedArchive::CreateMemoryMappedFile(const std::string& in_filePath) const
+        {
+            Entry entry;
+            if (TryGetEntry(ToArchivePath(in_filePath, false), entry) == false || (entry.m_flags & k_directoryFlag) != 0)
+            {
+                return nullptr;
+            }
+            
+            if ((entry.m_flags & k_compressedFlag) == 0)
+            {
+                return MemoryMappedFile::Create(m_archiveFile, entry.m_dataOffset, entry.m_storedSize);
+            }
+            
+            std::unique_ptr<u8[]> data(new u8[static_cast<size_t>(entry.m_uncompressedSize)]);
+            uLongf uncompressedSize = static_cast<uLongf>(entry.m_uncompressedSize);
+            s32 result = uncompress(reinterpret_cast<Bytef*>(data.get()), &uncompressedSize, reinterpret_cast<const Bytef*>(m_archiveFile->GetData() + entry.m_dataOffset), static_cast<uLong>(entry.m_storedSize));
+            if (result != Z_OK || uncompressedSize != entry.m_uncompressedSize)
+            {
+                CS_LOG_ERROR("Packed Archive: Failed to decompress file '" + in_filePath + "'.");
+                return nullptr;
+            }
+            
+            return MemoryMappedFile::Create(std::move(data), entry.m_uncompressedSize);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        FileStreamUPtr PackedArchive::CreateFileStream(const std::string& in_filePath, FileMode in_fileMode) const
+        {
+            CS_ASSERT(in_fileMode == FileMode::k_read || in_fileMode == FileMode::k_readBinary, "Packed archives can only be read from.");
+            
+            MemoryMappedFileCSPtr file = CreateMemoryMappedFile(in_filePath);
+            if (file == nullptr)
+            {
+                return nullptr;
+            }
+            
+            return FileStreamUPtr(new VirtualFileStream(file, in_fileMode));
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PackedArchive::DoesFileExist(const std::string& in_filePath) const
+        {
+            Entry entry;
+            return (TryGetEntry(ToArchivePath(in_filePath, false), entry) == true && (entry.m_flags & k_directoryFlag) == 0);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PackedArchive::DoesDirectoryExist(const std::string& in_directoryPath) const
+        {
+            std::string directoryPath = ToArchivePath(in_directoryPath, true);
+            if (directoryPath.empty() == true)
+            {
+                return true;
+            }
+            
+            Entry entry;
+            return (TryGetEntry(directoryPath, entry) == true && (entry.m_flags & k_directoryFlag) != 0);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::vector<std::string> PackedArchive::GetFilePaths(const std::string& in_directoryPath, bool in_recursive) const
+        {
+            return GetPaths(in_directoryPath, in_recursive, false);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::vector<std::string> PackedArchive::GetDirectoryPaths(const std::string& in_directoryPath, bool in_recursive) const
+        {
+            return GetPaths(in_directoryPath, in_recursive, true);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PackedArchive::ReadTableOfContents()
+        {
+            const u64 archiveSize = m_archiveFile->GetSize();
+            if (archiveSize < k_headerSize)
+            {
+                CS_LOG_ERROR("Packed Archive: File is too small to be a packed archive.");
+                return false;
+            }
+            
+            MemoryReader reader(m_archiveFile->GetData(), archiveSize);
+            
+            if (reader.Read<u32>() != k_magicNumber)
+            {
+                CS_LOG_ERROR("Packed Archive: File is not a packed archive.");
+                return false;
+            }
+            
+            u32 version = reader.Read<u32>();
+            if (version != k_version)
+            {
+                CS_LOG_ERROR("Packed Archive: Unsupported version " + ToString(version) + ".");
+                return false;
+            }
+            
+            m_numEntries = reader.Read<u32>();
+            m_numBuckets = reader.Read<u32>();
+            const u64 entryTableOffset = reader.Read<u64>();
+            const u64 stringTableOffset = reader.Read<u64>();
+            
+            if (m_numBuckets == 0 || (m_numBuckets & (m_numBuckets - 1)) != 0)
+            {
+                CS_LOG_ERROR("Packed Archive: The number of buckets must be a power of two.");
+                return false;
+            }
+            
+            const u64 bucketTableSize = (static_cast<u64>(m_numBuckets) + 1) * sizeof(u32);
+            const u64 entryTableSize = static_cast<u64>(m_numEntries) * k_entrySize;
+            if (bucketTableSize > archiveSize - k_headerSize || entryTableOffset > archiveSize || entryTableSize > archiveSize - entryTableOffset || stringTableOffset > archiveSize)
+            {
+                CS_LOG_ERROR("Packed Archive: Table of contents lies outside of the archive.");
+                return false;
+            }
+            
+            m_bucketTable = m_archiveFile->GetData() + k_headerSize;
+            m_entryTable = m_archiveFile->GetData() + entryTableOffset;
+            m_stringTable = m_archiveFile->GetData() + stringTableOffset;
+            m_stringTableSize = archiveSize - stringTableOffset;
+            
+            //The bucket table must be monotonic and end with the number of entries, otherwise lookups
+            //could index outside of the entry table.
+            MemoryReader bucketReader(m_bucketTable, bucketTableSize);
+            u32 previousBucketStart = 0;
+            for (u32 i = 0; i <= m_numBuckets; ++i)
+            {
+                u32 bucketStart = bucketReader.Read<u32>();
+                if (bucketStart < previousBucketStart || bucketStart > m_numEntries)
+                {
+                    CS_LOG_ERROR("Packed Archive: Bucket table is corrupt.");
+                    return false;
+                }
+                previousBucketStart = bucketStart;
+            }
+            
+            if (previousBucketStart != m_numEntries)
+            {
+                CS_LOG_ERROR("Packed Archive: Bucket table is corrupt.");
+                return false;
+            }
+            
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        PackedArchive::Entry PackedArchive::GetEntry(u32 in_index) const
+        {
+            CS_ASSERT(in_index < m_numEntries, "Packed archive entry index out of bounds.");
+            
+            MemoryReader reader(m_entryTable + static_cast<u64>(in_index) * k_entrySize, k_entrySize);
+            
+            Entry entry;
+            entry.m_pathHash = reader.Read<u64>();
+            entry.m_dataOffset = reader.Read<u64>();
+            entry.m_storedSize = reader.Read<u64>();
+            entry.m_uncompressedSize = reader.Read<u64>();
+            entry.m_pathOffset = reader.Read<u32>();
+            entry.m_pathLength = reader.Read<u32>();
+            entry.m_flags = reader.Read<u32>();
+            entry.m_reserved = reader.Read<u32>();
+            return entry;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string PackedArchive::GetEntryPath(const Entry& in_entry) const
+        {
+            if (in_entry.m_pathOffset > m_stringTableSize || in_entry.m_pathLength > m_stringTableSize - in_entry.m_pathOffset)
+            {
+                return std::string();
+            }
+            
+            return std::string(reinterpret_cast<const s8*>(m_stringTable + in_entry.m_pathOffset), in_entry.m_pathLength);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool PackedArchive::TryGetEntry(const std::string& in_path, Entry& out_entry) const
+        {
+            if (in_path.empty() == true)
+            {
+                return false;
+            }
+            
+            const u64 pathHash = HashXXHash64::GenerateHashCode(in_path);
+            const u32 bucket = static_cast<u32>(pathHash & static_cast<u64>(m_numBuckets - 1));
+            
+            MemoryReader bucketReader(m_bucketTable + bucket * sizeof(u32), 2 * sizeof(u32));
+            const u32 bucketStart = bucketReader.Read<u32>();
+            const u32 bucketEnd = bucketReader.Read<u32>();
+            
+            for (u32 i = bucketStart; i < bucketEnd; ++i)
+            {
+                Entry entry = GetEntry(i);
+                if (entry.m_pathHash == pathHash && entry.m_pathLength == in_path.size() && GetEntryPath(entry) == in_path)
+                {
+                    const u64 archiveSize = m_archiveFile->GetSize();
+                    if (entry.m_dataOffset > archiveSize || entry.m_storedSize > archiveSize - entry.m_dataOffset)
+                    {
+                        CS_LOG_ERROR("Packed Archive: Data for '" + in_path + "' lies outside of the archive.");
+                        return false;
+                    }
+                    
+                    out_entry = entry;
+                    return true;
+                }
+            }
+            
+            return false;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::vector<std::string> PackedArchive::GetPaths(const std::string& in_directoryPath, bool in_recursive, bool in_directories) const
+        {
+            std::vector<std::string> output;
+            
+            const std::string directoryPath = ToArchivePath(in_directoryPath, true);
+            for (u32 i = 0; i < m_numEntries; ++i)
+            {
+                Entry entry = GetEntry(i);
+                if (((entry.m_flags & k_directoryFlag) != 0) != in_directories)
+                {
+                    continue;
+                }
+                
+                std::string path = GetEntryPath(entry);
+                if (path.size() <= directoryPath.size() || StringUtils::StartsWith(path, directoryPath, false) == false)
+                {
+                    continue;
+                }
+                
+                std::string relativePath = path.substr(directoryPath.size());
+                
+                //directory paths end with a slash, so ignore it when checking whether the path is in a sub directory.
+                const u32 searchLength = static_cast<u32>(relativePath.size()) - ((in_directories == true) ? 1 : 0);
+                if (in_recursive == true || relativePath.find('/') >= searchLength)
+                {
+                    output.push_back(relativePath);
+                }
+            }
+            
+            return output;
+        }
+    }
+}
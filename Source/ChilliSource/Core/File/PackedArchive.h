@@ -0,0 +1,261 @@
+//
+//  PackedArchive.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_FILE_PACKEDARCHIVE_H_
+#define _CHILLISOURCE_CORE_FILE_PACKEDARCHIVE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/FileStream.h>
+
+#include <string>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// Provides read-only access to the contents of a packed archive (.cspack). A
+        /// packed archive is an engine-native alternative to loose files or zips: all
+        /// files are stored in a single file with their data aligned, optionally
+        /// deflate compressed per file. Packed archives can be created using the
+        /// pack_resources.py script.
+        ///
+        /// The archive contains a hashed table of contents, laid out as buckets of
+        /// entries keyed on the xxHash64 of each path. As the archive file is memory
+        /// mapped where possible the table of contents doesn't need to be parsed or
+        /// copied on load, and looking up a file is a constant time operation. Files
+        /// stored uncompressed are read in place from the archive mapping.
+        ///
+        /// The archive is immutable after creation so all methods are thread-safe.
+        ///
+        /// The archive format is as follows. All values are little endian.
+        ///
+        ///     Header:
+        ///         u32 - Magic number ('CSPK')
+        ///         u32 - Version
+        ///         u32 - Number of entries
+        ///         u32 - Number of buckets. Must be a power of two.
+        ///         u64 - Offset of the entry table
+        ///         u64 - Offset of the path string table
+        ///     Bucket table:
+        ///         u32 x (Number of buckets + 1) - The index of the first entry in
+        ///         each bucket, followed by the total number of entries.
+        ///     Entry table (sorted by bucket):
+        ///         u64 - Path hash
+        ///         u64 - Data offset
+        ///         u64 - Stored data size
+        ///         u64 - Uncompressed data size
+        ///         u32 - Path offset in the string table
+        ///         u32 - Path length
+        ///         u32 - Flags (1: directory, 2: compressed)
+        ///         u32 - Reserved
+        ///     Path string table
+        ///     Data
+        ///
+        /// Paths are relative to the root of the archive and use forward slashes.
+        /// Directory paths end with a forward slash.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class PackedArchive final
+        {
+        public:
+            CS_DECLARE_NOCOPY(PackedArchive);
+            //------------------------------------------------------------------------------
+            /// Creates a new packed archive from the contents of the given file. The
+            /// file is kept alive for the lifetime of the archive and any file read
+            /// from it.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_archiveFile - The archive file.
+            ///
+            /// @return The new packed archive, or null if the file isn't a valid
+            /// packed archive.
+            //------------------------------------------------------------------------------
+            static PackedArchiveUPtr Create(const MemoryMappedFileCSPtr& in_archiveFile);
+            //------------------------------------------------------------------------------
+            /// Creates a memory mapped file containing the contents of the given file
+            /// within the archive. If the file is stored uncompressed this is a view
+            /// into the archive, otherwise the file is decompressed into memory.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_filePath - The file path within the archive.
+            ///
+            /// @return The memory mapped file, or null if the file doesn't exist in
+            /// the archive or could not be decompressed.
+            //------------------------------------------------------------------------------
+            MemoryMappedFileUPtr CreateMemoryMappedFile(const std::string& in_filePath) const;
+            //------------------------------------------------------------------------------
+            /// Creates a new read-only file stream to the given file within the
+            /// archive.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_filePath - The file path within the archive.
+            /// @param in_fileMode - The file mode. Only read modes are supported.
+            ///
+            /// @return The file stream, or null if the file doesn't exist in the
+            /// archive, could not be decompressed or is empty.
+            //------------------------------------------------------------------------------
+            FileStreamUPtr CreateFileStream(const std::string& in_filePath, FileMode in_fileMode) const;
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param in_filePath - The file path.
+            ///
+            /// @return Whether or not the given file exists in the archive.
+            //------------------------------------------------------------------------------
+            bool DoesFileExist(const std::string& in_filePath) const;
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param in_directoryPath - The directory path.
+            ///
+            /// @return Whether or not the given directory exists in the archive.
+            //------------------------------------------------------------------------------
+            bool DoesDirectoryExist(const std::string& in_directoryPath) const;
+            //------------------------------------------------------------------------------
+            /// Lists the files in the given directory of the archive. Unlike file
+            /// lookup this requires a walk of the table of contents.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_directoryPath - The directory path.
+            /// @param in_recursive - Whether or not to include the contents of sub
+            /// directories.
+            ///
+            /// @return The file paths relative to the given directory.
+            //------------------------------------------------------------------------------
+            std::vector<std::string> GetFilePaths(const std::string& in_directoryPath, bool in_recursive) const;
+            //------------------------------------------------------------------------------
+            /// Lists the sub directories of the given directory of the archive. Unlike
+            /// file lookup this requires a walk of the table of contents.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_directoryPath - The directory path.
+            /// @param in_recursive - Whether or not to include the contents of sub
+            /// directories.
+            ///
+            /// @return The directory paths relative to the given directory.
+            //------------------------------------------------------------------------------
+            std::vector<std::string> GetDirectoryPaths(const std::string& in_directoryPath, bool in_recursive) const;
+            
+        private:
+            //------------------------------------------------------------------------------
+            /// A single entry in the table of contents, as stored in the archive.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            struct Entry final
+            {
+                u64 m_pathHash;
+                u64 m_dataOffset;
+                u64 m_storedSize;
+                u64 m_uncompressedSize;
+                u32 m_pathOffset;
+                u32 m_pathLength;
+                u32 m_flags;
+                u32 m_reserved;
+            };
+            //------------------------------------------------------------------------------
+            /// Constructor. Declared private to force the use of the factory method.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_archiveFile - The archive file.
+            //------------------------------------------------------------------------------
+            PackedArchive(const MemoryMappedFileCSPtr& in_archiveFile);
+            //------------------------------------------------------------------------------
+            /// Reads and validates the header, bucket table and entry table. This must
+            /// only be called during creation.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return Whether or not the table of contents is valid.
+            //------------------------------------------------------------------------------
+            bool ReadTableOfContents();
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param in_index - The index of the entry.
+            ///
+            /// @return The entry at the given index.
+            //------------------------------------------------------------------------------
+            Entry GetEntry(u32 in_index) const;
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param in_entry - The entry.
+            ///
+            /// @return The path of the given entry.
+            //------------------------------------------------------------------------------
+            std::string GetEntryPath(const Entry& in_entry) const;
+            //------------------------------------------------------------------------------
+            /// Looks up the entry with the given path in the hashed table of contents.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_path - The standardised path, relative to the archive root.
+            /// @param out_entry - [Out] The entry, if found.
+            ///
+            /// @return Whether or not the entry was found.
+            //------------------------------------------------------------------------------
+            bool TryGetEntry(const std::string& in_path, Entry& out_entry) const;
+            //------------------------------------------------------------------------------
+            /// Lists the paths of either the files or directories in the given
+            /// directory.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_directoryPath - The directory path.
+            /// @param in_recursive - Whether or not to include the contents of sub
+            /// directories.
+            /// @param in_directories - Whether directories, rather than files, should
+            /// be listed.
+            ///
+            /// @return The paths relative to the given directory.
+            //------------------------------------------------------------------------------
+            std::vector<std::string> GetPaths(const std::string& in_directoryPath, bool in_recursive, bool in_directories) const;
+            
+            MemoryMappedFileCSPtr m_archiveFile;
+            u32 m_numEntries = 0;
+            u32 m_numBuckets = 0;
+            const u8* m_bucketTable = nullptr;
+            const u8* m_entryTable = nullptr;
+            const u8* m_stringTable = nullptr;
+            u64 m_stringTableSize = 0;
+        };
+    }
+}
+
+#endif
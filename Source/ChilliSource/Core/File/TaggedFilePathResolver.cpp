@@ -35,6 +35,7 @@
 #include <ChilliSource/Core/String/StringParser.h>
 
 #include <algorithm>
+#include <chrono>
 
 namespace ChilliSource
 {
@@ -149,6 +150,30 @@ namespace ChilliSource
                 CS_LOG_FATAL("TaggedFilePathResolver: No such group: " + in_group);
                 return TaggedFilePathResolver::TagGroup::k_platform;
             }
+            //--------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The storage location.
+            ///
+            /// @return Whether or not the contents of the storage location
+            /// only change at known times and therefore can be cached.
+            //--------------------------------------------------------------
+            bool IsCacheable(StorageLocation in_location)
+            {
+                return (in_location == StorageLocation::k_package || in_location == StorageLocation::k_chilliSource || in_location == StorageLocation::k_DLC);
+            }
+            //--------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The storage location.
+            /// @param The path.
+            ///
+            /// @return The cache key for the given location and path.
+            //--------------------------------------------------------------
+            std::string GenerateCacheKey(StorageLocation in_location, const std::string& in_path)
+            {
+                return ToString(static_cast<u32>(in_location)) + ":" + in_path;
+            }
         }
         
         CS_DEFINE_NAMEDTYPE(TaggedFilePathResolver);
@@ -240,6 +265,10 @@ namespace ChilliSource
                                          const std::vector<RangeRule>& in_supportedResolutions,
                                          const std::vector<RangeRule>& in_supportedAspectRatios)
         {
+            std::unique_lock<std::mutex> lock(m_cacheMutex);
+            m_resolvedPaths.clear();
+            lock.unlock();
+            
             //---Languages
             auto device = Application::Get()->GetSystem<Device>();
             CS_ASSERT(device != nullptr, "TaggedFilePathResolver must have access to Device system");
@@ -297,6 +326,10 @@ namespace ChilliSource
             m_priorityIndices[2] = (u32)in_3;
             m_priorityIndices[3] = (u32)in_low;
             
+            std::unique_lock<std::mutex> lock(m_cacheMutex);
+            m_resolvedPaths.clear();
+            lock.unlock();
+            
 #ifdef DEBUG
             u32 priorityIndicesSorted[(u32)TagGroup::k_total];
             std::copy(m_priorityIndices, m_priorityIndices + (u32)TagGroup::k_total, priorityIndicesSorted);
@@ -316,6 +349,11 @@ namespace ChilliSource
         //--------------------------------------------------------------
         void TaggedFilePathResolver::DetermineScreenDependentTags(const Vector2& in_size)
         {
+            //the active tags are changing so any previous resolutions are no longer valid.
+            std::unique_lock<std::mutex> lock(m_cacheMutex);
+            m_resolvedPaths.clear();
+            lock.unlock();
+            
             //---Resolution
             f32 resolution = in_size.x * in_size.y;
             for(const auto& rule : m_resolutionRules)
@@ -341,12 +379,108 @@ namespace ChilliSource
         //--------------------------------------------------------------
         //--------------------------------------------------------------
         std::string TaggedFilePathResolver::ResolveFilePath(StorageLocation in_location, const std::string& in_basePath) const
+        {
+            typedef std::chrono::high_resolution_clock Clock;
+            const auto startTime = Clock::now();
+            
+            std::string output;
+            bool cacheHit = false;
+            
+            const bool cacheable = IsCacheable(in_location);
+            std::string cacheKey;
+            if (cacheable == true)
+            {
+                cacheKey = GenerateCacheKey(in_location, in_basePath);
+                
+                std::unique_lock<std::mutex> lock(m_cacheMutex);
+                auto it = m_resolvedPaths.find(cacheKey);
+                if (it != m_resolvedPaths.end())
+                {
+                    output = it->second;
+                    cacheHit = true;
+                }
+            }
+            
+            if (cacheHit == false)
+            {
+                output = ResolveFilePathUncached(in_location, in_basePath);
+            }
+            
+            const f64 resolutionTime = std::chrono::duration_cast<std::chrono::duration<f64>>(Clock::now() - startTime).count();
+            
+            std::unique_lock<std::mutex> lock(m_cacheMutex);
+            if (cacheable == true && cacheHit == false)
+            {
+                m_resolvedPaths.emplace(std::move(cacheKey), output);
+            }
+            
+            ++m_statistics.m_numResolutions;
+            m_statistics.m_numCacheHits += (cacheHit == true) ? 1 : 0;
+            m_statistics.m_totalResolutionTime += resolutionTime;
+            
+            return output;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void TaggedFilePathResolver::ClearCache()
+        {
+            std::unique_lock<std::mutex> lock(m_cacheMutex);
+            m_directoryListings.clear();
+            m_resolvedPaths.clear();
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        TaggedFilePathResolver::Statistics TaggedFilePathResolver::GetStatistics() const
+        {
+            std::unique_lock<std::mutex> lock(m_cacheMutex);
+            return m_statistics;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        void TaggedFilePathResolver::ResetStatistics()
+        {
+            std::unique_lock<std::mutex> lock(m_cacheMutex);
+            m_statistics = Statistics();
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        std::vector<std::string> TaggedFilePathResolver::GetDirectoryListing(StorageLocation in_location, const std::string& in_directoryPath, const std::string& in_extension) const
+        {
+            if (IsCacheable(in_location) == false)
+            {
+                std::unique_lock<std::mutex> lock(m_cacheMutex);
+                ++m_statistics.m_numDirectoryListings;
+                lock.unlock();
+                
+                return m_fileSystem->GetFilePathsWithExtension(in_location, in_directoryPath, false, in_extension);
+            }
+            
+            const std::string cacheKey = GenerateCacheKey(in_location, in_directoryPath + "*." + in_extension);
+            
+            std::unique_lock<std::mutex> lock(m_cacheMutex);
+            auto it = m_directoryListings.find(cacheKey);
+            if (it != m_directoryListings.end())
+            {
+                return it->second;
+            }
+            ++m_statistics.m_numDirectoryListings;
+            lock.unlock();
+            
+            //the listing is performed without holding the lock as it can be slow. If another thread lists the same directory in the meantime the first listing wins.
+            std::vector<std::string> listing = m_fileSystem->GetFilePathsWithExtension(in_location, in_directoryPath, false, in_extension);
+            
+            lock.lock();
+            return m_directoryListings.emplace(cacheKey, std::move(listing)).first->second;
+        }
+        //--------------------------------------------------------------
+        //--------------------------------------------------------------
+        std::string TaggedFilePathResolver::ResolveFilePathUncached(StorageLocation in_location, const std::string& in_basePath) const
         {
             std::string filePath, fileName, fileExtension;
             StringUtils::SplitFullFilename(in_basePath, fileName, fileExtension, filePath);
             
             //Look for all files in the given folder with the given name and extension
-            std::vector<std::string> pathsContaining = m_fileSystem->GetFilePathsWithExtension(in_location, filePath, false, fileExtension);
+            std::vector<std::string> pathsContaining = GetDirectoryListing(in_location, filePath, fileExtension);
             
             //Filter on the filename
             pathsContaining = FilterFileNameStartsWith(pathsContaining, fileName + ".");
@@ -34,6 +34,9 @@
 
 #include <json/json.h>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace ChilliSource
 {
 	namespace Core
@@ -62,6 +65,12 @@ namespace ChilliSource
         /// NOTE: Only the rules and tags for resolution and ratio are
         /// configurable as the platform and language are fixed.
         ///
+        /// Resolved paths in the read-only storage locations (package,
+        /// ChilliSource and DLC) are cached, as are the directory
+        /// listings used to resolve them, so each directory is only
+        /// listed once. The cache must be cleared whenever the contents
+        /// of these locations change, for example when DLC is installed.
+        ///
         /// @author S Downie
 		//-----------------------------------------------------------------
 		class TaggedFilePathResolver : public AppSystem
@@ -107,6 +116,20 @@ namespace ChilliSource
                 f32 m_minExclusive = 0;
             };
             //--------------------------------------------------------------
+            /// Statistics on the file path resolutions performed by the
+            /// resolver. This can be used to profile the cost of path
+            /// resolution during resource loading.
+            ///
+            /// @author Carlos Artesano
+            //--------------------------------------------------------------
+            struct Statistics
+            {
+                u32 m_numResolutions = 0;
+                u32 m_numCacheHits = 0;
+                u32 m_numDirectoryListings = 0;
+                f64 m_totalResolutionTime = 0.0;
+            };
+            //--------------------------------------------------------------
             /// @author S Downie
             ///
             /// @param Interface Id
@@ -169,6 +192,30 @@ namespace ChilliSource
             //--------------------------------------------------------------
             std::string ResolveFilePath(StorageLocation in_location, const std::string& in_basePath) const;
             //--------------------------------------------------------------
+            /// Clears all cached directory listings and resolved paths.
+            /// This must be called if files are added to or removed from
+            /// the package, ChilliSource or DLC storage locations, for
+            /// example after installing DLC. This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            //--------------------------------------------------------------
+            void ClearCache();
+            //--------------------------------------------------------------
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The statistics for all resolutions performed since
+            /// the statistics were last reset.
+            //--------------------------------------------------------------
+            Statistics GetStatistics() const;
+            //--------------------------------------------------------------
+            /// Resets the resolution statistics. This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            //--------------------------------------------------------------
+            void ResetStatistics();
+            //--------------------------------------------------------------
             /// Returns the active tag for the given Tag Group.
             ///
             /// @author Ian Copland
@@ -209,6 +256,32 @@ namespace ChilliSource
             /// @param Screen size
             //--------------------------------------------------------------
             void DetermineScreenDependentTags(const Vector2& in_size);
+            //--------------------------------------------------------------
+            /// Performs the resolution of the given path without
+            /// consulting the resolved path cache.
+            ///
+            /// @author S Downie
+            ///
+            /// @param Storage location
+            /// @param Base file path (i.e. Textures/MyImage.png)
+            ///
+            /// @return The best-fit filename.
+            //--------------------------------------------------------------
+            std::string ResolveFilePathUncached(StorageLocation in_location, const std::string& in_basePath) const;
+            //--------------------------------------------------------------
+            /// Returns the paths of all files in the given directory with
+            /// the given extension. The listing is cached for cacheable
+            /// storage locations.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Storage location
+            /// @param The directory path.
+            /// @param The file extension.
+            ///
+            /// @return The file paths, relative to the directory.
+            //--------------------------------------------------------------
+            std::vector<std::string> GetDirectoryListing(StorageLocation in_location, const std::string& in_directoryPath, const std::string& in_extension) const;
             
         private:
             
@@ -222,6 +295,11 @@ namespace ChilliSource
             std::string m_activeTags[(u32)TagGroup::k_total];
             
             u32 m_priorityIndices[(u32)TagGroup::k_total];
+            
+            mutable std::mutex m_cacheMutex;
+            mutable std::unordered_map<std::string, std::vector<std::string>> m_directoryListings;
+            mutable std::unordered_map<std::string, std::string> m_resolvedPaths;
+            mutable Statistics m_statistics;
 		};
 	}
 		
@@ -26,24 +26,40 @@
 //  THE SOFTWARE.
 //
 
-#ifdef CS_TARGETPLATFORM_ANDROID
+#include <ChilliSource/Core/File/VirtualFileStream.h>
 
-#include <CSBackend/Platform/Android/Main/JNI/Core/File/VirtualFileStream.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
 
-namespace CSBackend
+#include <iterator>
+
+namespace ChilliSource
 {
-	namespace Android 
+	namespace Core
 	{
 		//------------------------------------------------------------------------------
 		//------------------------------------------------------------------------------
-		VirtualFileStream::VirtualFileStream(std::unique_ptr<u8[]> in_buffer, u32 in_bufferSize, CSCore::FileMode in_fileMode)
+		VirtualFileStream::VirtualFileStream(std::unique_ptr<u8[]> in_buffer, u64 in_bufferSize, FileMode in_fileMode)
+			: m_stream(&m_streamBuffer)
 		{
-			CS_ASSERT(in_fileMode == CSCore::FileMode::k_read || in_fileMode == CSCore::FileMode::k_readBinary, "Virtual file stream only supports read file modes.");
+			CS_ASSERT(in_fileMode == FileMode::k_read || in_fileMode == FileMode::k_readBinary, "Virtual file stream only supports read file modes.");
             CS_ASSERT(in_buffer != nullptr, "Cannot create a virtual file stream with a null buffer.");
             CS_ASSERT(in_bufferSize > 0, "Invalid buffer size.");
 
 			m_buffer = std::move(in_buffer);
-			m_stream.rdbuf()->pubsetbuf(reinterpret_cast<s8*>(m_buffer.get()), in_bufferSize);
+			m_streamBuffer.SetData(m_buffer.get(), in_bufferSize);
+
+			m_isValid = true;
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		VirtualFileStream::VirtualFileStream(const MemoryMappedFileCSPtr& in_file, FileMode in_fileMode)
+			: m_stream(&m_streamBuffer)
+		{
+			CS_ASSERT(in_fileMode == FileMode::k_read || in_fileMode == FileMode::k_readBinary, "Virtual file stream only supports read file modes.");
+			CS_ASSERT(in_file != nullptr, "Cannot create a virtual file stream with a null file.");
+
+			m_file = in_file;
+			m_streamBuffer.SetData(m_file->GetData(), m_file->GetSize());
 
 			m_isValid = true;
 		}
@@ -83,7 +99,7 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// Get
 		//--------------------------------------------------------------------------------------------------
-		void VirtualFileStream::Get(s8 * outpbyString, s32 indwStreamSize)
+		void VirtualFileStream::Get(s8 * outpbyString, s64 indwStreamSize)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -92,7 +108,7 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// Get
 		//--------------------------------------------------------------------------------------------------
-		void VirtualFileStream::Get(s8 * outpbyString, s32 indwStreamSize, s8 inbyDelim)
+		void VirtualFileStream::Get(s8 * outpbyString, s64 indwStreamSize, s8 inbyDelim)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -114,7 +130,11 @@ namespace CSBackend
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
-			outstrString = m_stream.str().substr(m_stream.tellg());
+			//read the remainder of the stream without moving the read position.
+			auto position = m_stream.tellg();
+			outstrString.assign(std::istreambuf_iterator<s8>(m_stream), std::istreambuf_iterator<s8>());
+			m_stream.clear();
+			m_stream.seekg(position);
 		}
 		//--------------------------------------------------------------------------------------------------
 		/// Get
@@ -128,7 +148,7 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// Get Line
 		//--------------------------------------------------------------------------------------------------
-		void VirtualFileStream::GetLine(s8 * outpbyString, s32 indwStreamSize)
+		void VirtualFileStream::GetLine(s8 * outpbyString, s64 indwStreamSize)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -137,7 +157,7 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// Get Line
 		//--------------------------------------------------------------------------------------------------
-		void VirtualFileStream::GetLine(s8 * outpbyString, s32 indwStreamSize, s8 inbyDelim)
+		void VirtualFileStream::GetLine(s8 * outpbyString, s64 indwStreamSize, s8 inbyDelim)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -146,7 +166,7 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// Ignore
 		//--------------------------------------------------------------------------------------------------
-		void VirtualFileStream::Ignore(s32 indwStreamSize, s8 inbyDelim)
+		void VirtualFileStream::Ignore(s64 indwStreamSize, s8 inbyDelim)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -164,7 +184,7 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// Read
 		//--------------------------------------------------------------------------------------------------
-		void VirtualFileStream::Read(s8* inpbyBuffer, s32 indwStreamSize)
+		void VirtualFileStream::Read(s8* inpbyBuffer, s64 indwStreamSize)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -191,7 +211,7 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// TellG
 		//--------------------------------------------------------------------------------------------------
-		s32 VirtualFileStream::TellG()
+		s64 VirtualFileStream::TellG()
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -200,7 +220,7 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// SeekG
 		//--------------------------------------------------------------------------------------------------
-		void VirtualFileStream::SeekG(s32 indwPosition)
+		void VirtualFileStream::SeekG(s64 indwPosition)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -209,7 +229,7 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// SeekG
 		//--------------------------------------------------------------------------------------------------
-		void VirtualFileStream::SeekG(s32 indwPosition, CSCore::SeekDir ineDir)
+		void VirtualFileStream::SeekG(s64 indwPosition, SeekDir ineDir)
 		{
         	CS_ASSERT(IsValid() == true, "Trying to use an invalid FileStream.");
 
@@ -217,13 +237,13 @@ namespace CSBackend
 			switch (ineDir)
 			{
 				default:
-				case CSCore::SeekDir::k_beginning:
+				case SeekDir::k_beginning:
 					dir = std::ios_base::beg;
 					break;
-				case CSCore::SeekDir::k_current:
+				case SeekDir::k_current:
 					dir = std::ios_base::cur;
 					break;
-				case CSCore::SeekDir::k_end:
+				case SeekDir::k_end:
 					dir = std::ios_base::end;
 					break;
 			}
@@ -248,7 +268,7 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// Write
 		//--------------------------------------------------------------------------------------------------
-		void VirtualFileStream::Write(const s8* inpbyChar, s32 indwStreamSize)
+		void VirtualFileStream::Write(const s8* inpbyChar, s64 indwStreamSize)
 		{
         	CS_LOG_FATAL("Cannot write to a virtual file stream.");
 		}
@@ -262,7 +282,7 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// TellP
 		//--------------------------------------------------------------------------------------------------
-		s32 VirtualFileStream::TellP()
+		s64 VirtualFileStream::TellP()
 		{
 			CS_LOG_FATAL("A virtual file stream does not have a 'put' position to get.");
 
@@ -271,14 +291,14 @@ namespace CSBackend
 		//--------------------------------------------------------------------------------------------------
 		/// SeekP
 		//--------------------------------------------------------------------------------------------------
-		void VirtualFileStream::SeekP(s32 indwPosition)
+		void VirtualFileStream::SeekP(s64 indwPosition)
 		{
         	CS_LOG_FATAL("A virtual file stream does not have a 'put' position to seek.");
 		}
 		//--------------------------------------------------------------------------------------------------
 		/// SeekP
 		//--------------------------------------------------------------------------------------------------
-		void VirtualFileStream::SeekP(s32 indwPosition, CSCore::SeekDir ineDir)
+		void VirtualFileStream::SeekP(s64 indwPosition, SeekDir ineDir)
 		{
         	CS_LOG_FATAL("A virtual file stream does not have a 'put' position to seek.");
 		}
@@ -295,11 +315,55 @@ namespace CSBackend
 		{
 			if(IsValid() == true)
 			{
-			    m_stream.str(std::string());
 			    m_buffer.reset();
+			    m_file.reset();
+			}
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		void VirtualFileStream::StreamBuffer::SetData(const u8* in_data, u64 in_dataSize)
+		{
+			s8* data = reinterpret_cast<s8*>(const_cast<u8*>(in_data));
+			setg(data, data, data + in_dataSize);
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		VirtualFileStream::StreamBuffer::pos_type VirtualFileStream::StreamBuffer::seekoff(off_type in_offset, std::ios_base::seekdir in_dir, std::ios_base::openmode in_mode)
+		{
+			if ((in_mode & std::ios_base::in) == 0)
+			{
+				return pos_type(off_type(-1));
 			}
+
+			s8* base = nullptr;
+			switch (in_dir)
+			{
+				case std::ios_base::beg:
+					base = eback();
+					break;
+				case std::ios_base::cur:
+					base = gptr();
+					break;
+				case std::ios_base::end:
+					base = egptr();
+					break;
+				default:
+					return pos_type(off_type(-1));
+			}
+
+			if (in_offset < eback() - base || in_offset > egptr() - base)
+			{
+				return pos_type(off_type(-1));
+			}
+
+			setg(eback(), base + in_offset, egptr());
+			return pos_type(gptr() - eback());
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		VirtualFileStream::StreamBuffer::pos_type VirtualFileStream::StreamBuffer::seekpos(pos_type in_position, std::ios_base::openmode in_mode)
+		{
+			return seekoff(off_type(in_position), std::ios_base::beg, in_mode);
 		}
 	}
 }
-
-#endif
@@ -26,26 +26,27 @@
 //  THE SOFTWARE.
 //
 
-#ifdef CS_TARGETPLATFORM_ANDROID
-
-#ifndef _CSBACKEND_PLATFORM_ANDROID_MAIN_CORE_FILE_VIRTUALFILESTREAM_H_
-#define _CSBACKEND_PLATFORM_ANDROID_MAIN_CORE_FILE_VIRTUALFILESTREAM_H_
+#ifndef _CHILLISOURCE_CORE_FILE_VIRTUALFILESTREAM_H_
+#define _CHILLISOURCE_CORE_FILE_VIRTUALFILESTREAM_H_
 
+#include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/File/FileStream.h>
 
-#include <fstream>
 #include <ios>
+#include <istream>
 #include <sstream>
+#include <streambuf>
 
-namespace CSBackend
+namespace ChilliSource
 {
-	namespace Android
+	namespace Core
 	{
 		//--------------------------------------------------------------------------------------------------
-		/// A filestream is used for all reading and writing of files. This will emulate the functionality
-		/// of fstream and allows for cross platform filereading.
+		/// A read-only file stream into a block of memory, used for files which don't exist as loose
+		/// files on disk, such as those inside a zip or packed archive. The memory is read in place;
+		/// the stream doesn't copy it.
 		//--------------------------------------------------------------------------------------------------
-		class VirtualFileStream final : public CSCore::FileStream
+		class VirtualFileStream final : public FileStream
 		{
 		public:
 			//------------------------------------------------------------------------------
@@ -58,7 +59,19 @@ namespace CSBackend
 			/// @param in_bufferSize - The size of the memory buffer.
 			/// @param in_fileMode - The file mode with which the "file" should be opened.
 			//------------------------------------------------------------------------------
-			VirtualFileStream(std::unique_ptr<u8[]> in_buffer, u32 in_bufferSize, CSCore::FileMode in_fileMode);
+			VirtualFileStream(std::unique_ptr<u8[]> in_buffer, u64 in_bufferSize, FileMode in_fileMode);
+			//------------------------------------------------------------------------------
+			/// Constructor. Creates a new file stream into the contents of the given
+			/// memory mapped file. The memory mapped file is kept alive for the lifetime
+			/// of the stream. The file may be empty.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param in_file - The memory mapped file which will be used as a "virtual"
+			/// file.
+			/// @param in_fileMode - The file mode with which the "file" should be opened.
+			//------------------------------------------------------------------------------
+			VirtualFileStream(const MemoryMappedFileCSPtr& in_file, FileMode in_fileMode);
 			//------------------------------------------------------------------------------
 			/// This should be called immediately after construction, before calling any
 			/// other file stream methods. If this returns false the FileStream should be
@@ -98,7 +111,7 @@ namespace CSBackend
 			/// @param buffer for the output string.
 			/// @param The amount of bytes to read into the buffer.
 			//--------------------------------------------------------------------------------------------------
-			void Get(s8 * outpbyString, s32 indwStreamSize) override;
+			void Get(s8 * outpbyString, s64 indwStreamSize) override;
 			//--------------------------------------------------------------------------------------------------
 			/// Get
 			///
@@ -109,7 +122,7 @@ namespace CSBackend
 			/// @param The amount of bytes to read into the buffer.
 			/// @param The delimiting character.
 			//--------------------------------------------------------------------------------------------------
-			void Get(s8 * outpbyString, s32 indwStreamSize, s8 inbyDelim) override;
+			void Get(s8 * outpbyString, s64 indwStreamSize, s8 inbyDelim) override;
 			//--------------------------------------------------------------------------------------------------
 			/// Get Line
 			///
@@ -142,7 +155,7 @@ namespace CSBackend
 			/// @param buffer for the output string.
 			/// @param The amount of bytes to read into the buffer.
 			//--------------------------------------------------------------------------------------------------
-			void GetLine(s8 * outpbyString, s32 indwStreamSize) override;
+			void GetLine(s8 * outpbyString, s64 indwStreamSize) override;
 			//--------------------------------------------------------------------------------------------------
 			/// Get Line
 			///
@@ -153,7 +166,7 @@ namespace CSBackend
 			/// @param The amount of bytes to read into the buffer.
 			/// @param The delimiting character.
 			//--------------------------------------------------------------------------------------------------
-			void GetLine(s8 * outpbyString, s32 indwStreamSize, s8 inbyDelim) override;
+			void GetLine(s8 * outpbyString, s64 indwStreamSize, s8 inbyDelim) override;
 			//--------------------------------------------------------------------------------------------------
 			/// Ignore
 			///
@@ -163,7 +176,7 @@ namespace CSBackend
 			/// @param The amount of bytes to read into the buffer.
 			/// @param The delimiting character.
 			//--------------------------------------------------------------------------------------------------
-			void Ignore(s32 indwStreamSize = 1, s8 inbyDelim = EOF) override;
+			void Ignore(s64 indwStreamSize = 1, s8 inbyDelim = EOF) override;
 			//--------------------------------------------------------------------------------------------------
 			/// Peek
 			///
@@ -181,7 +194,7 @@ namespace CSBackend
 			/// @param The buffer.
 			/// @param the stream size.
 			//--------------------------------------------------------------------------------------------------
-			void Read(s8* inpbyBuffer, s32 indwStreamSize) override;
+			void Read(s8* inpbyBuffer, s64 indwStreamSize) override;
 			//--------------------------------------------------------------------------------------------------
 			/// Put Back
 			///
@@ -201,7 +214,7 @@ namespace CSBackend
 			///
 			/// @return the absolute position of the get pointer.
 			//--------------------------------------------------------------------------------------------------
-			s32 TellG() override;
+			s64 TellG() override;
 			//--------------------------------------------------------------------------------------------------
 			/// SeekG
 			///
@@ -209,7 +222,7 @@ namespace CSBackend
 			///
 			/// @param the new position.
 			//--------------------------------------------------------------------------------------------------
-			void SeekG(s32 indwPosition) override;
+			void SeekG(s64 indwPosition) override;
 			//--------------------------------------------------------------------------------------------------
 			/// SeekG
 			///
@@ -218,7 +231,7 @@ namespace CSBackend
 			/// @param the new position.
 			/// @param the direction from which to seek.
 			//--------------------------------------------------------------------------------------------------
-			void SeekG(s32 indwPosition, CSCore::SeekDir ineDir) override;
+			void SeekG(s64 indwPosition, SeekDir ineDir) override;
 			//--------------------------------------------------------------------------------------------------
 			/// Sync
 			///
@@ -241,7 +254,7 @@ namespace CSBackend
 			/// @param the data buffer.
 			/// @param the stream size.
 			//--------------------------------------------------------------------------------------------------
-			void Write(const s8* inpbyChar, s32 indwStreamSize) override;
+			void Write(const s8* inpbyChar, s64 indwStreamSize) override;
 			//--------------------------------------------------------------------------------------------------
 			/// Write
 			///
@@ -255,7 +268,7 @@ namespace CSBackend
 			///
 			/// @return the currently position of the put pointer
 			//--------------------------------------------------------------------------------------------------
-			s32 TellP() override;
+			s64 TellP() override;
 			//--------------------------------------------------------------------------------------------------
 			/// SeekP
 			///
@@ -263,7 +276,7 @@ namespace CSBackend
 			///
 			/// @param the new position.
 			//--------------------------------------------------------------------------------------------------
-			void SeekP(s32 indwPosition) override;
+			void SeekP(s64 indwPosition) override;
 			//--------------------------------------------------------------------------------------------------
 			/// SeekP
 			///
@@ -272,7 +285,7 @@ namespace CSBackend
 			/// @param the new position.
 			/// @param the direction from which to seek.
 			//--------------------------------------------------------------------------------------------------
-			void SeekP(s32 indwPosition, CSCore::SeekDir ineDir) override;
+			void SeekP(s64 indwPosition, SeekDir ineDir) override;
 			//--------------------------------------------------------------------------------------------------
 			/// Flush
 			///
@@ -287,14 +300,59 @@ namespace CSBackend
 			virtual ~VirtualFileStream();
 
 		private:
+			//------------------------------------------------------------------------------
+			/// A read-only stream buffer which reads directly from a block of memory.
+			/// Unlike a std::stringbuf this doesn't copy the memory, and unlike using
+			/// pubsetbuf() on a std::stringbuf its behaviour is well defined on all
+			/// platforms.
+			///
+			/// @author Carlos Artesano
+			//------------------------------------------------------------------------------
+			class StreamBuffer final : public std::streambuf
+			{
+			public:
+				//------------------------------------------------------------------------------
+				/// Sets the memory the buffer reads from.
+				///
+				/// @author Carlos Artesano
+				///
+				/// @param in_data - The data.
+				/// @param in_dataSize - The size of the data.
+				//------------------------------------------------------------------------------
+				void SetData(const u8* in_data, u64 in_dataSize);
+
+			protected:
+				//------------------------------------------------------------------------------
+				/// Moves the read position relative to the given direction.
+				///
+				/// @author Carlos Artesano
+				///
+				/// @param in_offset - The offset.
+				/// @param in_dir - The direction the offset is relative to.
+				/// @param in_mode - The open mode. Only the input mode is supported.
+				///
+				/// @return The new position, or -1 if the seek failed.
+				//------------------------------------------------------------------------------
+				pos_type seekoff(off_type in_offset, std::ios_base::seekdir in_dir, std::ios_base::openmode in_mode) override;
+				//------------------------------------------------------------------------------
+				/// Moves the read position to the given absolute position.
+				///
+				/// @author Carlos Artesano
+				///
+				/// @param in_position - The position.
+				/// @param in_mode - The open mode. Only the input mode is supported.
+				///
+				/// @return The new position, or -1 if the seek failed.
+				//------------------------------------------------------------------------------
+				pos_type seekpos(pos_type in_position, std::ios_base::openmode in_mode) override;
+			};
 
 			std::unique_ptr<u8[]> m_buffer;
-			std::stringstream m_stream;
+			MemoryMappedFileCSPtr m_file;
+			StreamBuffer m_streamBuffer;
+			std::istream m_stream;
 		};
 	}
 }
 
-
-#endif
-
 #endif
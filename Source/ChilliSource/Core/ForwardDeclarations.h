@@ -71,6 +71,7 @@ namespace ChilliSource
         //---------------------------------------------------------
         template <typename TReturnType, typename... TArgTypes> class ConnectableDelegate;
         template <typename TReturnType, typename... TArgTypes> class DelegateConnection;
+        template <typename TSignature> class InlineDelegate;
         //---------------------------------------------------------
         /// Dialogue
         //---------------------------------------------------------
@@ -80,7 +81,9 @@ namespace ChilliSource
         //---------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(Component);
         CS_FORWARDDECLARE_CLASS(Entity);
+        CS_FORWARDDECLARE_CLASS(Prefab);
         CS_FORWARDDECLARE_CLASS(Transform);
+        CS_FORWARDDECLARE_CLASS(TransformHierarchy);
         //---------------------------------------------------------
         /// Event
         //---------------------------------------------------------
@@ -94,9 +97,15 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(FileStream);
         CS_FORWARDDECLARE_CLASS(FileSystem);
         CS_FORWARDDECLARE_CLASS(AppDataStore);
+        CS_FORWARDDECLARE_CLASS(AsyncFileReader);
         CS_FORWARDDECLARE_CLASS(TaggedFilePathResolver);
         CS_FORWARDDECLARE_CLASS(CSBinaryInputStream);
         CS_FORWARDDECLARE_CLASS(CSBinaryChunk);
+        CS_FORWARDDECLARE_CLASS(CSBinaryOutputStream);
+        CS_FORWARDDECLARE_CLASS(MemoryMappedFile);
+        CS_FORWARDDECLARE_CLASS(MemoryReader);
+        CS_FORWARDDECLARE_CLASS(PackedArchive);
+        CS_FORWARDDECLARE_CLASS(VirtualFileStream);
         enum class StorageLocation;
         //---------------------------------------------------------
         /// Image
@@ -127,6 +136,7 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(Line);
         CS_FORWARDDECLARE_CLASS(Plane);
         CS_FORWARDDECLARE_CLASS(Frustum);
+        CS_FORWARDDECLARE_CLASS(RandomEngine);
         CS_FORWARDDECLARE_STRUCT(UnifiedScalar);
 		CS_FORWARDDECLARE_STRUCT(UnifiedVector2);
 		CS_FORWARDDECLARE_STRUCT(UnifiedRectangle);
@@ -183,6 +193,8 @@ namespace ChilliSource
         /// Scene
         //---------------------------------------------------------
         CS_FORWARDDECLARE_CLASS(Scene);
+        CS_FORWARDDECLARE_CLASS(SceneLoader);
+        CS_FORWARDDECLARE_CLASS(SceneSerialiser);
         //---------------------------------------------------------
         /// State
         //---------------------------------------------------------
@@ -200,6 +212,9 @@ namespace ChilliSource
         CS_FORWARDDECLARE_CLASS(WaitCondition);
         CS_FORWARDDECLARE_CLASS(TaskScheduler);
         CS_FORWARDDECLARE_CLASS(ThreadPool);
+        CS_FORWARDDECLARE_CLASS(ReadWriteMutex);
+        CS_FORWARDDECLARE_CLASS(ReadLock);
+        CS_FORWARDDECLARE_CLASS(WriteLock);
         //---------------------------------------------------------
         /// Time
         //---------------------------------------------------------
@@ -30,6 +30,9 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+#include <ChilliSource/Core/File/AsyncFileReader.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+#include <ChilliSource/Core/File/MemoryReader.h>
 #include <ChilliSource/Core/Image/Image.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
@@ -121,39 +124,64 @@ namespace ChilliSource
                 return false;
             }
             //-------------------------------------------------------
-            /// Reads a version 3 formatted .csimage file
+            /// Reads a version 3 formatted .csimage file. Compressed
+            /// image data is inflated directly from the mapped file,
+            /// while uncompressed image data is used in place.
             ///
             /// @author S Downie
             ///
-            /// @param Pointer to image data file
+            /// @param The image file.
+            /// @param Reader positioned after the file version.
+            /// @param The file path.
             /// @param Pointer to resource destination
+            ///
+            /// @return Whether or not the image was successfully read.
             //-------------------------------------------------------
-			void ReadFileVersion3(const FileStreamSPtr& in_stream, const ResourceSPtr& out_resource)
+			bool ReadFileVersion3(const MemoryMappedFileCSPtr& in_file, MemoryReader& in_reader, const std::string& in_filepath, const ResourceSPtr& out_resource)
             {
+                const u32 k_headerSize = 32;
+                if (in_reader.GetRemainingSize() < k_headerSize)
+                {
+                    CS_LOG_ERROR("CSImage header is truncated: " + in_filepath);
+                    return false;
+                }
+                
                 //Read the header
                 ImageHeaderVersion3 sHeader;
-                in_stream->Read((s8*)&sHeader.m_width, sizeof(u32));
-                in_stream->Read((s8*)&sHeader.m_height, sizeof(u32));
-                in_stream->Read((s8*)&sHeader.m_imageFormat, sizeof(u32));
-                in_stream->Read((s8*)&sHeader.m_compression, sizeof(u32));
-                in_stream->Read((s8*)&sHeader.m_checksum, sizeof(u64));
-                in_stream->Read((s8*)&sHeader.m_originalDataSize, sizeof(u32));
-                in_stream->Read((s8*)&sHeader.m_compressedDataSize, sizeof(u32));
+                sHeader.m_width = in_reader.Read<u32>();
+                sHeader.m_height = in_reader.Read<u32>();
+                sHeader.m_imageFormat = in_reader.Read<u32>();
+                sHeader.m_compression = in_reader.Read<u32>();
+                sHeader.m_checksum = in_reader.Read<u64>();
+                sHeader.m_originalDataSize = in_reader.Read<u32>();
+                sHeader.m_compressedDataSize = in_reader.Read<u32>();
                 
                 u32 udwSize = 0;
                 ImageFormat eFormat = ImageFormat::k_RGBA8888;
                 bool bFoundFormat = GetFormatInfo(sHeader.m_imageFormat, sHeader.m_width, sHeader.m_height, eFormat, udwSize);
                 CS_ASSERT(bFoundFormat, "Invalid CSImage Format.");
                 
-                u8* pubyBitmapData = nullptr;
+                Image::Descriptor desc;
+                desc.m_format = eFormat;
+                desc.m_compression = ImageCompression::k_none;
+                desc.m_width = sHeader.m_width;
+                desc.m_height = sHeader.m_height;
+                desc.m_dataSize = udwSize;
+                
+                Image* outpImage = (Image*)out_resource.get();
+                
                 if(sHeader.m_compression != 0)
                 {
-                    // Allocated memory needed for the compressed image data
-                    u8* pubyCompressedData = (u8*)malloc(sHeader.m_compressedDataSize);
-                    in_stream->Read((s8*)pubyCompressedData, sHeader.m_compressedDataSize);
+                    if (in_reader.GetRemainingSize() < sHeader.m_compressedDataSize)
+                    {
+                        CS_LOG_ERROR("CSImage data is truncated: " + in_filepath);
+                        return false;
+                    }
+                    
+                    const u8* pubyCompressedData = in_reader.Read(sHeader.m_compressedDataSize);
                     
                     // Allocated memory need for for the bitmap context
-                    pubyBitmapData = new u8[sHeader.m_originalDataSize];
+                    Image::ImageDataUPtr imageData(new u8[sHeader.m_originalDataSize]);
                     
                     // Inflate data (I like to think this is the machine equvilent to eating lots of pizza!)
                     z_stream infstream;
@@ -161,81 +189,74 @@ namespace ChilliSource
                     infstream.zfree = Z_NULL;
                     infstream.opaque = Z_NULL;
                     infstream.avail_in = sHeader.m_compressedDataSize;		// size of input
-                    infstream.next_in = (Bytef*)pubyCompressedData;			// input data
+                    infstream.next_in = const_cast<Bytef*>(pubyCompressedData);	// input data
                     infstream.avail_out = sHeader.m_originalDataSize;		// size of output
-                    infstream.next_out = (Bytef*)pubyBitmapData;			// output char array
+                    infstream.next_out = (Bytef*)imageData.get();			// output char array
                     
                     inflateInit(&infstream);
                     inflate(&infstream, Z_FINISH);
                     inflateEnd(&infstream);
                     
                     // Checksum test
-                    u32 udwInflatedChecksum = HashCRC32::GenerateHashCode((const s8*)pubyBitmapData, sHeader.m_originalDataSize);
+                    u32 udwInflatedChecksum = HashCRC32::GenerateHashCode((const s8*)imageData.get(), sHeader.m_originalDataSize);
                     if(sHeader.m_checksum != (u64)udwInflatedChecksum)
                     {
                         CS_LOG_ERROR("CSImage checksum of "+ToString(udwInflatedChecksum)+" does not match expected checksum "+ToString(sHeader.m_checksum));
                     }
                     
-                    free(pubyCompressedData);
+                    outpImage->Build(desc, std::move(imageData));
                 }
                 else
                 {
-                    // Allocated memory needed for the bitmap context
-                    pubyBitmapData = new u8[sHeader.m_originalDataSize];;
-                    in_stream->Read((s8*)pubyBitmapData, udwSize);
+                    if (in_reader.GetRemainingSize() < udwSize)
+                    {
+                        CS_LOG_ERROR("CSImage data is truncated: " + in_filepath);
+                        return false;
+                    }
+                    
+                    // Uncompressed data is used directly from the file.
+                    outpImage->Build(desc, in_file, in_reader.Read(udwSize));
                 }
                 
-                Image::ImageDataUPtr imageData(pubyBitmapData);
-                
-                Image::Descriptor desc;
-                desc.m_format = eFormat;
-                desc.m_compression = ImageCompression::k_none;
-                desc.m_width = sHeader.m_width;
-                desc.m_height = sHeader.m_height;
-                desc.m_dataSize = udwSize;
-                
-                Image* outpImage = (Image*)out_resource.get();
-                outpImage->Build(desc, std::move(imageData));
+                return true;
             }
             //----------------------------------------------------
             /// Performs the heavy lifting for the 2 create methods
             ///
             /// @author S Downie
             ///
-            /// @param The storage location.
+            /// @param The image file. Null if it could not be read.
             /// @param The filepath.
             /// @param Completion delegate
             /// @param [Out] The output resource.
             //----------------------------------------------------
-			void LoadImage(StorageLocation in_storageLocation, const std::string& in_filepath, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
+			void LoadImage(const MemoryMappedFileCSPtr& in_imageFile, const std::string& in_filepath, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
             {
-                FileStreamSPtr pImageFile = Application::Get()->GetFileSystem()->CreateFileStream(in_storageLocation, in_filepath, FileMode::k_readBinary);
-                
-                if(pImageFile == nullptr)
+                bool success = false;
+                if(in_imageFile != nullptr)
                 {
-                    out_resource->SetLoadState(Resource::LoadState::k_failed);
-                    if(in_delegate != nullptr)
+                    MemoryReader reader(in_imageFile->GetData(), in_imageFile->GetSize());
+                    
+                    const u32 k_preambleSize = 8;
+                    if (reader.GetRemainingSize() >= k_preambleSize)
                     {
-						Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
+                        //Read the byte order mark and ensure it is 123456
+                        u32 udwByteOrder = reader.Read<u32>();
+                        CS_ASSERT(udwByteOrder == 123456, "Endianess not supported");
+                        
+                        //Read the version
+                        u32 udwVersion = reader.Read<u32>();
+                        CS_ASSERT(udwVersion >= 3, "Only version 3 and above supported");
+                        
+                        success = ReadFileVersion3(in_imageFile, reader, in_filepath, out_resource);
+                    }
+                    else
+                    {
+                        CS_LOG_ERROR("CSImage file is too small: " + in_filepath);
                     }
-                    return;
                 }
                 
-                //Read the byte order mark and ensure it is 123456
-                u32 udwByteOrder = 0;
-                pImageFile->Read((s8*)&udwByteOrder, sizeof(u32));
-                CS_ASSERT(udwByteOrder == 123456, "Endianess not supported");
-                
-                //Read the version
-                u32 udwVersion = 0;
-                pImageFile->Read((s8*)&udwVersion, sizeof(u32));
-                CS_ASSERT(udwVersion >= 3, "Only version 3 and above supported");
-   
-                ReadFileVersion3(pImageFile, out_resource);
-
-                pImageFile.reset();
-                
-                out_resource->SetLoadState(Resource::LoadState::k_loaded);
+                out_resource->SetLoadState(success ? Resource::LoadState::k_loaded : Resource::LoadState::k_failed);
                 if(in_delegate != nullptr)
                 {
 					auto task = std::bind(in_delegate, out_resource);
@@ -273,14 +294,21 @@ namespace ChilliSource
         //-------------------------------------------------------
 		void CSImageProvider::CreateResourceFromFile(StorageLocation in_storageLocation, const std::string& in_filepath, const IResourceOptionsBaseCSPtr& in_options, const ResourceSPtr& out_resource)
         {
-            LoadImage(in_storageLocation, in_filepath, nullptr, out_resource);
+            MemoryMappedFileCSPtr imageFile = Application::Get()->GetFileSystem()->CreateMemoryMappedFile(in_storageLocation, in_filepath);
+            LoadImage(imageFile, in_filepath, nullptr, out_resource);
         }
         //----------------------------------------------------
         //----------------------------------------------------
 		void CSImageProvider::CreateResourceFromFileAsync(StorageLocation in_storageLocation, const std::string& in_filepath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
         {
-			auto task = std::bind(LoadImage, in_storageLocation, in_filepath, in_delegate, out_resource);
-            Application::Get()->GetTaskScheduler()->ScheduleTask(task);
+            AsyncFileReader* asyncFileReader = Application::Get()->GetSystem<AsyncFileReader>();
+            CS_ASSERT(asyncFileReader != nullptr, "CSImageProvider is missing required system: AsyncFileReader.");
+            
+            //The file is read on the IO thread and decoded on a background thread once the read completes.
+            asyncFileReader->ReadFile(in_storageLocation, in_filepath, [=](const AsyncFileReader::ReadResult& in_result)
+            {
+                LoadImage(in_result.m_file, in_filepath, in_delegate, out_resource);
+            });
         }
     }
 }
@@ -105,7 +105,7 @@ namespace ChilliSource
                 //get the size of the rest of the data
                 const u32 kstrHeaderSize = 16;
                 pImageFile->SeekG(0, SeekDir::k_end);
-                u32 dwDataSize = pImageFile->TellG() - kstrHeaderSize;
+                u32 dwDataSize = static_cast<u32>(pImageFile->TellG()) - kstrHeaderSize;
                 pImageFile->SeekG(kstrHeaderSize, SeekDir::k_beginning);
                 
                 //read the rest of the data
@@ -28,9 +28,13 @@
 
 #include <ChilliSource/Core/Image/Image.h>
 
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
 
+#include <cstring>
+
 namespace ChilliSource
 {
 	namespace Core
@@ -55,6 +59,20 @@ namespace ChilliSource
         {
             m_dataDesc = in_desc;
             m_imageData = std::move(in_imageData);
+            m_backingFile.reset();
+            m_mappedImageData = nullptr;
+        }
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        void Image::Build(const Descriptor& in_desc, const MemoryMappedFileCSPtr& in_backingFile, const u8* in_imageData)
+        {
+            CS_ASSERT(in_backingFile != nullptr, "Cannot build image from null backing file.");
+            CS_ASSERT(in_imageData >= in_backingFile->GetData() && in_imageData + in_desc.m_dataSize <= in_backingFile->GetData() + in_backingFile->GetSize(), "Image data must reside within the backing file.");
+            
+            m_dataDesc = in_desc;
+            m_imageData.reset();
+            m_backingFile = in_backingFile;
+            m_mappedImageData = in_imageData;
         }
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
@@ -78,12 +96,21 @@ namespace ChilliSource
 		//----------------------------------------------------------------
 		const u8* Image::GetData() const
 		{
-			return m_imageData.get();
+			return (m_imageData != nullptr) ? m_imageData.get() : m_mappedImageData;
 		}
         //----------------------------------------------------------------
         //----------------------------------------------------------------
         Image::ImageDataUPtr&& Image::MoveData()
         {
+            if (m_imageData == nullptr && m_mappedImageData != nullptr)
+            {
+                m_imageData = ImageDataUPtr(new u8[m_dataDesc.m_dataSize]);
+                memcpy(m_imageData.get(), m_mappedImageData, m_dataDesc.m_dataSize);
+                
+                m_backingFile.reset();
+                m_mappedImageData = nullptr;
+            }
+            
             return std::move(m_imageData);
         }
 		//----------------------------------------------------------------
@@ -98,5 +125,11 @@ namespace ChilliSource
 		{
 			return m_dataDesc.m_dataSize;
 		}
+        //----------------------------------------------------------------
+        //----------------------------------------------------------------
+        u64 Image::GetMemoryUsage() const
+        {
+            return (m_imageData != nullptr) ? static_cast<u64>(m_dataDesc.m_dataSize) : 0;
+        }
 	}
 }
@@ -81,6 +81,19 @@ namespace ChilliSource
             /// @param Image data
             //----------------------------------------------------------------
             void Build(const Descriptor& in_desc, ImageDataUPtr in_imageData);
+            //----------------------------------------------------------------
+            /// Populate the image with data which resides in the given
+            /// memory mapped file. The image data is used in place rather
+            /// than copied, and the image keeps the file alive for as long
+            /// as it is required.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Image data descriptor
+            /// @param The file the image data resides in.
+            /// @param A pointer to the image data within the file.
+            //----------------------------------------------------------------
+            void Build(const Descriptor& in_desc, const MemoryMappedFileCSPtr& in_backingFile, const u8* in_imageData);
 			//----------------------------------------------------------------
 			/// @author S Downie
 			///
@@ -120,6 +133,15 @@ namespace ChilliSource
 			/// @return Image data.
 			//----------------------------------------------------------------
 			const u8* GetData() const;
+            //----------------------------------------------------------------
+            /// Image data which resides in a memory mapped file is not
+            /// included as the OS is free to discard the mapped pages.
+            ///
+            /// @author Carlos Artesano
+			///
+			/// @return The memory used by the image data in bytes.
+			//----------------------------------------------------------------
+            u64 GetMemoryUsage() const override;
             
         private:
             friend class ResourcePool;
@@ -142,6 +164,9 @@ namespace ChilliSource
             //----------------------------------------------------------------
             Image() = default;
             //----------------------------------------------------------------
+            /// If the image data resides in a memory mapped file it is
+            /// copied into a new buffer before ownership is passed.
+            ///
             /// @author S Downie
 			///
 			/// @return Ownership of image data.
@@ -153,6 +178,8 @@ namespace ChilliSource
             Descriptor m_dataDesc;
             
             ImageDataUPtr m_imageData;
+            MemoryMappedFileCSPtr m_backingFile;
+            const u8* m_mappedImageData = nullptr;
 		};
 		
 	}
@@ -37,7 +37,8 @@
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Vector4.h>
 
-#include <mutex>
+#include <atomic>
+#include <random>
 
 #ifdef CS_TARGETPLATFORM_IOS
 #import <Foundation/Foundation.h>
@@ -51,29 +52,22 @@ namespace ChilliSource
 		namespace
 		{
             //----------------------------------------------------------------
-            /// This generates a random seed for the thread local random
-            /// number generators.
+            /// Generates a non-deterministic base seed from which the seeds
+            /// of all engines are derived.
             ///
             /// @author Ian Copland
             ///
-            /// @return A randomly generated 32-bit integer.
+            /// @return A randomly generated 64-bit integer.
             //----------------------------------------------------------------
-            u32 GenerateSeed()
+            u64 GenerateBaseSeed()
             {
-                static std::mt19937* g_seedGenerator = nullptr;
-                static std::mutex g_seedMutex;
-                
-                std::unique_lock<std::mutex> lock(g_seedMutex);
-                
-                if (g_seedGenerator == nullptr)
-                {
-                    g_seedGenerator = new std::mt19937(std::random_device()());
-                }
-                
-                std::uniform_int_distribution<u32> distribution(std::numeric_limits<u32>::min(), std::numeric_limits<u32>::max());
-                return distribution(*g_seedGenerator);
+                std::random_device randomDevice;
+                return (u64(randomDevice()) << 32) | u64(randomDevice());
             }
             
+            std::atomic<u64> g_baseSeed(GenerateBaseSeed());
+            std::atomic<u64> g_seedCounter(0);
+            
 #ifdef CS_TARGETPLATFORM_IOS
             //----------------------------------------------------------------
             /// iOS doesn't support C++ thread_local so we have to use the
@@ -83,30 +77,143 @@ namespace ChilliSource
             //----------------------------------------------------------------
             const char k_rngKey[] = "_threadLocalRNG";
             
+            //----------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The thread local engine container, creating it if it
+            /// doesn't already exist.
+            //----------------------------------------------------------------
+            RNGContainer* GetRNGContainer()
+            {
+                @autoreleasepool
+                {
+                    NSMutableDictionary* threadLocalDict = [[NSThread currentThread] threadDictionary];
+                    
+                    NSString* key = [NSString stringWithCString:k_rngKey encoding:NSUTF8StringEncoding];
+                    RNGContainer* rngContainer = (RNGContainer*)[threadLocalDict objectForKey:key];
+                    if (rngContainer == nil)
+                    {
+                        RandomEngine newRandomEngine(Random::GenerateSeed());
+                        rngContainer = [[RNGContainer alloc] initWithRNG:newRandomEngine];
+                        [threadLocalDict setObject:rngContainer forKey:key];
+                        [rngContainer release];
+                    }
+                    
+                    return rngContainer;
+                }
+            }
+            
 #elif defined (CS_TARGETPLATFORM_WINDOWS)
             //----------------------------------------------------------------
             /// Visual C++ doesn't support thread_local yet, so the compiler
             /// specific version should be used instead. This doesn't support
 			/// storage of objects that have a contructor so we are storing 
-			/// the RNG as a pointer and allocating it lazily when it's first 
-			/// used. To ensure that the RNG is cleaned up when the thread is 
-			/// destroyed, placement new is used to store the RNG in an array.
-			/// The RNG doesn't have a destructor, so this should be safe.
+			/// the engine as a pointer and allocating it lazily when it's 
+			/// first used. To ensure that the engine is cleaned up when the 
+			/// thread is destroyed, placement new is used to store the engine
+			/// in an array. The engine doesn't have a destructor, so this 
+			/// should be safe.
             ///
             /// @author Ian Copland
             //----------------------------------------------------------------
-			__declspec(thread) u8 g_rngMemory[sizeof(std::mt19937)];
-			__declspec(thread) std::mt19937* g_randomNumberGenerator = nullptr;
+			__declspec(thread) u8 g_rngMemory[sizeof(RandomEngine)];
+			__declspec(thread) RandomEngine* g_randomEngine = nullptr;
+			__declspec(thread) RandomEngine* g_scopedRandomEngine = nullptr;
             
 #else
-			thread_local std::mt19937 g_randomNumberGenerator(GenerateSeed());
+			thread_local RandomEngine g_randomEngine(Random::GenerateSeed());
+			thread_local RandomEngine* g_scopedRandomEngine = nullptr;
+#endif
+            //----------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The engine of the inner most scoped engine on this
+            /// thread, or null if there isn't one.
+            //----------------------------------------------------------------
+            RandomEngine* GetScopedRandomEngine()
+            {
+#ifdef CS_TARGETPLATFORM_IOS
+                return [GetRNGContainer() scopedRng];
+#else
+                return g_scopedRandomEngine;
 #endif
+            }
+            //----------------------------------------------------------------
+            /// Sets the engine of the inner most scoped engine on this
+            /// thread.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The engine. Can be null.
+            //----------------------------------------------------------------
+            void SetScopedRandomEngine(RandomEngine* in_engine)
+            {
+#ifdef CS_TARGETPLATFORM_IOS
+                [GetRNGContainer() setScopedRng:in_engine];
+#else
+                g_scopedRandomEngine = in_engine;
+#endif
+            }
+            //----------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The thread local engine, ignoring any scoped engine.
+            //----------------------------------------------------------------
+            RandomEngine& GetThreadRandomEngine()
+            {
+#ifdef CS_TARGETPLATFORM_IOS
+                return [GetRNGContainer() rng];
+#elif defined (CS_TARGETPLATFORM_WINDOWS)
+				if (g_randomEngine == nullptr)
+				{
+					g_randomEngine = new (g_rngMemory) RandomEngine(Random::GenerateSeed());
+				}
+
+				return *g_randomEngine;
+#else
+				return g_randomEngine;
+#endif
+            }
 		}
 
 		namespace Random
 		{
             //----------------------------------------------------------------
             //----------------------------------------------------------------
+            ScopedEngine::ScopedEngine(RandomEngine& in_engine)
+                : m_previousEngine(GetScopedRandomEngine())
+            {
+                SetScopedRandomEngine(&in_engine);
+            }
+            //----------------------------------------------------------------
+            //----------------------------------------------------------------
+            ScopedEngine::~ScopedEngine()
+            {
+                SetScopedRandomEngine(m_previousEngine);
+            }
+            //----------------------------------------------------------------
+            //----------------------------------------------------------------
+            u64 GenerateSeed()
+            {
+                return g_baseSeed.load() + g_seedCounter.fetch_add(1);
+            }
+            //----------------------------------------------------------------
+            //----------------------------------------------------------------
+            void Seed(u64 in_seed)
+            {
+                g_baseSeed = in_seed;
+                g_seedCounter = 0;
+                
+                GetThreadRandomEngine().Seed(GenerateSeed());
+            }
+            //----------------------------------------------------------------
+            //----------------------------------------------------------------
+            void GenerateNormalised(f32* out_values, u32 in_numValues)
+            {
+                GetRandomEngine().GenerateNormalised(out_values, in_numValues);
+            }
+            //----------------------------------------------------------------
+            //----------------------------------------------------------------
             template <> Vector2 GenerateComponentwise(Vector2 in_lower, Vector2 in_upper)
             {
                 return Vector2(Generate(in_lower.x, in_upper.x), Generate(in_lower.y, in_upper.y));
@@ -176,35 +283,15 @@ namespace ChilliSource
             }
 			//----------------------------------------------------------------
 			//----------------------------------------------------------------
-			std::mt19937& GetRandomNumberGenerator()
+			RandomEngine& GetRandomEngine()
 			{
-#ifdef CS_TARGETPLATFORM_IOS
-                @autoreleasepool
+                RandomEngine* scopedEngine = GetScopedRandomEngine();
+                if (scopedEngine != nullptr)
                 {
-                    NSMutableDictionary* threadLocalDict = [[NSThread currentThread] threadDictionary];
-                
-                    NSString* key = [NSString stringWithCString:k_rngKey encoding:NSUTF8StringEncoding];
-                    RNGContainer* rngContainer = (RNGContainer*)[threadLocalDict objectForKey:key];
-                    if (rngContainer == nil)
-                    {
-                        std::mt19937 newRandomNumberGenerator(GenerateSeed());
-                        rngContainer = [[RNGContainer alloc] initWithRNG:newRandomNumberGenerator];
-                        [threadLocalDict setObject:rngContainer forKey:key];
-                        [rngContainer release];
-                    }
-                    
-                    return [rngContainer rng];
+                    return *scopedEngine;
                 }
-#elif CS_TARGETPLATFORM_WINDOWS
-				if (g_randomNumberGenerator == nullptr)
-				{
-					g_randomNumberGenerator = new (g_rngMemory) std::mt19937(GenerateSeed());
-				}
-
-				return *g_randomNumberGenerator;
-#else
-				return g_randomNumberGenerator;
-#endif
+                
+                return GetThreadRandomEngine();
 			}
 		}
 	}
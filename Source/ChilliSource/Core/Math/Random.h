@@ -31,8 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Math/NumericLimits.h>
-
-#include <random>
+#include <ChilliSource/Core/Math/RandomEngine.h>
 
 namespace ChilliSource
 {
@@ -40,12 +39,75 @@ namespace ChilliSource
 	{
 		//------------------------------------------------------------------------------
 		/// A collection of thread-safe methods which can be used to generate pseudo
-        /// random numbers.
+        /// random numbers. Each thread has its own RandomEngine, so no locking is
+        /// required to generate values.
+        ///
+        /// The engine used on the current thread can be temporarily replaced using a
+        /// ScopedEngine. This allows systems such as particle effects to provide their
+        /// own seeded engine so that their output is deterministic.
 		///
 		/// @author Ian Copland
 		//------------------------------------------------------------------------------
 		namespace Random
         {
+            //------------------------------------------------------------------------------
+            /// While in scope, this replaces the engine used by all Random methods on the
+            /// current thread with the given engine. Scoped engines can be nested, in
+            /// which case the previous engine is restored when this goes out of scope.
+            ///
+            /// This must be created and destroyed on the same thread.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            class ScopedEngine final
+            {
+            public:
+                CS_DECLARE_NOCOPY(ScopedEngine);
+                //------------------------------------------------------------------------------
+                /// Constructor.
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The engine to use on this thread while this is in scope. This
+                /// must outlive the scoped engine.
+                //------------------------------------------------------------------------------
+                ScopedEngine(RandomEngine& in_engine);
+                //------------------------------------------------------------------------------
+                /// Destructor. Restores the previous engine.
+                ///
+                /// @author Carlos Artesano
+                //------------------------------------------------------------------------------
+                ~ScopedEngine();
+                
+            private:
+                RandomEngine* m_previousEngine;
+            };
+            //------------------------------------------------------------------------------
+            /// Generates a seed for a new RandomEngine. Unless Seed() has been called,
+            /// the seeds are derived from a non-deterministic source.
+            ///
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The seed.
+            //------------------------------------------------------------------------------
+            u64 GenerateSeed();
+            //------------------------------------------------------------------------------
+            /// Puts the random number generation into a deterministic mode. All seeds
+            /// returned from GenerateSeed() after this is called will follow a fixed
+            /// sequence derived from the given seed, and the engine for the calling thread
+            /// is reseeded. Engines for other threads which already exist are unaffected,
+            /// so for fully deterministic output any work which generates random numbers
+            /// on other threads should use a ScopedEngine.
+            ///
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The seed.
+            //------------------------------------------------------------------------------
+            void Seed(u64 in_seed);
             //------------------------------------------------------------------------------
             /// Generates a psuedo-random value of the requested type within the given range.
             /// Defaults to the maximum possible range for the given type.
@@ -71,6 +133,19 @@ namespace ChilliSource
 			/// @return A value within the range.
 			//------------------------------------------------------------------------------
 			template <typename TType> TType GenerateNormalised();
+            //------------------------------------------------------------------------------
+            /// Fills the given buffer with psuedo-random numbers in the range between 0.0
+            /// and 1.0. This is considerably cheaper than calling GenerateNormalised() for
+            /// each value when large numbers of values are needed.
+            ///
+            /// This is thread safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param [Out] The buffer to fill.
+            /// @param The number of values to generate.
+            //------------------------------------------------------------------------------
+            void GenerateNormalised(f32* out_values, u32 in_numValues);
 			//------------------------------------------------------------------------------
 			/// Generates a psuedo-random direction vector in 2 dimensions with uniform
             /// distribution.
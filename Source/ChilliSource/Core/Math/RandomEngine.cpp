@@ -0,0 +1,109 @@
+//
+//  RandomEngine.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Math/RandomEngine.h>
+
+namespace ChilliSource
+{
+	namespace Core
+	{
+		namespace
+		{
+			//------------------------------------------------------------------------------
+			/// Returns the next value from a SplitMix64 sequence. This is used to expand a
+			/// single 64-bit seed into the full engine state, as recommended by the
+			/// authors of xoroshiro128+.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param [Out] The SplitMix64 state.
+			///
+			/// @return The next value.
+			//------------------------------------------------------------------------------
+			u64 SplitMix64(u64& inout_state)
+			{
+				u64 value = (inout_state += 0x9E3779B97F4A7C15ull);
+				value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+				value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+				return value ^ (value >> 31);
+			}
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		RandomEngine::RandomEngine()
+		{
+			Seed(0);
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		RandomEngine::RandomEngine(u64 in_seed)
+		{
+			Seed(in_seed);
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		void RandomEngine::Seed(u64 in_seed)
+		{
+			u64 splitMixState = in_seed;
+			m_state[0] = SplitMix64(splitMixState);
+			m_state[1] = SplitMix64(splitMixState);
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		void RandomEngine::GenerateNormalised(f32* out_values, u32 in_numValues)
+		{
+			CS_ASSERT(out_values != nullptr || in_numValues == 0, "Cannot generate values into a null buffer.");
+
+			//each 64-bit value provides two 24-bit mantissas.
+			u32 index = 0;
+			for (; index + 1 < in_numValues; index += 2)
+			{
+				const u64 value = (*this)();
+				out_values[index] = f32(value >> 40) * (1.0f / 16777216.0f);
+				out_values[index + 1] = f32((value >> 8) & 0xFFFFFF) * (1.0f / 16777216.0f);
+			}
+
+			if (index < in_numValues)
+			{
+				out_values[index] = GenerateNormalised<f32>();
+			}
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		void RandomEngine::Generate(f32* out_values, u32 in_numValues, f32 in_lower, f32 in_upper)
+		{
+			GenerateNormalised(out_values, in_numValues);
+
+			const f32 range = in_upper - in_lower;
+			for (u32 i = 0; i < in_numValues; ++i)
+			{
+				out_values[i] = in_lower + range * out_values[i];
+			}
+		}
+	}
+}
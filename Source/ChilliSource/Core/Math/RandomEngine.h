@@ -0,0 +1,210 @@
+//
+//  RandomEngine.h
+//  Chilli Source
+//  Created by Carlos Artesano on 18/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_MATH_RANDOMENGINE_H_
+#define _CHILLISOURCE_CORE_MATH_RANDOMENGINE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <type_traits>
+
+namespace ChilliSource
+{
+	namespace Core
+	{
+		//------------------------------------------------------------------------------
+		/// A small, fast pseudo random number engine based on the xoroshiro128+
+		/// algorithm. The full state of the engine is two 64-bit integers, so it is
+		/// cheap to copy, store per thread or per object, and snapshot.
+		///
+		/// Unlike the standard library distributions, values are mapped into ranges
+		/// using fixed arithmetic, so an engine given the same seed will produce the
+		/// same sequence of values on all platforms. This makes it suitable for
+		/// deterministic simulations such as replays and tests.
+		///
+		/// This is not thread-safe. Each thread should use its own engine.
+		///
+		/// @author Carlos Artesano
+		//------------------------------------------------------------------------------
+		class RandomEngine final
+		{
+		public:
+			using result_type = u64;
+			//------------------------------------------------------------------------------
+			/// Constructor. Creates a new engine with a seed of zero. Seed() should
+			/// typically be called before use.
+			///
+			/// @author Carlos Artesano
+			//------------------------------------------------------------------------------
+			RandomEngine();
+			//------------------------------------------------------------------------------
+			/// Constructor. Creates a new engine with the given seed.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The seed.
+			//------------------------------------------------------------------------------
+			explicit RandomEngine(u64 in_seed);
+			//------------------------------------------------------------------------------
+			/// Resets the state of the engine using the given seed. The seed is expanded
+			/// into the full engine state, so similar seeds will still produce
+			/// uncorrelated sequences.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The seed.
+			//------------------------------------------------------------------------------
+			void Seed(u64 in_seed);
+			//------------------------------------------------------------------------------
+			/// @author Carlos Artesano
+			///
+			/// @return The next 64-bit value in the sequence.
+			//------------------------------------------------------------------------------
+			result_type operator()();
+			//------------------------------------------------------------------------------
+			/// Generates a pseudo-random value of the requested type within the given
+			/// range. Only integral and floating point types are supported.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The lower value, inclusive.
+			/// @param The upper value. This is inclusive for integral types and
+			/// exclusive for floating point types.
+			///
+			/// @return A value within the range.
+			//------------------------------------------------------------------------------
+			template <typename TType> TType Generate(TType in_lower, TType in_upper);
+			//------------------------------------------------------------------------------
+			/// Generates a pseudo-random floating point value in the range [0.0, 1.0).
+			///
+			/// @author Carlos Artesano
+			///
+			/// @return A value within the range.
+			//------------------------------------------------------------------------------
+			template <typename TType> TType GenerateNormalised();
+			//------------------------------------------------------------------------------
+			/// Fills the given buffer with pseudo-random floating point values in the range
+			/// [0.0, 1.0). This is considerably cheaper than generating each value
+			/// individually when large numbers of values are needed.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param [Out] The buffer to fill.
+			/// @param The number of values to generate.
+			//------------------------------------------------------------------------------
+			void GenerateNormalised(f32* out_values, u32 in_numValues);
+			//------------------------------------------------------------------------------
+			/// Fills the given buffer with pseudo-random floating point values within the
+			/// given range.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param [Out] The buffer to fill.
+			/// @param The number of values to generate.
+			/// @param The lower value, inclusive.
+			/// @param The upper value, exclusive.
+			//------------------------------------------------------------------------------
+			void Generate(f32* out_values, u32 in_numValues, f32 in_lower, f32 in_upper);
+
+		private:
+			u64 m_state[2];
+		};
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		inline RandomEngine::result_type RandomEngine::operator()()
+		{
+			const u64 s0 = m_state[0];
+			u64 s1 = m_state[1];
+			const u64 result = s0 + s1;
+
+			s1 ^= s0;
+			m_state[0] = ((s0 << 55) | (s0 >> 9)) ^ s1 ^ (s1 << 14);
+			m_state[1] = (s1 << 36) | (s1 >> 28);
+
+			return result;
+		}
+		//------------------------------------------------------------------------------
+		/// Specialisation of GenerateNormalised() for 32-bit floats. The top 24 bits
+		/// of the next value are used as the mantissa.
+		///
+		/// @author Carlos Artesano
+		///
+		/// @return A value in the range [0.0, 1.0).
+		//------------------------------------------------------------------------------
+		template <> inline f32 RandomEngine::GenerateNormalised<f32>()
+		{
+			return f32((*this)() >> 40) * (1.0f / 16777216.0f);
+		}
+		//------------------------------------------------------------------------------
+		/// Specialisation of GenerateNormalised() for 64-bit floats. The top 53 bits
+		/// of the next value are used as the mantissa.
+		///
+		/// @author Carlos Artesano
+		///
+		/// @return A value in the range [0.0, 1.0).
+		//------------------------------------------------------------------------------
+		template <> inline f64 RandomEngine::GenerateNormalised<f64>()
+		{
+			return f64((*this)() >> 11) * (1.0 / 9007199254740992.0);
+		}
+		//------------------------------------------------------------------------------
+		//------------------------------------------------------------------------------
+		template <typename TType> TType RandomEngine::Generate(TType in_lower, TType in_upper)
+		{
+			static_assert(std::is_integral<TType>::value || std::is_floating_point<TType>::value, "Random engine can only generate integral and floating point values.");
+
+			TType lower = (in_lower < in_upper) ? in_lower : in_upper;
+			TType upper = (in_lower < in_upper) ? in_upper : in_lower;
+
+			if (std::is_floating_point<TType>::value == true)
+			{
+				using FloatType = typename std::conditional<std::is_same<TType, f32>::value, f32, f64>::type;
+				return TType(lower + (upper - lower) * GenerateNormalised<FloatType>());
+			}
+
+			//the range is calculated as unsigned to avoid overflow for signed types. A range of
+			//zero means the full 64-bit range was requested.
+			using UnsignedType = typename std::make_unsigned<typename std::conditional<std::is_integral<TType>::value, TType, u64>::type>::type;
+			const u64 range = u64(UnsignedType(UnsignedType(upper) - UnsignedType(lower))) + 1;
+			if (range == 0)
+			{
+				return TType((*this)());
+			}
+
+			//for ranges which fit in 32-bits a multiply and shift avoids the division.
+			if (range <= 0x100000000ull)
+			{
+				return TType(UnsignedType(lower) + UnsignedType((((*this)() >> 32) * range) >> 32));
+			}
+
+			return TType(UnsignedType(lower) + UnsignedType((*this)() % range));
+		}
+	}
+}
+
+#endif
@@ -49,10 +49,10 @@ namespace ChilliSource
             //------------------------------------------------------------------------------
             /// @author Ian Copland
             ///
-            /// @return Returns the random number generator for the current
-            /// thread.
+            /// @return Returns the random engine for the current thread. This will
+            /// be the engine of the inner most ScopedEngine if there is one.
             //------------------------------------------------------------------------------
-            std::mt19937& GetRandomNumberGenerator();
+            RandomEngine& GetRandomEngine();
             //------------------------------------------------------------------------------
             /// Specialisation of GenerateComponentwise() for values
             /// of type Vector2.
@@ -169,7 +169,7 @@ namespace ChilliSource
             template <typename TType> struct RandomNumberGenerator<TType, true, false>
             {
                 //------------------------------------------------------------------------------
-                /// Generates an integer value in the given range. Uses an integer distribution.
+                /// Generates an integer value in the given range.
                 ///
                 /// @author Ian Copland
                 ///
@@ -180,11 +180,7 @@ namespace ChilliSource
                 //------------------------------------------------------------------------------
 				static TType Generate(TType in_lower, TType in_upper)
                 {
-					TType lower = std::min(in_lower, in_upper);
-					TType upper = std::max(in_lower, in_upper);
-
-					std::uniform_int_distribution<TType> distribution(lower, upper);
-					return distribution(GetRandomNumberGenerator());
+					return GetRandomEngine().Generate(in_lower, in_upper);
                 }
             };
             //------------------------------------------------------------------------------
@@ -195,8 +191,7 @@ namespace ChilliSource
             template <typename TType> struct RandomNumberGenerator<TType, false, true>
             {
                 //------------------------------------------------------------------------------
-                /// Generates an floating point value in the given range. Uses a floating point
-                //// distribution.
+                /// Generates an floating point value in the given range.
                 ///
                 /// @author Ian Copland
                 ///
@@ -207,11 +202,7 @@ namespace ChilliSource
                 //------------------------------------------------------------------------------
                 static TType Generate(TType in_lower, TType in_upper)
                 {
-					TType lower = std::min(in_lower, in_upper);
-					TType upper = std::max(in_lower, in_upper);
-
-					std::uniform_real_distribution<TType> distribution(lower, upper);
-					return distribution(GetRandomNumberGenerator());
+					return GetRandomEngine().Generate(in_lower, in_upper);
                 }
             };
             //------------------------------------------------------------------------------
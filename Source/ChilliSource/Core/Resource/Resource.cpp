@@ -29,11 +29,34 @@
 #include <ChilliSource/Core/Resource/Resource.h>
 
 #include <ChilliSource/Core/File/StorageLocation.h>
+#include <ChilliSource/Core/Resource/IResourceOptions.h>
 
 namespace ChilliSource
 {
 	namespace Core
 	{
+        namespace
+        {
+            //-------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The first options, may be null.
+            /// @param The second options, may be null.
+            ///
+            /// @return Whether or not the two options describe the
+            /// same load options.
+            //-------------------------------------------------------
+            bool AreOptionsEqual(const IResourceOptionsBaseCSPtr& in_a, const IResourceOptionsBaseCSPtr& in_b)
+            {
+                if(in_a == nullptr || in_b == nullptr)
+                {
+                    return in_a == in_b;
+                }
+                
+                return in_a->GenerateHash() == in_b->GenerateHash();
+            }
+        }
+        
 		//-------------------------------------------------------
 		//-------------------------------------------------------
 		Resource::Resource()
@@ -47,6 +70,12 @@ namespace ChilliSource
             return m_loadState;
         }
         //-------------------------------------------------------
+        //-------------------------------------------------------
+        u64 Resource::GetMemoryUsage() const
+        {
+            return 0;
+        }
+        //-------------------------------------------------------
         /// If we set the load state to loaded or failed
         /// we need to notify any waiting parties that the resource
         /// is now ready
@@ -102,6 +131,53 @@ namespace ChilliSource
         const IResourceOptionsBaseCSPtr& Resource::GetOptions() const
         {
             return m_options;
+        }
+        //-------------------------------------------------------
+        /// Dependencies are compared by description, so the same
+        /// file loaded with different options is recorded once
+        /// for each set of options.
+        //-------------------------------------------------------
+        void Resource::AddDependency(const ResourceCSPtr& in_dependency)
+        {
+            CS_ASSERT(in_dependency != nullptr, "Cannot add null resource dependency.");
+            CS_ASSERT(in_dependency.get() != this, "A resource cannot depend on itself.");
+            
+            if(in_dependency->GetStorageLocation() == StorageLocation::k_none)
+            {
+                return;
+            }
+            
+            Dependency dependency;
+            dependency.m_resourceType = in_dependency->GetInterfaceID();
+            dependency.m_location = in_dependency->GetStorageLocation();
+            dependency.m_filePath = in_dependency->GetFilePath();
+            dependency.m_options = in_dependency->GetOptions();
+            
+            std::unique_lock<std::mutex> lock(m_dependenciesMutex);
+            for(const auto& existing : m_dependencies)
+            {
+                if(existing.m_resourceType == dependency.m_resourceType && existing.m_location == dependency.m_location &&
+                   existing.m_filePath == dependency.m_filePath && AreOptionsEqual(existing.m_options, dependency.m_options) == true)
+                {
+                    return;
+                }
+            }
+            
+            m_dependencies.push_back(std::move(dependency));
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        std::vector<Resource::Dependency> Resource::GetDependencies() const
+        {
+            std::unique_lock<std::mutex> lock(m_dependenciesMutex);
+            return m_dependencies;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Resource::ClearDependencies()
+        {
+            std::unique_lock<std::mutex> lock(m_dependenciesMutex);
+            m_dependencies.clear();
         }
 		//-------------------------------------------------------
 		//-------------------------------------------------------
@@ -33,8 +33,11 @@
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/QueryableInterface.h>
 #include <ChilliSource/Core/Container/ParamDictionary.h>
+#include <ChilliSource/Core/File/StorageLocation.h>
 
 #include <atomic>
+#include <mutex>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -55,10 +58,27 @@ namespace ChilliSource
 		{
 		public:
             
-            using ResourceId = u32;
+            using ResourceId = u64;
             
             CS_DECLARE_NOCOPY(Resource);
             
+            //-------------------------------------------------------
+            /// Describes another resource which this resource
+            /// depends on, in enough detail for the resource pool to
+            /// load it again. Only the description is held rather
+            /// than the dependency itself, so recording a dependency
+            /// never keeps it alive.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------
+            struct Dependency
+            {
+                InterfaceIDType m_resourceType = 0;
+                StorageLocation m_location = StorageLocation::k_none;
+                std::string m_filePath;
+                IResourceOptionsBaseCSPtr m_options;
+            };
+            
             //-------------------------------------------------------
             /// Describes the current load state of the resource
             /// largely for use with async loading in order to
@@ -134,6 +154,43 @@ namespace ChilliSource
             //-------------------------------------------------------
             LoadState GetLoadState() const;
             //-------------------------------------------------------
+            /// Returns an estimate of the memory used by the
+            /// resource. This is used by the resource pool to keep
+            /// resources within their memory budget. Resource types
+            /// which own a significant amount of memory should
+            /// override this; by default 0 is returned, meaning the
+            /// resource never counts towards its budget.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The memory usage in bytes.
+            //-------------------------------------------------------
+            virtual u64 GetMemoryUsage() const;
+            //-------------------------------------------------------
+            /// Records that this resource depends on the given
+            /// resource. Dependencies loaded synchronously while this
+            /// resource is being loaded are recorded automatically
+            /// by the resource pool; providers which load their
+            /// dependencies asynchronously should call this as each
+            /// dependency is received. Resources which were not loaded
+            /// from file are ignored as they cannot be preloaded.
+            /// This is thread safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The dependency.
+            //-------------------------------------------------------
+            void AddDependency(const ResourceCSPtr& in_dependency);
+            //-------------------------------------------------------
+            /// This is thread safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The resources which this resource depended on
+            /// when it was last loaded.
+            //-------------------------------------------------------
+            std::vector<Dependency> GetDependencies() const;
+            //-------------------------------------------------------
             /// Virtual desctructor
             ///
             /// @author S Downie
@@ -192,6 +249,13 @@ namespace ChilliSource
             /// loading.
 			//-------------------------------------------------------
 			const IResourceOptionsBaseCSPtr& GetOptions() const;
+            //-------------------------------------------------------
+            /// Removes all recorded dependencies. This is called by
+            /// the resource pool prior to the resource being reloaded.
+            ///
+            /// @author Carlos Artesano
+			//-------------------------------------------------------
+            void ClearDependencies();
 			
 		private:
 			
@@ -203,6 +267,9 @@ namespace ChilliSource
             ResourceId m_id;
         
             std::atomic<LoadState> m_loadState;
+            
+            std::vector<Dependency> m_dependencies;
+            mutable std::mutex m_dependenciesMutex;
 		};
 	}
 }
@@ -28,12 +28,49 @@
 
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 
+#include <ChilliSource/Core/Cryptographic/HashXXHash64.h>
+#include <ChilliSource/Core/Json/JsonUtils.h>
 #include <ChilliSource/Core/Resource/ResourceProvider.h>
+#include <ChilliSource/Core/String/StringParser.h>
+
+#include <json/json.h>
+
+#include <set>
 
 namespace ChilliSource
 {
     namespace Core
     {
+        namespace
+        {
+            //Resources created from a unique Id rather than loaded from file use a seed which
+            //cannot be confused with any storage location.
+            const u64 k_uniqueIdSeed = 0xffffffffffffffffULL;
+            
+            const char k_manifestResourcesKey[] = "Resources";
+            const char k_manifestTypeKey[] = "Type";
+            const char k_manifestLocationKey[] = "Location";
+            const char k_manifestPathKey[] = "Path";
+        }
+        
+        //------------------------------------------------------------------------------------
+        /// The state of a single preload set. This is only accessed on the main thread so
+        /// doesn't need to be guarded.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------------
+        struct ResourcePool::PreloadState
+        {
+            PreloadProgressDelegate m_progressDelegate;
+            PreloadDelegate m_delegate;
+            std::set<DependencyKey> m_requested;
+            std::vector<ResourceCSPtr> m_resources;
+            u32 m_numToLoad = 0;
+            u32 m_numLoaded = 0;
+            u32 m_numResolving = 0;
+            bool m_isComplete = false;
+        };
+        
         CS_DEFINE_NAMEDTYPE(ResourcePool);
         
         //------------------------------------------------------------------------------------
@@ -53,18 +90,133 @@ namespace ChilliSource
         void ResourcePool::AddProvider(ResourceProvider* in_provider)
         {
             CS_ASSERT(in_provider != nullptr, "Cannot add null resource provider to pool");
-            auto itDescriptor = m_descriptors.find(in_provider->GetResourceType());
             
+            PoolDesc& desc = GetOrCreateDescriptor(in_provider->GetResourceType());
+            
+            WriteLock lock(desc.m_mutex);
+            desc.m_providers.push_back(in_provider);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::RegisterResourceType(InterfaceIDType in_resourceType, const ResourceLoader& in_loader)
+        {
+            CS_ASSERT(in_loader != nullptr, "Cannot register resource type with null loader");
+            
+            m_resourceLoaders[in_resourceType] = in_loader;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::PreloadResourcesAsync(StorageLocation in_manifestLocation, const std::string& in_manifestPath, const PreloadProgressDelegate& in_progressDelegate, const PreloadDelegate& in_delegate)
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be preloaded on the main thread");
+            CS_ASSERT(in_delegate != nullptr, "Cannot preload resources with null delegate");
+            
+            Json::Value root;
+            if(JsonUtils::ReadJson(in_manifestLocation, in_manifestPath, root) == false)
+            {
+                CS_LOG_ERROR("Cannot read preload manifest: " + in_manifestPath);
+                in_delegate(std::vector<ResourceCSPtr>());
+                return;
+            }
+            
+            const Json::Value& resourcesJson = root[k_manifestResourcesKey];
+            CS_ASSERT(resourcesJson.isArray() == true, "Preload manifest must contain a '" + std::string(k_manifestResourcesKey) + "' array.");
+            
+            std::vector<Resource::Dependency> resources;
+            resources.reserve(resourcesJson.size());
+            
+            for(Json::ArrayIndex i = 0; i < resourcesJson.size(); ++i)
+            {
+                const Json::Value& resourceJson = resourcesJson[i];
+                CS_ASSERT(resourceJson.isObject() == true, "Preload manifest resources must be objects.");
+                CS_ASSERT(resourceJson.isMember(k_manifestTypeKey) == true, "Preload manifest resource must contain a '" + std::string(k_manifestTypeKey) + "' key.");
+                CS_ASSERT(resourceJson.isMember(k_manifestPathKey) == true, "Preload manifest resource must contain a '" + std::string(k_manifestPathKey) + "' key.");
+                
+                Resource::Dependency resource;
+                resource.m_resourceType = QueryableInterface::InterfaceIDHash(resourceJson[k_manifestTypeKey].asString());
+                resource.m_location = ParseStorageLocation(resourceJson.get(k_manifestLocationKey, "Package").asString());
+                resource.m_filePath = resourceJson[k_manifestPathKey].asString();
+                resources.push_back(std::move(resource));
+            }
+            
+            PreloadResourcesAsync(resources, in_progressDelegate, in_delegate);
+        }
+        //------------------------------------------------------------------------------------
+        /// The requested resources are all started before any recorded dependencies so that
+        /// a requested resource which is also a dependency of another is always started as a
+        /// requested resource, and is therefore returned in the delegate.
+        //------------------------------------------------------------------------------------
+        void ResourcePool::PreloadResourcesAsync(const std::vector<Resource::Dependency>& in_resources, const PreloadProgressDelegate& in_progressDelegate, const PreloadDelegate& in_delegate)
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be preloaded on the main thread");
+            CS_ASSERT(in_delegate != nullptr, "Cannot preload resources with null delegate");
+            
+            auto state = std::make_shared<PreloadState>();
+            state->m_progressDelegate = in_progressDelegate;
+            state->m_delegate = in_delegate;
+            state->m_resources.resize(in_resources.size());
+            
+            //Resources which are already cached will complete immediately, so completion is held back until everything has been started.
+            ++state->m_numResolving;
+            
+            std::vector<DependencyKey> requestedKeys;
+            requestedKeys.reserve(in_resources.size());
+            
+            for(u32 i = 0; i < static_cast<u32>(in_resources.size()); ++i)
+            {
+                DependencyKey key;
+                if(TryGetDependencyKey(in_resources[i], key) == false)
+                {
+                    CS_LOG_ERROR("Cannot preload resource: " + in_resources[i].m_filePath);
+                    continue;
+                }
+                
+                state->m_requested.insert(key);
+                requestedKeys.push_back(key);
+                StartPreload(state, in_resources[i], static_cast<s32>(i));
+            }
+            
+            for(const auto& key : requestedKeys)
+            {
+                PreloadRecordedDependencies(state, key);
+            }
+            
+            --state->m_numResolving;
+            CheckPreloadComplete(state);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        ResourcePool::PoolDesc* ResourcePool::FindDescriptor(InterfaceIDType in_resourceType) const
+        {
+            ReadLock lock(m_descriptorsMutex);
+            
+            auto itDescriptor = m_descriptors.find(in_resourceType);
             if(itDescriptor == m_descriptors.end())
             {
-                PoolDesc desc;
-                desc.m_providers.push_back(in_provider);
-                m_descriptors.insert(std::make_pair(in_provider->GetResourceType(), desc));
+                return nullptr;
             }
-            else
+            
+            return itDescriptor->second.get();
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        ResourcePool::PoolDesc& ResourcePool::GetOrCreateDescriptor(InterfaceIDType in_resourceType)
+        {
+            PoolDesc* existing = FindDescriptor(in_resourceType);
+            if(existing != nullptr)
             {
-                itDescriptor->second.m_providers.push_back(in_provider);
+                return *existing;
             }
+            
+            WriteLock lock(m_descriptorsMutex);
+            
+            std::unique_ptr<PoolDesc>& desc = m_descriptors[in_resourceType];
+            if(desc == nullptr)
+            {
+                desc.reset(new PoolDesc());
+            }
+            
+            return *desc;
         }
         //------------------------------------------------------------------------------------
         //------------------------------------------------------------------------------------
@@ -91,24 +243,241 @@ namespace ChilliSource
         //------------------------------------------------------------------------------------
         Resource::ResourceId ResourcePool::GenerateResourceId(const std::string& in_uniqueId) const
         {
-            return HashCRC32::GenerateHashCode(in_uniqueId);
+            return HashXXHash64::GenerateHashCode(in_uniqueId, k_uniqueIdSeed);
         }
         //------------------------------------------------------------------------------------
         //------------------------------------------------------------------------------------
         Resource::ResourceId ResourcePool::GenerateResourceId(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options) const
         {
-            std::string combined(ToString((u32)in_location) + in_filePath);
-            u32 fileHash = HashCRC32::GenerateHashCode(combined);
+            u64 hash = HashXXHash64::GenerateHashCode(in_filePath, static_cast<u64>(in_location));
             
             if(in_options == nullptr)
             {
-                return fileHash;
+                return hash;
             }
             
             u32 optionsHash = in_options->GenerateHash();
+            return HashXXHash64::GenerateHashCode(reinterpret_cast<const s8*>(&optionsHash), sizeof(u32), hash);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::CheckForIdCollision(const Resource* in_cachedResource, StorageLocation in_location, const std::string& in_name) const
+        {
+            if(in_cachedResource->GetStorageLocation() != in_location || in_cachedResource->GetName() != in_name)
+            {
+                CS_LOG_FATAL("Resource Id collision between '" + in_cachedResource->GetName() + "' and '" + in_name + "'.");
+            }
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        std::vector<ResourceProvider::AsyncLoadDelegate> ResourcePool::CompleteAsyncLoad(InterfaceIDType in_resourceType, Resource::ResourceId in_resourceId)
+        {
+            std::vector<ResourceProvider::AsyncLoadDelegate> waiters;
+            
+            PoolDesc* desc = FindDescriptor(in_resourceType);
+            if(desc != nullptr)
+            {
+                WriteLock lock(desc->m_mutex);
+                auto& pendingLoads(desc->m_pendingLoads);
+                auto itPendingLoad = pendingLoads.find(in_resourceId);
+                if(itPendingLoad != pendingLoads.end())
+                {
+                    waiters = std::move(itPendingLoad->second);
+                    pendingLoads.erase(itPendingLoad);
+                }
+                
+                auto itResource = desc->m_cachedResources.find(in_resourceId);
+                if(itResource != desc->m_cachedResources.end() && itResource->second.m_resource->GetLoadState() == Resource::LoadState::k_loaded)
+                {
+                    RecordDependencyGraph(itResource->second.m_resource.get());
+                }
+                
+                desc->UpdateMemoryUsage(in_resourceId);
+                desc->EnforceMemoryBudget();
+            }
+            
+            return waiters;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::PushLoadingResource(const ResourceSPtr& in_resource)
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be loaded synchronously on the main thread");
+            
+            m_loadingResources.push_back(in_resource);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::PopLoadingResource()
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be loaded synchronously on the main thread");
+            CS_ASSERT(m_loadingResources.empty() == false, "Loading resources have become unbalanced.");
             
-            u64 combinedHash = fileHash + ((u64)(optionsHash) << 32);
-            return HashCRC32::GenerateHashCode((const s8*)&combinedHash, sizeof(u64));
+            ResourceSPtr resource = m_loadingResources.back();
+            m_loadingResources.pop_back();
+            
+            if(resource->GetLoadState() == Resource::LoadState::k_loaded)
+            {
+                RecordDependencyGraph(resource.get());
+            }
+        }
+        //------------------------------------------------------------------------------------
+        /// Synchronous loads only happen on the main thread, so the loading resources
+        /// are only ever accessed on the main thread. Requests from other threads cannot be
+        /// attributed to a parent, so providers which load their dependencies on a background
+        /// thread record them explicitly.
+        //------------------------------------------------------------------------------------
+        void ResourcePool::RecordDependency(const ResourceCSPtr& in_resource)
+        {
+            if(Application::Get()->GetTaskScheduler()->IsMainThread() == false || m_loadingResources.empty() == true)
+            {
+                return;
+            }
+            
+            const ResourceSPtr& parent = m_loadingResources.back();
+            if(parent != in_resource)
+            {
+                parent->AddDependency(in_resource);
+            }
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::RecordDependencyGraph(const Resource* in_resource)
+        {
+            if(in_resource->GetStorageLocation() == StorageLocation::k_none)
+            {
+                return;
+            }
+            
+            DependencyKey key(in_resource->GetInterfaceID(), in_resource->GetId());
+            std::vector<Resource::Dependency> dependencies = in_resource->GetDependencies();
+            
+            std::unique_lock<std::mutex> lock(m_dependencyGraphMutex);
+            if(dependencies.empty() == true)
+            {
+                m_dependencyGraph.erase(key);
+            }
+            else
+            {
+                m_dependencyGraph[key] = std::move(dependencies);
+            }
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        bool ResourcePool::TryGetDependencyKey(const Resource::Dependency& in_resource, DependencyKey& out_key)
+        {
+            PoolDesc* desc = FindDescriptor(in_resource.m_resourceType);
+            if(desc == nullptr)
+            {
+                return false;
+            }
+            
+            IResourceOptionsBaseCSPtr options(in_resource.m_options);
+            if(options == nullptr)
+            {
+                ReadLock lock(desc->m_mutex);
+                ResourceProvider* provider = FindProvider(in_resource.m_filePath, *desc);
+                if(provider == nullptr)
+                {
+                    return false;
+                }
+                
+                options = provider->GetDefaultOptions();
+            }
+            
+            out_key = DependencyKey(in_resource.m_resourceType, GenerateResourceId(in_resource.m_location, in_resource.m_filePath, options));
+            return true;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::PreloadDependency(const std::shared_ptr<PreloadState>& in_state, const Resource::Dependency& in_resource)
+        {
+            DependencyKey key;
+            if(TryGetDependencyKey(in_resource, key) == false)
+            {
+                CS_LOG_ERROR("Cannot preload resource dependency: " + in_resource.m_filePath);
+                return;
+            }
+            
+            if(in_state->m_requested.insert(key).second == false)
+            {
+                return;
+            }
+            
+            StartPreload(in_state, in_resource, -1);
+            PreloadRecordedDependencies(in_state, key);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::PreloadRecordedDependencies(const std::shared_ptr<PreloadState>& in_state, const DependencyKey& in_key)
+        {
+            std::vector<Resource::Dependency> dependencies;
+            
+            std::unique_lock<std::mutex> lock(m_dependencyGraphMutex);
+            auto itDependencies = m_dependencyGraph.find(in_key);
+            if(itDependencies != m_dependencyGraph.end())
+            {
+                dependencies = itDependencies->second;
+            }
+            lock.unlock();
+            
+            for(const auto& dependency : dependencies)
+            {
+                PreloadDependency(in_state, dependency);
+            }
+        }
+        //------------------------------------------------------------------------------------
+        /// Once a resource has loaded its own dependencies are preloaded, which picks up any
+        /// that weren't known when the preload started.
+        //------------------------------------------------------------------------------------
+        void ResourcePool::StartPreload(const std::shared_ptr<PreloadState>& in_state, const Resource::Dependency& in_resource, s32 in_requestIndex)
+        {
+            auto itLoader = m_resourceLoaders.find(in_resource.m_resourceType);
+            if(itLoader == m_resourceLoaders.end())
+            {
+                CS_LOG_ERROR("Cannot preload resource of unregistered type: " + in_resource.m_filePath);
+                return;
+            }
+            
+            ++in_state->m_numToLoad;
+            
+            itLoader->second(in_resource.m_location, in_resource.m_filePath, in_resource.m_options, [=](const ResourceCSPtr& in_loadedResource)
+            {
+                if(in_requestIndex >= 0)
+                {
+                    in_state->m_resources[in_requestIndex] = in_loadedResource;
+                }
+                
+                ++in_state->m_numLoaded;
+                if(in_state->m_progressDelegate != nullptr)
+                {
+                    in_state->m_progressDelegate(in_state->m_numLoaded, in_state->m_numToLoad);
+                }
+                
+                if(in_loadedResource != nullptr && in_loadedResource->GetLoadState() == Resource::LoadState::k_loaded)
+                {
+                    ++in_state->m_numResolving;
+                    for(const auto& dependency : in_loadedResource->GetDependencies())
+                    {
+                        PreloadDependency(in_state, dependency);
+                    }
+                    --in_state->m_numResolving;
+                }
+                
+                CheckPreloadComplete(in_state);
+            });
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::CheckPreloadComplete(const std::shared_ptr<PreloadState>& in_state)
+        {
+            if(in_state->m_isComplete == true || in_state->m_numResolving > 0 || in_state->m_numLoaded < in_state->m_numToLoad)
+            {
+                return;
+            }
+            
+            in_state->m_isComplete = true;
+            in_state->m_delegate(in_state->m_resources);
         }
         //-------------------------------------------------------------------------------------
         /// Resources often have references to other resources and therefore multiple release passes
@@ -118,7 +487,7 @@ namespace ChilliSource
         {
             CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be released on the main thread");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
+            ReadLock descriptorsLock(m_descriptorsMutex);
             u32 numReleased = 0;
             
             do
@@ -127,13 +496,16 @@ namespace ChilliSource
                 
                 for(auto& descEntry : m_descriptors)
                 {
-                    for(auto itResource = descEntry.second.m_cachedResources.begin(); itResource != descEntry.second.m_cachedResources.end(); /*NO INCREMENT*/)
+                    PoolDesc& desc = *descEntry.second;
+                    WriteLock lock(desc.m_mutex);
+                    
+                    for(auto itResource = desc.m_cachedResources.begin(); itResource != desc.m_cachedResources.end(); /*NO INCREMENT*/)
                     {
-                        if(itResource->second.use_count() == 1)
+                        if(itResource->second.m_resource.use_count() == 1)
                         {
                             //The pool is the sole owner so we can safely release the object
-                            CS_LOG_VERBOSE("Releasing resource from pool " + itResource->second->GetName());
-                            itResource = descEntry.second.m_cachedResources.erase(itResource);
+                            CS_LOG_VERBOSE("Releasing resource from pool " + itResource->second.m_resource->GetName());
+                            itResource = desc.Erase(itResource);
                             numReleased++;
                         }
                         else
@@ -153,26 +525,20 @@ namespace ChilliSource
             CS_ASSERT(in_resource != nullptr, "Pool cannot release null resource");
             //Find the descriptor that handles this type of resource
             
-            std::unique_lock<std::mutex> lock(m_mutex);
-            auto itDescriptor = m_descriptors.find(in_resource->GetInterfaceID());
-            CS_ASSERT(itDescriptor != m_descriptors.end(), "Failed to find resource pool for " + in_resource->GetInterfaceTypeName());
+            PoolDesc* desc = FindDescriptor(in_resource->GetInterfaceID());
+            CS_ASSERT(desc != nullptr, "Failed to find resource pool for " + in_resource->GetInterfaceTypeName());
             
-            auto& cachedResources(itDescriptor->second.m_cachedResources);
+            WriteLock lock(desc->m_mutex);
+            auto& cachedResources(desc->m_cachedResources);
             
-            for(auto itResource = cachedResources.begin(); itResource != cachedResources.end(); /*NO INCREMENT*/)
+            //Resources are keyed by Id, so it can be looked up directly rather than searching the cache.
+            auto itResource = cachedResources.find(in_resource->GetId());
+            if(itResource != cachedResources.end() && itResource->second.m_resource.get() == in_resource)
             {
-                if(itResource->second.get() == in_resource)
-                {
-					ResourceSPtr& resource = itResource->second;
-					CS_ASSERT((resource.use_count() <= 1), "Cannot release a resource if it is owned by another object (i.e. use_count > 0) : (" + resource->GetName() + ")");
-					CS_LOG_VERBOSE("Releasing resource from pool " + resource->GetName());
-					cachedResources.erase(itResource);
-                    return;
-                }
-                else
-                {
-                    ++itResource;
-                }
+                ResourceSPtr& resource = itResource->second.m_resource;
+                CS_ASSERT((resource.use_count() <= 1), "Cannot release a resource if it is owned by another object (i.e. use_count > 0) : (" + resource->GetName() + ")");
+                CS_LOG_VERBOSE("Releasing resource from pool " + resource->GetName());
+                desc->Erase(itResource);
             }
         }
         //------------------------------------------------------------------------------------
@@ -186,12 +552,14 @@ namespace ChilliSource
             
             bool error = false;
             
+            ReadLock descriptorsLock(m_descriptorsMutex);
             for(auto& descEntry : m_descriptors)
             {
-                for(auto itResource = descEntry.second.m_cachedResources.begin(); itResource != descEntry.second.m_cachedResources.end(); ++itResource)
+                ReadLock lock(descEntry.second->m_mutex);
+                for(auto itResource = descEntry.second->m_cachedResources.begin(); itResource != descEntry.second->m_cachedResources.end(); ++itResource)
                 {
                     //The pool is the sole owner so we can safely release the object
-                    CS_LOG_ERROR("Resource still in use: " + itResource->second->GetName());
+                    CS_LOG_ERROR("Resource still in use: " + itResource->second.m_resource->GetName());
 					error = true;
                 }
             }
@@ -203,6 +571,122 @@ namespace ChilliSource
         }
         //------------------------------------------------------------------------------------
         //------------------------------------------------------------------------------------
+        void ResourcePool::SetMemoryBudget(InterfaceIDType in_resourceType, u64 in_budget)
+        {
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Memory budgets can only be set on the main thread");
+            
+            PoolDesc& desc = GetOrCreateDescriptor(in_resourceType);
+            
+            WriteLock lock(desc.m_mutex);
+            desc.m_memoryBudget = in_budget;
+            desc.EnforceMemoryBudget();
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        ResourcePool::CacheStatistics ResourcePool::GetCacheStatistics(InterfaceIDType in_resourceType) const
+        {
+            CacheStatistics output;
+            
+            PoolDesc* desc = FindDescriptor(in_resourceType);
+            if(desc != nullptr)
+            {
+                ReadLock lock(desc->m_mutex);
+                output.m_numResources = static_cast<u32>(desc->m_cachedResources.size());
+                output.m_memoryUsage = desc->m_memoryUsage;
+                output.m_memoryBudget = desc->m_memoryBudget;
+                output.m_numEvictions = desc->m_numEvictions;
+            }
+            
+            return output;
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::PoolDesc::Add(Resource::ResourceId in_resourceId, const ResourceSPtr& in_resource)
+        {
+            CacheEntry entry;
+            entry.m_resource = in_resource;
+            entry.m_memoryUsage = in_resource->GetMemoryUsage();
+            
+            std::unique_lock<std::mutex> lruLock(m_lruMutex);
+            m_lruList.push_front(in_resourceId);
+            entry.m_lruPosition = m_lruList.begin();
+            lruLock.unlock();
+            
+            m_memoryUsage += entry.m_memoryUsage;
+            m_cachedResources.insert(std::make_pair(in_resourceId, std::move(entry)));
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::PoolDesc::Touch(const CacheEntry& in_entry) const
+        {
+            std::unique_lock<std::mutex> lruLock(m_lruMutex);
+            m_lruList.splice(m_lruList.begin(), m_lruList, in_entry.m_lruPosition);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        std::unordered_map<Resource::ResourceId, ResourcePool::CacheEntry>::iterator ResourcePool::PoolDesc::Erase(std::unordered_map<Resource::ResourceId, CacheEntry>::iterator in_iterator)
+        {
+            std::unique_lock<std::mutex> lruLock(m_lruMutex);
+            m_lruList.erase(in_iterator->second.m_lruPosition);
+            lruLock.unlock();
+            
+            CS_ASSERT(m_memoryUsage >= in_iterator->second.m_memoryUsage, "Resource pool memory usage has become out of sync.");
+            m_memoryUsage -= in_iterator->second.m_memoryUsage;
+            
+            return m_cachedResources.erase(in_iterator);
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
+        void ResourcePool::PoolDesc::UpdateMemoryUsage(Resource::ResourceId in_resourceId)
+        {
+            auto itResource = m_cachedResources.find(in_resourceId);
+            if(itResource != m_cachedResources.end())
+            {
+                CacheEntry& entry = itResource->second;
+                
+                CS_ASSERT(m_memoryUsage >= entry.m_memoryUsage, "Resource pool memory usage has become out of sync.");
+                m_memoryUsage -= entry.m_memoryUsage;
+                entry.m_memoryUsage = entry.m_resource->GetMemoryUsage();
+                m_memoryUsage += entry.m_memoryUsage;
+            }
+        }
+        //------------------------------------------------------------------------------------
+        /// Walks the LRU list from the least recently used end, so the cost is proportional
+        /// to the number of resources inspected rather than the size of the cache.
+        //------------------------------------------------------------------------------------
+        void ResourcePool::PoolDesc::EnforceMemoryBudget()
+        {
+            if(m_memoryBudget == 0 || m_memoryUsage <= m_memoryBudget)
+            {
+                return;
+            }
+            
+            CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be released on the main thread");
+            
+            auto itLru = m_lruList.end();
+            while(m_memoryUsage > m_memoryBudget && itLru != m_lruList.begin())
+            {
+                --itLru;
+                
+                auto itResource = m_cachedResources.find(*itLru);
+                CS_ASSERT(itResource != m_cachedResources.end(), "Resource pool LRU list has become out of sync.");
+                
+                const CacheEntry& entry = itResource->second;
+                if(entry.m_memoryUsage > 0 && entry.m_resource.use_count() == 1)
+                {
+                    CS_LOG_VERBOSE("Evicting resource from pool " + entry.m_resource->GetName());
+                    
+                    //the iterator is moved on before the entry is removed, as removing it invalidates its position in the list.
+                    auto itNext = std::next(itLru);
+                    Erase(itResource);
+                    itLru = itNext;
+                    
+                    ++m_numEvictions;
+                }
+            }
+        }
+        //------------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------------
         void ResourcePool::OnMemoryWarning()
         {
             ReleaseAllUnused();
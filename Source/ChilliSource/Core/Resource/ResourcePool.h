@@ -36,10 +36,13 @@
 #include <ChilliSource/Core/Resource/Resource.h>
 #include <ChilliSource/Core/Resource/ResourceProvider.h>
 #include <ChilliSource/Core/System/AppSystem.h>
+#include <ChilliSource/Core/Threading/ReadWriteMutex.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
 #include <functional>
-#include <mutex>
+#include <list>
+#include <map>
+#include <memory>
 #include <unordered_map>
 
 namespace ChilliSource
@@ -52,6 +55,23 @@ namespace ChilliSource
         /// same resource will return the cached copy. The resource pool always holds the last
         /// reference to any resource.
         ///
+        /// Each resource type is cached separately, with its own reader/writer lock, so
+        /// loader threads working on different resource types don't contend with each other
+        /// and lookups of already cached resources can proceed in parallel.
+        ///
+        /// A memory budget can be set for each resource type. When the resources of a type
+        /// exceed their budget, the least recently used resources which are no longer
+        /// referenced outside of the pool are released until it is back within budget.
+        /// This relies on resources reporting their memory usage; see
+        /// Resource::GetMemoryUsage().
+        ///
+        /// The pool records which resources each loaded resource depends on, for example
+        /// the textures referenced by a material. This allows a set of resources, such as
+        /// those listed in a state's preload manifest, to be loaded in parallel along with
+        /// everything they depend on, rather than each dependency only being discovered as
+        /// its parent is parsed. The recorded dependencies are kept for the lifetime of the
+        /// pool, even after the resources themselves have been released.
+        ///
         /// @author S Downie
         //------------------------------------------------------------------------------------
         class ResourcePool final : public AppSystem
@@ -59,6 +79,39 @@ namespace ChilliSource
         public:
             
             CS_DECLARE_NAMEDTYPE(ResourcePool);
+            //------------------------------------------------------------------------------------
+            /// Statistics on the cache for a single resource type.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------------
+            struct CacheStatistics
+            {
+                u32 m_numResources = 0;
+                u64 m_memoryUsage = 0;
+                u64 m_memoryBudget = 0;
+                u32 m_numEvictions = 0;
+            };
+            //------------------------------------------------------------------------------------
+            /// A delegate called as each resource in a preload set finishes loading. The number
+            /// of resources to load can increase as the dependencies of loaded resources are
+            /// discovered.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The number of resources which have finished loading, or failed to load.
+            /// @param The total number of resources currently in the preload set.
+            //------------------------------------------------------------------------------------
+            using PreloadProgressDelegate = std::function<void(u32 in_numLoaded, u32 in_numToLoad)>;
+            //------------------------------------------------------------------------------------
+            /// A delegate called once every resource in a preload set, and everything they
+            /// depend on, has either loaded or failed.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The requested resources, in the order they were requested. Check the
+            /// load state of each before use; any may be null, indicating failure.
+            //------------------------------------------------------------------------------------
+            using PreloadDelegate = std::function<void(const std::vector<ResourceCSPtr>& in_resources)>;
             
             //------------------------------------------------------------------------------------
             /// Factory method for creating the system
@@ -83,6 +136,22 @@ namespace ChilliSource
             //------------------------------------------------------------------------------------
             void AddProvider(ResourceProvider* in_provider);
             //------------------------------------------------------------------------------------
+            /// Registers a resource type so that it can be loaded by preloading, which only
+            /// knows the interface Id of the resources it loads. All engine resource types are
+            /// registered by the application; application specific resource types must be
+            /// registered before they can be preloaded. This must be called on the main thread.
+            ///
+            /// Resource types whose providers cannot load asynchronously are instead preloaded
+            /// synchronously on the main thread, after the resources they are known to depend
+            /// on have been started.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Whether or not the providers of the resource type support asynchronous
+            /// loading.
+            //------------------------------------------------------------------------------------
+            template <typename TResourceType> void RegisterResourceType(bool in_supportsAsyncLoading = true);
+            //------------------------------------------------------------------------------------
             /// Creates an unloaded mutable resource with the given Id. The resource will be
             /// cached by the pool. The responsibility for loading or building the resource
             /// lies with the app code. Attempting to create a resource with an exisiting Id will
@@ -181,6 +250,9 @@ namespace ChilliSource
             /// if it has loaded successfully or not. NOTE: The resource may be null which also
             /// indicates failure
             ///
+            /// If the resource is already being loaded by a previous call, no additional load
+            /// is started; the delegate will instead be called once the in-flight load completes.
+            ///
             /// @author S Downie
             ///
             /// @param Storage location
@@ -211,6 +283,69 @@ namespace ChilliSource
             /// called on the main thread
             //-------------------------------------------------------------------------------------
             template <typename TResourceType> void LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate);
+            //------------------------------------------------------------------------------------
+            /// Loads a batch of resources of the given type in parallel. Each resource is
+            /// loaded as though by LoadResourceAsync(), but the delegate is only called once,
+            /// after every resource in the batch has either loaded or failed.
+            ///
+            /// The resources are immutable
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Storage location
+            /// @param The file paths of the resources to load.
+            /// @param Delegate to trigger when all resources have loaded or failed. The
+            /// resources are in the same order as the file paths; check the load state of each
+            /// before use. Any may be null, indicating failure. Note: Always called on the main
+            /// thread
+            //-------------------------------------------------------------------------------------
+            template <typename TResourceType> void LoadResourcesAsync(StorageLocation in_location, const std::vector<std::string>& in_filePaths, const std::function<void(const std::vector<std::shared_ptr<const TResourceType>>&)>& in_delegate);
+            //------------------------------------------------------------------------------------
+            /// Loads the resources listed in the given preload manifest, along with every
+            /// resource they are known to depend on, in parallel. The manifest is a json file
+            /// in the following format, where the location is optional and defaults to Package:
+            ///
+            ///  {
+            ///    "Resources":
+            ///    [
+            ///      { "Type": "Material", "Location": "Package", "Path": "Materials/Ground.csmaterial" },
+            ///      { "Type": "WidgetDef", "Path": "Widgets/Menu.csuidef" }
+            ///    ]
+            ///  }
+            ///
+            /// The type is the type name of the resource, which must have been registered with
+            /// RegisterResourceType(). The resources are loaded with their default options.
+            /// This must be called on the main thread.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The storage location of the manifest.
+            /// @param The file path of the manifest.
+            /// @param Delegate called as each resource finishes loading. May be null. Note:
+            /// Always called on the main thread
+            /// @param Delegate called once all resources have loaded or failed, with the
+            /// resources listed in the manifest in the order they are listed. Note: Always
+            /// called on the main thread
+            //-------------------------------------------------------------------------------------
+            void PreloadResourcesAsync(StorageLocation in_manifestLocation, const std::string& in_manifestPath, const PreloadProgressDelegate& in_progressDelegate, const PreloadDelegate& in_delegate);
+            //------------------------------------------------------------------------------------
+            /// Loads the given resources, along with every resource they are known to depend
+            /// on, in parallel. Any dependencies recorded from previous loads are requested up
+            /// front; dependencies which have not yet been recorded are requested as soon as the
+            /// resource which depends on them has loaded. This must be called on the main
+            /// thread.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Descriptions of the resources to load. The resource types must have been
+            /// registered with RegisterResourceType().
+            /// @param Delegate called as each resource finishes loading. May be null. Note:
+            /// Always called on the main thread
+            /// @param Delegate called once all resources have loaded or failed, with the
+            /// requested resources in the order they were requested. Note: Always called on
+            /// the main thread
+            //-------------------------------------------------------------------------------------
+            void PreloadResourcesAsync(const std::vector<Resource::Dependency>& in_resources, const PreloadProgressDelegate& in_progressDelegate, const PreloadDelegate& in_delegate);
             //-------------------------------------------------------------------------------------
             /// Forces the pool to release its handle to any unused resources of the given type.
             /// If a resource is still in use the pool will keep it in the cache. The pool is
@@ -230,6 +365,43 @@ namespace ChilliSource
             //-------------------------------------------------------------------------------------
             void ReleaseAllUnused();
             //-------------------------------------------------------------------------------------
+            /// Sets the memory budget for resources of the given type. Whenever the memory used
+            /// by the cached resources of the type exceeds the budget, the least recently used
+            /// resources which are only referenced by the pool will be released until the type
+            /// is back within budget. If all resources are still in use the budget may be
+            /// exceeded. This must be called on the main thread.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The memory budget in bytes. A budget of 0 means there is no budget, which
+            /// is the default.
+            //-------------------------------------------------------------------------------------
+            template <typename TResourceType> void SetMemoryBudget(u64 in_budget);
+            //-------------------------------------------------------------------------------------
+            /// Sets the memory budget for resources of the given type. See the templated
+            /// version for more information.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The interface Id of the resource type.
+            /// @param The memory budget in bytes, or 0 for no budget.
+            //-------------------------------------------------------------------------------------
+            void SetMemoryBudget(InterfaceIDType in_resourceType, u64 in_budget);
+            //-------------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The current statistics for the cache of the given resource type.
+            //-------------------------------------------------------------------------------------
+            template <typename TResourceType> CacheStatistics GetCacheStatistics() const;
+            //-------------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The interface Id of the resource type.
+            ///
+            /// @return The current statistics for the cache of the given resource type.
+            //-------------------------------------------------------------------------------------
+            CacheStatistics GetCacheStatistics(InterfaceIDType in_resourceType) const;
+            //-------------------------------------------------------------------------------------
             /// Remove the resource from the resource pool and cause it
             /// to be destroyed. This will assert if the resource has
             /// any references so call with a raw pointer i.e.
@@ -256,14 +428,81 @@ namespace ChilliSource
         private:
             
             //-------------------------------------------------------------------------------------
-            /// Descriptor that holds the providers and cached resources for a given type
+            /// A single cached resource, along with its memory usage at the time it was last
+            /// measured and its position in the least recently used list.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------------------------------------
+            struct CacheEntry
+            {
+                ResourceSPtr m_resource;
+                u64 m_memoryUsage = 0;
+                std::list<Resource::ResourceId>::iterator m_lruPosition;
+            };
+            //-------------------------------------------------------------------------------------
+            /// Descriptor that holds the providers and cached resources for a given type.
+            ///
+            /// Unless stated otherwise the methods require the caller to hold a write lock on
+            /// the descriptor's mutex.
             ///
             /// @author S Downie
             //-------------------------------------------------------------------------------------
             struct PoolDesc
             {
+                //-------------------------------------------------------------------------------------
+                /// Adds a resource to the cache as the most recently used.
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The resource Id.
+                /// @param The resource.
+                //-------------------------------------------------------------------------------------
+                void Add(Resource::ResourceId in_resourceId, const ResourceSPtr& in_resource);
+                //-------------------------------------------------------------------------------------
+                /// Marks the given entry as the most recently used. This only requires a read
+                /// lock.
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The cache entry.
+                //-------------------------------------------------------------------------------------
+                void Touch(const CacheEntry& in_entry) const;
+                //-------------------------------------------------------------------------------------
+                /// Removes a resource from the cache.
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The iterator of the resource to remove.
+                ///
+                /// @return The iterator following the removed resource.
+                //-------------------------------------------------------------------------------------
+                std::unordered_map<Resource::ResourceId, CacheEntry>::iterator Erase(std::unordered_map<Resource::ResourceId, CacheEntry>::iterator in_iterator);
+                //-------------------------------------------------------------------------------------
+                /// Re-measures the memory used by the given resource, for example after it has
+                /// finished loading.
+                ///
+                /// @author Carlos Artesano
+                ///
+                /// @param The resource Id.
+                //-------------------------------------------------------------------------------------
+                void UpdateMemoryUsage(Resource::ResourceId in_resourceId);
+                //-------------------------------------------------------------------------------------
+                /// Releases the least recently used unreferenced resources until the memory
+                /// usage is within the budget. Must be called on the main thread.
+                ///
+                /// @author Carlos Artesano
+                //-------------------------------------------------------------------------------------
+                void EnforceMemoryBudget();
+                
                 std::vector<ResourceProvider*> m_providers;
-                std::unordered_map<Resource::ResourceId, ResourceSPtr> m_cachedResources;
+                std::unordered_map<Resource::ResourceId, CacheEntry> m_cachedResources;
+                std::unordered_map<Resource::ResourceId, std::vector<ResourceProvider::AsyncLoadDelegate>> m_pendingLoads;
+                mutable std::list<Resource::ResourceId> m_lruList;
+                mutable std::mutex m_lruMutex;
+                u64 m_memoryUsage = 0;
+                u64 m_memoryBudget = 0;
+                u32 m_numEvictions = 0;
+                mutable ReadWriteMutex m_mutex;
             };
             //------------------------------------------------------------------------------------
             /// Called when the system receieves a memory warning. This will force the pool
@@ -273,6 +512,28 @@ namespace ChilliSource
             //------------------------------------------------------------------------------------
             void OnMemoryWarning() override;
             //------------------------------------------------------------------------------------
+            /// Finds the descriptor for the given resource type. Descriptors are never
+            /// removed, so the returned pointer remains valid for the lifetime of the pool.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The interface Id of the resource type.
+            ///
+            /// @return The descriptor or null if there isn't one for the type.
+            //------------------------------------------------------------------------------------
+            PoolDesc* FindDescriptor(InterfaceIDType in_resourceType) const;
+            //------------------------------------------------------------------------------------
+            /// Finds the descriptor for the given resource type, creating it if it doesn't
+            /// already exist.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The interface Id of the resource type.
+            ///
+            /// @return The descriptor.
+            //------------------------------------------------------------------------------------
+            PoolDesc& GetOrCreateDescriptor(InterfaceIDType in_resourceType);
+            //------------------------------------------------------------------------------------
             /// @author S Downie
             ///
             /// @param File path
@@ -299,36 +560,208 @@ namespace ChilliSource
             /// @return Unique ID based on the location and path
             //------------------------------------------------------------------------------------
             Resource::ResourceId GenerateResourceId(const std::string& in_uniqueId) const;
+            //------------------------------------------------------------------------------------
+            /// Confirms that a cached resource found by Id is the resource which was
+            /// requested, rather than a different resource whose Id collides with it. A
+            /// collision is a fatal error.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The cached resource.
+            /// @param The storage location of the requested resource.
+            /// @param The file path or unique Id of the requested resource.
+            //------------------------------------------------------------------------------------
+            void CheckForIdCollision(const Resource* in_cachedResource, StorageLocation in_location, const std::string& in_name) const;
+            //------------------------------------------------------------------------------------
+            /// Removes the in-flight async load of the given resource, returning the delegates
+            /// of any callers which requested the resource while it was loading. The memory
+            /// usage of the newly loaded resource is measured and the memory budget is
+            /// enforced.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The interface Id of the resource type.
+            /// @param The resource Id.
+            ///
+            /// @return The delegates waiting on the load.
+            //------------------------------------------------------------------------------------
+            std::vector<ResourceProvider::AsyncLoadDelegate> CompleteAsyncLoad(InterfaceIDType in_resourceType, Resource::ResourceId in_resourceId);
             
         private:
             
-            std::unordered_map<InterfaceIDType, PoolDesc> m_descriptors;
-            mutable std::mutex m_mutex;
+            //------------------------------------------------------------------------------------
+            /// Identifies a single resource in the dependency graph by its type and Id.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------------
+            using DependencyKey = std::pair<InterfaceIDType, Resource::ResourceId>;
+            //------------------------------------------------------------------------------------
+            /// Loads a resource of a registered type asynchronously.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------------
+            using ResourceLoader = std::function<void(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const std::function<void(const ResourceCSPtr&)>& in_delegate)>;
+            
+            struct PreloadState;
+            
+            //------------------------------------------------------------------------------------
+            /// Registers the loader for the given resource type.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The interface Id of the resource type.
+            /// @param The loader.
+            //------------------------------------------------------------------------------------
+            void RegisterResourceType(InterfaceIDType in_resourceType, const ResourceLoader& in_loader);
+            //------------------------------------------------------------------------------------
+            /// Marks the given resource as being loaded synchronously, so that any resources
+            /// loaded while it is being created are recorded as its dependencies. Must be
+            /// called on the main thread and balanced by a call to PopLoadingResource().
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The resource which is about to be loaded.
+            //------------------------------------------------------------------------------------
+            void PushLoadingResource(const ResourceSPtr& in_resource);
+            //------------------------------------------------------------------------------------
+            /// Marks the most recent resource passed to PushLoadingResource() as no longer
+            /// loading, and records its dependencies in the dependency graph if it loaded
+            /// successfully.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------------
+            void PopLoadingResource();
+            //------------------------------------------------------------------------------------
+            /// If a resource is currently being loaded synchronously on this thread, records
+            /// that it depends on the given resource.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The resource which was requested.
+            //------------------------------------------------------------------------------------
+            void RecordDependency(const ResourceCSPtr& in_resource);
+            //------------------------------------------------------------------------------------
+            /// Stores the current dependencies of the given resource in the dependency graph.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The resource.
+            //------------------------------------------------------------------------------------
+            void RecordDependencyGraph(const Resource* in_resource);
+            //------------------------------------------------------------------------------------
+            /// Calculates the dependency graph key of the described resource. If no options
+            /// are given the default options of the provider which would load it are used, so
+            /// the key matches that of the loaded resource.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The resource description.
+            /// @param [Out] The key.
+            ///
+            /// @return Whether or not the key could be calculated. This will fail if there is
+            /// no provider which can load the resource.
+            //------------------------------------------------------------------------------------
+            bool TryGetDependencyKey(const Resource::Dependency& in_resource, DependencyKey& out_key);
+            //------------------------------------------------------------------------------------
+            /// Adds the described resource to the preload set if it is not already in it, along
+            /// with every resource it is recorded as depending on.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The preload state.
+            /// @param The resource description.
+            //------------------------------------------------------------------------------------
+            void PreloadDependency(const std::shared_ptr<PreloadState>& in_state, const Resource::Dependency& in_resource);
+            //------------------------------------------------------------------------------------
+            /// Adds every resource which the given resource is recorded as depending on to the
+            /// preload set.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The preload state.
+            /// @param The key of the resource.
+            //------------------------------------------------------------------------------------
+            void PreloadRecordedDependencies(const std::shared_ptr<PreloadState>& in_state, const DependencyKey& in_key);
+            //------------------------------------------------------------------------------------
+            /// Starts loading the described resource as part of the preload set.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The preload state.
+            /// @param The resource description.
+            /// @param The index of the resource in the requested resources, or -1 if it is
+            /// a dependency.
+            //------------------------------------------------------------------------------------
+            void StartPreload(const std::shared_ptr<PreloadState>& in_state, const Resource::Dependency& in_resource, s32 in_requestIndex);
+            //------------------------------------------------------------------------------------
+            /// Calls the preload delegate if every resource in the preload set has finished
+            /// loading.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The preload state.
+            //------------------------------------------------------------------------------------
+            void CheckPreloadComplete(const std::shared_ptr<PreloadState>& in_state);
+            
+            std::unordered_map<InterfaceIDType, std::unique_ptr<PoolDesc>> m_descriptors;
+            mutable ReadWriteMutex m_descriptorsMutex;
+            
+            std::unordered_map<InterfaceIDType, ResourceLoader> m_resourceLoaders;
+            std::vector<ResourceSPtr> m_loadingResources;
+            std::map<DependencyKey, std::vector<Resource::Dependency>> m_dependencyGraph;
+            std::mutex m_dependencyGraphMutex;
         };
         //------------------------------------------------------------------------------------
         //-------------------------------------------------------------------------------------
+        template <typename TResourceType> void ResourcePool::RegisterResourceType(bool in_supportsAsyncLoading)
+        {
+            if(in_supportsAsyncLoading == true)
+            {
+                RegisterResourceType(TResourceType::InterfaceID, [this](StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const std::function<void(const ResourceCSPtr&)>& in_delegate)
+                {
+                    IResourceOptionsCSPtr<TResourceType> options(std::static_pointer_cast<const IResourceOptions<TResourceType>>(in_options));
+                    LoadResourceAsync<TResourceType>(in_location, in_filePath, options, [=](const std::shared_ptr<const TResourceType>& in_resource)
+                    {
+                        in_delegate(in_resource);
+                    });
+                });
+            }
+            else
+            {
+                //The load is deferred so that any dependencies which have already been started can load in parallel first.
+                RegisterResourceType(TResourceType::InterfaceID, [this](StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const std::function<void(const ResourceCSPtr&)>& in_delegate)
+                {
+                    IResourceOptionsCSPtr<TResourceType> options(std::static_pointer_cast<const IResourceOptions<TResourceType>>(in_options));
+                    Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask([=]()
+                    {
+                        in_delegate(LoadResource<TResourceType>(in_location, in_filePath, options));
+                    });
+                });
+            }
+        }
+        //------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
         template <typename TResourceType> std::shared_ptr<const TResourceType> ResourcePool::GetResource(const std::string& in_uniqueId) const
         {
             CS_ASSERT(in_uniqueId.empty() == false, "Cannot find resource with empty unique Id");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            
-            if(itDescriptor == m_descriptors.end())
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
+            if(desc == nullptr)
             {
                 CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
                 return nullptr;
             }
             
-            const PoolDesc& desc(itDescriptor->second);
-            
             //Check descriptor and see if this resource already exists
             Resource::ResourceId resourceId = GenerateResourceId(in_uniqueId);
-            auto itResource = desc.m_cachedResources.find(resourceId);
-            if(itResource != desc.m_cachedResources.end())
+            
+            ReadLock lock(desc->m_mutex);
+            auto itResource = desc->m_cachedResources.find(resourceId);
+            if(itResource != desc->m_cachedResources.end())
             {
-                return std::static_pointer_cast<const TResourceType>(itResource->second);
+                CheckForIdCollision(itResource->second.m_resource.get(), StorageLocation::k_none, in_uniqueId);
+                desc->Touch(itResource->second);
+                return std::static_pointer_cast<const TResourceType>(itResource->second.m_resource);
             }
             
             return nullptr;
@@ -337,17 +770,16 @@ namespace ChilliSource
         //-------------------------------------------------------------------------------------
         template <typename TResourceType> std::vector<std::shared_ptr<const TResourceType>> ResourcePool::GetAllResources() const
         {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
             std::vector<std::shared_ptr<const TResourceType>> output;
             
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            if(itDescriptor != m_descriptors.end())
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
+            if(desc != nullptr)
             {
-                const PoolDesc& desc(itDescriptor->second);
-                for (const auto& resource : desc.m_cachedResources)
+                ReadLock lock(desc->m_mutex);
+                output.reserve(desc->m_cachedResources.size());
+                for (const auto& resource : desc->m_cachedResources)
                 {
-                    output.push_back(std::static_pointer_cast<const TResourceType>(resource.second));
+                    output.push_back(std::static_pointer_cast<const TResourceType>(resource.second.m_resource));
                 }
             }
             
@@ -364,21 +796,12 @@ namespace ChilliSource
             resource->SetId(resourceId);
             resource->SetName(in_uniqueId);
             
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            if(itDescriptor == m_descriptors.end())
-            {
-                PoolDesc desc;
-                desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
-                m_descriptors.insert(std::make_pair(TResourceType::InterfaceID, desc));
-                return resource;
-            }
+            PoolDesc& desc = GetOrCreateDescriptor(TResourceType::InterfaceID);
             
             //Check to make sure this doesn't already exist
-            PoolDesc& desc(itDescriptor->second);
+            WriteLock lock(desc.m_mutex);
             CS_ASSERT(desc.m_cachedResources.find(resourceId) == desc.m_cachedResources.end(), "Resource with Id: " + in_uniqueId + " already exists");
-            desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+            desc.Add(resourceId, resource);
             
             return resource;
         }
@@ -389,24 +812,21 @@ namespace ChilliSource
             CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be loaded on the main thread - use LoadResourceAsync");
             CS_ASSERT(in_filePath.empty() == false, "Cannot load resource with no file path");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            
-            if(itDescriptor == m_descriptors.end())
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
+            if(desc == nullptr)
             {
                 CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
                 return nullptr;
             }
             
-            PoolDesc& desc(itDescriptor->second);
-            
             //Find a provider that can load this resource
-			ResourceProvider* provider = FindProvider(in_filePath, desc);
+            ReadLock readLock(desc->m_mutex);
+			ResourceProvider* provider = FindProvider(in_filePath, *desc);
             if(provider == nullptr)
             {
                 return nullptr;
             }
-            lock.unlock();
+            readLock.Unlock();
             
             IResourceOptionsBaseCSPtr options(in_options);
             if(options == nullptr)
@@ -417,13 +837,20 @@ namespace ChilliSource
             //Check descriptor and see if this resource already exists
 			Resource::ResourceId resourceId = GenerateResourceId(in_location, in_filePath, options);
             
-            lock.lock();
-            auto itResource = desc.m_cachedResources.find(resourceId);
-            if(itResource != desc.m_cachedResources.end())
+            readLock.Lock();
+            auto itResource = desc->m_cachedResources.find(resourceId);
+            if(itResource != desc->m_cachedResources.end())
             {
-                return std::static_pointer_cast<TResourceType>(itResource->second);
+                CheckForIdCollision(itResource->second.m_resource.get(), in_location, in_filePath);
+                desc->Touch(itResource->second);
+                
+                ResourceSPtr cachedResource(itResource->second.m_resource);
+                readLock.Unlock();
+                
+                RecordDependency(cachedResource);
+                return std::static_pointer_cast<TResourceType>(cachedResource);
             }
-            lock.unlock();
+            readLock.Unlock();
             
             //Load the resource
             ResourceSPtr resource(TResourceType::Create());
@@ -434,26 +861,30 @@ namespace ChilliSource
             resource->SetId(resourceId);
 
 			std::string deviceFilePath = Application::Get()->GetTaggedFilePathResolver()->ResolveFilePath(in_location, in_filePath);
+            PushLoadingResource(resource);
             provider->CreateResourceFromFile(in_location, deviceFilePath, options, resource);
+            PopLoadingResource();
             if(resource->GetLoadState() != Resource::LoadState::k_loaded)
             {
 				CS_LOG_ERROR("Failed to create resource for " + in_filePath);
                 return nullptr;
             }
             
-            lock.lock();
+            WriteLock writeLock(desc->m_mutex);
             //Check the async call hasn't sneaked in here with the same resource
-            itResource = desc.m_cachedResources.find(resourceId);
-            if(itResource == desc.m_cachedResources.end())
+            itResource = desc->m_cachedResources.find(resourceId);
+            if(itResource == desc->m_cachedResources.end())
             {
-                desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+                desc->Add(resourceId, resource);
+                desc->EnforceMemoryBudget();
             }
             else
             {
-                resource = itResource->second;
+                resource = itResource->second.m_resource;
             }
-            lock.unlock();
+            writeLock.Unlock();
             
+            RecordDependency(resource);
             return std::static_pointer_cast<TResourceType>(resource);
         }
         //-------------------------------------------------------------------------------------
@@ -463,24 +894,21 @@ namespace ChilliSource
             CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be refreshed on the main thread");
             CS_ASSERT(in_filePath.empty() == false, "Cannot refresh resource with no file path");
             
-			std::unique_lock<std::mutex> lock(m_mutex);
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            
-            if(itDescriptor == m_descriptors.end())
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
+            if(desc == nullptr)
             {
                 CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
                 return nullptr;
             }
             
-            PoolDesc& desc(itDescriptor->second);
-            
             //Find a provider that can load this resource
-			ResourceProvider* provider = FindProvider(in_filePath, desc);
+            ReadLock lock(desc->m_mutex);
+			ResourceProvider* provider = FindProvider(in_filePath, *desc);
             if(provider == nullptr)
             {
                 return nullptr;
             }
-            lock.unlock();
+            lock.Unlock();
             
             IResourceOptionsBaseCSPtr options(in_options);
             if(options == nullptr)
@@ -491,28 +919,37 @@ namespace ChilliSource
             //Check descriptor and see if this resource already exists
 			Resource::ResourceId resourceId = GenerateResourceId(in_location, in_filePath, options);
             
-            lock.lock();
-            auto itResource = desc.m_cachedResources.find(resourceId);
-            if(itResource == desc.m_cachedResources.end())
+            lock.Lock();
+            auto itResource = desc->m_cachedResources.find(resourceId);
+            if(itResource == desc->m_cachedResources.end())
             {
 				CS_LOG_ERROR("Failed to refresh non-existing resource for " + in_filePath);
                 return nullptr;
             }
+            CheckForIdCollision(itResource->second.m_resource.get(), in_location, in_filePath);
             
             //Load the resource
-            ResourceSPtr resource(itResource->second);
+            ResourceSPtr resource(itResource->second.m_resource);
             
-            lock.unlock();
+            lock.Unlock();
             
             resource->SetLoadState(Resource::LoadState::k_loading);
+            resource->ClearDependencies();
 			std::string deviceFilePath = Application::Get()->GetTaggedFilePathResolver()->ResolveFilePath(in_location, in_filePath);
+            PushLoadingResource(resource);
             provider->CreateResourceFromFile(in_location, deviceFilePath, options, resource);
+            PopLoadingResource();
             if(resource->GetLoadState() != Resource::LoadState::k_loaded)
             {
                 CS_LOG_ERROR("Failed to refresh resource for " + deviceFilePath);
                 return nullptr;
             }
             
+            WriteLock writeLock(desc->m_mutex);
+            desc->UpdateMemoryUsage(resourceId);
+            desc->EnforceMemoryBudget();
+            writeLock.Unlock();
+            
             return std::static_pointer_cast<TResourceType>(resource);
         }
         //------------------------------------------------------------------------------------
@@ -521,26 +958,29 @@ namespace ChilliSource
         {
             CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be refreshed on the main thread");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
-            
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            
-            if(itDescriptor == m_descriptors.end())
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
+            if(desc == nullptr)
             {
                 CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
                 return;
             }
             
-            PoolDesc& desc(itDescriptor->second);
+            //Take a copy of the cached resources so that the lock isn't held while reloading.
+            ReadLock lock(desc->m_mutex);
+            std::vector<ResourceSPtr> resources;
+            resources.reserve(desc->m_cachedResources.size());
+            for(const auto& resourceEntry : desc->m_cachedResources)
+            {
+                resources.push_back(resourceEntry.second.m_resource);
+            }
+            lock.Unlock();
             
-            for(auto& resourceEntry : desc.m_cachedResources)
+            for(auto& resource : resources)
             {
-                ResourceSPtr& resource(resourceEntry.second);
-                
                 if(resource->GetStorageLocation() != CSCore::StorageLocation::k_none)
                 {
                     //Find a provider that can load this resource
-                    ResourceProvider* provider = FindProvider(resource->GetFilePath(), desc);
+                    ResourceProvider* provider = FindProvider(resource->GetFilePath(), *desc);
                     if(provider == nullptr)
                     {
                         CS_LOG_ERROR("Failed to find resource provider for " + resource->GetName());
@@ -548,8 +988,11 @@ namespace ChilliSource
                     }
                     
                     resource->SetLoadState(Resource::LoadState::k_loading);
+                    resource->ClearDependencies();
                     std::string deviceFilePath = Application::Get()->GetTaggedFilePathResolver()->ResolveFilePath(resource->GetStorageLocation(), resource->GetFilePath());
+                    PushLoadingResource(resource);
                     provider->CreateResourceFromFile(resource->GetStorageLocation(), deviceFilePath, resource->GetOptions(), resource);
+                    PopLoadingResource();
                     if(resource->GetLoadState() != Resource::LoadState::k_loaded)
                     {
                         CS_LOG_ERROR("Failed to refresh resource for " + resource->GetName());
@@ -557,6 +1000,13 @@ namespace ChilliSource
                     }
                 }
             }
+            
+            WriteLock writeLock(desc->m_mutex);
+            for(const auto& resource : resources)
+            {
+                desc->UpdateMemoryUsage(resource->GetId());
+            }
+            desc->EnforceMemoryBudget();
         }
         //-------------------------------------------------------------------------------------
         //-------------------------------------------------------------------------------------
@@ -571,26 +1021,24 @@ namespace ChilliSource
             CS_ASSERT(in_filePath.empty() == false, "Cannot load resource async with no file path");
             CS_ASSERT(in_delegate != nullptr, "Cannot load resource async with null delegate");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            
-            if(itDescriptor == m_descriptors.end())
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
+            if(desc == nullptr)
             {
                 CS_LOG_ERROR("Failed to find resource provider for " + TResourceType::TypeName);
                 in_delegate(nullptr);
                 return;
             }
             
-            PoolDesc& desc(itDescriptor->second);
-            
             //Find a provider that can load this resource
-			ResourceProvider* provider = FindProvider(in_filePath, desc);
+            ReadLock readLock(desc->m_mutex);
+			ResourceProvider* provider = FindProvider(in_filePath, *desc);
             if(provider == nullptr)
             {
+                readLock.Unlock();
                 in_delegate(nullptr);
                 return;
             }
-            lock.unlock();
+            readLock.Unlock();
             
             IResourceOptionsBaseCSPtr options(in_options);
             if(options == nullptr)
@@ -601,11 +1049,50 @@ namespace ChilliSource
             //Check descriptor and see if this resource already exists
 			Resource::ResourceId resourceId = GenerateResourceId(in_location, in_filePath, options);
             
-            lock.lock();
-            auto itResource = desc.m_cachedResources.find(resourceId);
-            if(itResource != desc.m_cachedResources.end())
+            ResourceProvider::AsyncLoadDelegate convertDelegate([=](const ResourceSPtr& in_resource)
+            {
+                in_delegate(std::static_pointer_cast<const TResourceType>(in_resource));
+            });
+            
+            //Most requests are for resources which have already loaded, so check with only a read lock first.
+            readLock.Lock();
+            auto itResource = desc->m_cachedResources.find(resourceId);
+            if(itResource != desc->m_cachedResources.end() && desc->m_pendingLoads.find(resourceId) == desc->m_pendingLoads.end())
             {
-                in_delegate(std::static_pointer_cast<const TResourceType>(itResource->second));
+                CheckForIdCollision(itResource->second.m_resource.get(), in_location, in_filePath);
+                desc->Touch(itResource->second);
+                
+                ResourceSPtr cachedResource(itResource->second.m_resource);
+                readLock.Unlock();
+                
+                RecordDependency(cachedResource);
+                convertDelegate(cachedResource);
+                return;
+            }
+            readLock.Unlock();
+            
+            WriteLock writeLock(desc->m_mutex);
+            itResource = desc->m_cachedResources.find(resourceId);
+            if(itResource != desc->m_cachedResources.end())
+            {
+                CheckForIdCollision(itResource->second.m_resource.get(), in_location, in_filePath);
+                desc->Touch(itResource->second);
+                
+                //If the resource is still being loaded, wait for the in-flight load rather than returning it early.
+                ResourceSPtr cachedResource(itResource->second.m_resource);
+                auto itPendingLoad = desc->m_pendingLoads.find(resourceId);
+                if(itPendingLoad != desc->m_pendingLoads.end())
+                {
+                    itPendingLoad->second.push_back(convertDelegate);
+                    writeLock.Unlock();
+                    
+                    RecordDependency(cachedResource);
+                    return;
+                }
+                writeLock.Unlock();
+                
+                RecordDependency(cachedResource);
+                convertDelegate(cachedResource);
                 return;
             }
             
@@ -617,17 +1104,76 @@ namespace ChilliSource
             resource->SetOptions(options);
             resource->SetId(resourceId);
 
-            //Add it to the cache
-            desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
-            lock.unlock();
+            //Add it to the cache and track the in-flight load
+            desc->Add(resourceId, resource);
+            desc->m_pendingLoads.insert(std::make_pair(resourceId, std::vector<ResourceProvider::AsyncLoadDelegate>()));
+            writeLock.Unlock();
             
-            ResourceProvider::AsyncLoadDelegate convertDelegate([=](const ResourceSPtr& in_resource)
+            RecordDependency(resource);
+            
+            ResourceProvider::AsyncLoadDelegate completionDelegate([=](const ResourceSPtr& in_resource)
             {
-                in_delegate(std::static_pointer_cast<const TResourceType>(in_resource));
+                std::vector<ResourceProvider::AsyncLoadDelegate> waiters = CompleteAsyncLoad(TResourceType::InterfaceID, resourceId);
+                
+                convertDelegate(in_resource);
+                for (const auto& waiter : waiters)
+                {
+                    waiter(in_resource);
+                }
             });
 
 			std::string deviceFilePath = Application::Get()->GetTaggedFilePathResolver()->ResolveFilePath(in_location, in_filePath);
-            provider->CreateResourceFromFileAsync(in_location, deviceFilePath, options, convertDelegate, resource);
+            provider->CreateResourceFromFileAsync(in_location, deviceFilePath, options, completionDelegate, resource);
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> void ResourcePool::LoadResourcesAsync(StorageLocation in_location, const std::vector<std::string>& in_filePaths, const std::function<void(const std::vector<std::shared_ptr<const TResourceType>>&)>& in_delegate)
+        {
+            CS_ASSERT(in_delegate != nullptr, "Cannot load resources async with null delegate");
+            
+            if(in_filePaths.empty() == true)
+            {
+                in_delegate(std::vector<std::shared_ptr<const TResourceType>>());
+                return;
+            }
+            
+            //The batch state is shared by the completion delegate of each resource. These are always
+            //called on the main thread, so it doesn't need to be guarded.
+            struct BatchState
+            {
+                std::vector<std::shared_ptr<const TResourceType>> m_resources;
+                u32 m_numRemaining;
+            };
+            
+            auto batchState = std::make_shared<BatchState>();
+            batchState->m_resources.resize(in_filePaths.size());
+            batchState->m_numRemaining = static_cast<u32>(in_filePaths.size());
+            
+            for(u32 i = 0; i < static_cast<u32>(in_filePaths.size()); ++i)
+            {
+                LoadResourceAsync<TResourceType>(in_location, in_filePaths[i], [=](const std::shared_ptr<const TResourceType>& in_resource)
+                {
+                    batchState->m_resources[i] = in_resource;
+                    
+                    CS_ASSERT(batchState->m_numRemaining > 0, "Resource batch completed more times than expected.");
+                    if(--batchState->m_numRemaining == 0)
+                    {
+                        in_delegate(batchState->m_resources);
+                    }
+                });
+            }
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> void ResourcePool::SetMemoryBudget(u64 in_budget)
+        {
+            SetMemoryBudget(TResourceType::InterfaceID, in_budget);
+        }
+        //-------------------------------------------------------------------------------------
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> ResourcePool::CacheStatistics ResourcePool::GetCacheStatistics() const
+        {
+            return GetCacheStatistics(TResourceType::InterfaceID);
         }
         //-------------------------------------------------------------------------------------
         /// Resources often have references to other resources and therefore multiple release passes
@@ -637,12 +1183,12 @@ namespace ChilliSource
         {
             CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be released on the main thread");
             
-            std::unique_lock<std::mutex> lock(m_mutex);
             //Find the descriptor that handles this type of resource
-            auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
-            CS_ASSERT(itDescriptor != m_descriptors.end(), "Failed to find resource provider for " + TResourceType::TypeName);
-
-            auto& cachedResources(itDescriptor->second.m_cachedResources);
+            PoolDesc* desc = FindDescriptor(TResourceType::InterfaceID);
+            CS_ASSERT(desc != nullptr, "Failed to find resource provider for " + TResourceType::TypeName);
+            
+            WriteLock lock(desc->m_mutex);
+            auto& cachedResources(desc->m_cachedResources);
             
             u32 numReleased = 0;
             
@@ -652,11 +1198,11 @@ namespace ChilliSource
                 
                 for(auto itResource = cachedResources.begin(); itResource != cachedResources.end(); /*NO INCREMENT*/)
                 {
-                    if(itResource->second.use_count() == 1)
+                    if(itResource->second.m_resource.use_count() == 1)
                     {
                         //The pool is the sole owner so we can safely release the object
-                        CS_LOG_VERBOSE("Releasing resource from pool " + itResource->second->GetName());
-                        itResource = cachedResources.erase(itResource);
+                        CS_LOG_VERBOSE("Releasing resource from pool " + itResource->second.m_resource->GetName());
+                        itResource = desc->Erase(itResource);
                         numReleased++;
                     }
                     else
@@ -31,5 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Scene/Scene.h>
+#include <ChilliSource/Core/Scene/SceneLoader.h>
+#include <ChilliSource/Core/Scene/SceneSerialiser.h>
 
 #endif
\ No newline at end of file
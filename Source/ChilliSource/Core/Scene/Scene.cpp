@@ -28,6 +28,10 @@
 
 #include <ChilliSource/Core/Scene/Scene.h>
 
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Entity/TransformHierarchy.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
 #include <algorithm>
 
 namespace ChilliSource
@@ -36,6 +40,31 @@ namespace ChilliSource
 	{
         CS_DEFINE_NAMEDTYPE(Scene);
         
+        namespace
+        {
+            u64 g_nextComponentInsertionOrder = 0;
+            const u32 k_notInUpdateList = std::numeric_limits<u32>::max();
+            const u32 k_parallelUpdateChunkSize = 128;
+            const u32 k_maxRecycledEntities = 1024;
+            
+            //-------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The entity.
+            ///
+            /// @return The root of the entity's hierarchy.
+            //-------------------------------------------------------
+            const Entity* GetRootEntity(const Entity* in_entity)
+            {
+                while (in_entity->GetParent() != nullptr)
+                {
+                    in_entity = in_entity->GetParent();
+                }
+                
+                return in_entity;
+            }
+        }
+        
         //-------------------------------------------------------
         //-------------------------------------------------------
         SceneUPtr Scene::Create()
@@ -46,6 +75,10 @@ namespace ChilliSource
         //-------------------------------------------------------
         Scene::Scene()
         {
+            for (bool& containsRemoved : m_updateListsContainRemoved)
+            {
+                containsRemoved = false;
+            }
         }
         //-------------------------------------------------------
         //-------------------------------------------------------
@@ -81,19 +114,14 @@ namespace ChilliSource
 		//-------------------------------------------------------
 		void Scene::UpdateEntities(f32 in_timeSinceLastUpdate)
 		{
-            for(u32 i = 0; i < m_entities.size(); ++i)
-			{
-                m_entities[i]->OnUpdate(in_timeSinceLastUpdate);
-            }
+            UpdateComponentsInParallel(in_timeSinceLastUpdate);
+            UpdateComponents(Component::UpdatePhase::k_update, in_timeSinceLastUpdate);
 		}
         //-------------------------------------------------------
 		//-------------------------------------------------------
 		void Scene::FixedUpdateEntities(f32 in_fixedTimeSinceLastUpdate)
 		{
-            for(u32 i=0; i<m_entities.size(); ++i)
-			{
-                m_entities[i]->OnFixedUpdate(in_fixedTimeSinceLastUpdate);
-            }
+            UpdateComponents(Component::UpdatePhase::k_fixedUpdate, in_fixedTimeSinceLastUpdate);
 		}
         //-------------------------------------------------------
 		//-------------------------------------------------------
@@ -119,6 +147,81 @@ namespace ChilliSource
                 (*it)->OnSuspend();
             }
 		}
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Scene::SetParallelUpdateEnabled(bool in_enabled)
+        {
+            m_parallelUpdateEnabled = in_enabled;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        bool Scene::IsParallelUpdateEnabled() const
+        {
+            return m_parallelUpdateEnabled;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Scene::SetNameIndexEnabled(bool in_enabled)
+        {
+            if (m_nameIndexEnabled == in_enabled)
+            {
+                return;
+            }
+            
+            m_nameIndexEnabled = in_enabled;
+            m_nameIndex.clear();
+            
+            if (m_nameIndexEnabled == true)
+            {
+                for (const auto& entity : m_entities)
+                {
+                    AddToNameIndex(entity.get());
+                }
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        bool Scene::IsNameIndexEnabled() const
+        {
+            return m_nameIndexEnabled;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Scene::SetContiguousTransformsEnabled(bool in_enabled)
+        {
+            if (in_enabled == IsContiguousTransformsEnabled())
+            {
+                return;
+            }
+            
+            if (in_enabled == true)
+            {
+                m_transformHierarchy = TransformHierarchyUPtr(new TransformHierarchy());
+                for (const auto& entity : m_entities)
+                {
+                    m_transformHierarchy->Add(&entity->GetTransform());
+                }
+            }
+            else
+            {
+                m_transformHierarchy.reset();
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        bool Scene::IsContiguousTransformsEnabled() const
+        {
+            return (m_transformHierarchy != nullptr);
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Scene::UpdateWorldTransforms()
+        {
+            if (m_transformHierarchy != nullptr)
+            {
+                m_transformHierarchy->UpdateWorldTransforms();
+            }
+        }
 		//-------------------------------------------------------
 		//-------------------------------------------------------
 		void Scene::Add(const EntitySPtr& in_entity)
@@ -143,6 +246,41 @@ namespace ChilliSource
                 }
             }
 		}
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Scene::Add(const std::vector<EntitySPtr>& in_entities)
+        {
+            //count the entities and their descendants so storage can be reserved.
+            u32 numEntities = 0;
+            std::vector<const Entity*> toCount;
+            for (const auto& entity : in_entities)
+            {
+                toCount.push_back(entity.get());
+            }
+            
+            while (toCount.empty() == false)
+            {
+                const Entity* entity = toCount.back();
+                toCount.pop_back();
+                
+                numEntities++;
+                for (const auto& child : entity->m_children)
+                {
+                    toCount.push_back(child.get());
+                }
+            }
+            
+            m_entities.reserve(m_entities.size() + numEntities);
+            if (m_transformHierarchy != nullptr)
+            {
+                m_transformHierarchy->Reserve(m_transformHierarchy->GetNumTransforms() + numEntities);
+            }
+            
+            for (const auto& entity : in_entities)
+            {
+                Add(entity);
+            }
+        }
 		//-------------------------------------------------------
 		//-------------------------------------------------------
 		void Scene::RemoveAllEntities()
@@ -168,6 +306,11 @@ namespace ChilliSource
 			}
             
             m_entities.clear();
+            
+            CS_ASSERT(m_componentPools.empty() == true, "Component pools should be empty once all entities have been removed.");
+            m_componentPools.clear();
+            m_componentPoolQueries.clear();
+            m_nameIndex.clear();
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
@@ -175,6 +318,57 @@ namespace ChilliSource
 		{
 			return m_entities;
 		}
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        EntitySPtr Scene::CreateEntity()
+        {
+            if (m_recycledEntities.empty() == true)
+            {
+                return Entity::CreatePooled();
+            }
+            
+            EntitySPtr entity = std::move(m_recycledEntities.back());
+            m_recycledEntities.pop_back();
+            return entity;
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Scene::RecycleEntity(EntitySPtr in_entity)
+        {
+            CS_ASSERT(in_entity != nullptr, "Cannot recycle a null entity.");
+            
+            if (in_entity->GetParent() != nullptr || in_entity->GetScene() != nullptr)
+            {
+                in_entity->RemoveFromParent();
+            }
+            
+            //the children are kept alive so they can be recycled once detached.
+            SharedEntityList children;
+            if (in_entity->m_children.empty() == false)
+            {
+                children = in_entity->m_children;
+            }
+            
+            in_entity->Reset();
+            CS_ASSERT(in_entity->GetTransform().GetLocalTransform() == Matrix4::k_identity && in_entity->GetTransform().GetWorldTransform() == Matrix4::k_identity,
+                      "A recycled entity must have identity local and world transforms.");
+            
+            for (EntitySPtr& child : children)
+            {
+                RecycleEntity(std::move(child));
+            }
+            
+            if (in_entity.use_count() == 1 && m_recycledEntities.size() < k_maxRecycledEntities)
+            {
+                m_recycledEntities.push_back(std::move(in_entity));
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Scene::ClearRecycledEntities()
+        {
+            m_recycledEntities.clear();
+        }
         //------------------------------------------------------
 		//------------------------------------------------------
 		void Scene::SetClearColour(const Core::Colour& in_colour)
@@ -245,12 +439,350 @@ namespace ChilliSource
                 it->swap(m_entities.back());
                 m_entities.pop_back();
             }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::OnComponentAdded(Component* in_component)
+        {
+            CS_ASSERT(m_isUpdatingInParallel == false, "Components cannot be added to the scene during the parallel update phase.");
+            
+            AddToComponentPool(in_component);
+            
+            for (u32 phase = 0; phase < static_cast<u32>(Component::UpdatePhase::k_total); ++phase)
+            {
+                if (in_component->IsUpdatePhaseRequired(static_cast<Component::UpdatePhase>(phase)) == true)
+                {
+                    in_component->m_sceneUpdateListIndices[phase] = static_cast<u32>(m_updateLists[phase].size());
+                    m_updateLists[phase].push_back(in_component);
+                    
+                    if (phase == static_cast<u32>(Component::UpdatePhase::k_parallelUpdate))
+                    {
+                        m_parallelUpdateListNeedsGrouping = true;
+                    }
+                }
+                else
+                {
+                    in_component->m_sceneUpdateListIndices[phase] = k_notInUpdateList;
+                }
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::OnComponentRemoved(Component* in_component)
+        {
+            CS_ASSERT(m_isUpdatingInParallel == false, "Components cannot be removed from the scene during the parallel update phase.");
+            
+            //entries are cleared rather than removed so the update order is preserved and the lists
+            //can safely be changed during an update. They are compacted after the next update.
+            for (u32 phase = 0; phase < static_cast<u32>(Component::UpdatePhase::k_total); ++phase)
+            {
+                const u32 index = in_component->m_sceneUpdateListIndices[phase];
+                if (index != k_notInUpdateList)
+                {
+                    CS_ASSERT(index < m_updateLists[phase].size() && m_updateLists[phase][index] == in_component, "Component update list is corrupt.");
+                    
+                    m_updateLists[phase][index] = nullptr;
+                    m_updateListsContainRemoved[phase] = true;
+                    in_component->m_sceneUpdateListIndices[phase] = k_notInUpdateList;
+                }
+            }
+            
+            RemoveFromComponentPool(in_component);
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::UpdateComponents(Component::UpdatePhase in_phase, f32 in_timeSinceLastUpdate)
+        {
+            const u32 phase = static_cast<u32>(in_phase);
+            std::vector<Component*>& updateList = m_updateLists[phase];
+            
+            //the list may grow during the update, so the size is checked on each iteration.
+            for (u32 i = 0; i < updateList.size(); ++i)
+            {
+                Component* component = updateList[i];
+                if (component != nullptr)
+                {
+                    switch (in_phase)
+                    {
+                        case Component::UpdatePhase::k_update:
+                            component->OnUpdate(in_timeSinceLastUpdate);
+                            break;
+                        case Component::UpdatePhase::k_fixedUpdate:
+                            component->OnFixedUpdate(in_timeSinceLastUpdate);
+                            break;
+                        default:
+                            CS_LOG_FATAL("Invalid update phase.");
+                            break;
+                    }
+                }
+            }
+            
+            CompactUpdateList(in_phase);
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::UpdateComponentsInParallel(f32 in_timeSinceLastUpdate)
+        {
+            const u32 phase = static_cast<u32>(Component::UpdatePhase::k_parallelUpdate);
+            std::vector<Component*>& updateList = m_updateLists[phase];
+            
+            CompactUpdateList(Component::UpdatePhase::k_parallelUpdate);
+            
+            //a transform change affects all descendants, so components from the same entity hierarchy must be
+            //updated on the same thread. Group them by root, then by entity.
+            if (m_parallelUpdateListNeedsGrouping == true)
+            {
+                std::stable_sort(updateList.begin(), updateList.end(), [](const Component* in_a, const Component* in_b)
+                {
+                    const Entity* rootA = GetRootEntity(in_a->GetEntity());
+                    const Entity* rootB = GetRootEntity(in_b->GetEntity());
+                    if (rootA != rootB)
+                    {
+                        return std::less<const Entity*>()(rootA, rootB);
+                    }
+                    
+                    return std::less<const Entity*>()(in_a->GetEntity(), in_b->GetEntity());
+                });
+                
+                for (u32 i = 0; i < updateList.size(); ++i)
+                {
+                    updateList[i]->m_sceneUpdateListIndices[phase] = i;
+                }
+                
+                m_parallelUpdateListNeedsGrouping = false;
+            }
+            
+            if (updateList.empty() == true)
+            {
+                return;
+            }
+            
+            //split into chunks, never splitting the components of an entity hierarchy across chunks.
+            std::vector<std::pair<u32, u32>> chunks;
+            const u32 numComponents = static_cast<u32>(updateList.size());
+            Component* const* components = updateList.data();
+            
+            u32 chunkStart = 0;
+            while (chunkStart < numComponents)
+            {
+                u32 chunkEnd = std::min(chunkStart + k_parallelUpdateChunkSize, numComponents);
+                while (chunkEnd < numComponents && GetRootEntity(components[chunkEnd]->GetEntity()) == GetRootEntity(components[chunkEnd - 1]->GetEntity()))
+                {
+                    ++chunkEnd;
+                }
+                
+                chunks.push_back(std::make_pair(chunkStart, chunkEnd));
+                chunkStart = chunkEnd;
+            }
+            
+            //transforms changed during the update can't be added to the shared changed list from the worker
+            //threads, so each chunk defers its changes to its own list to be committed afterwards.
+            std::vector<std::vector<Transform*>> changedTransforms(chunks.size());
+            std::vector<TaskScheduler::GenericTaskType> tasks;
+            tasks.reserve(chunks.size());
+            for (u32 chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex)
+            {
+                const u32 start = chunks[chunkIndex].first;
+                const u32 end = chunks[chunkIndex].second;
+                std::vector<Transform*>* chunkChangedTransforms = &changedTransforms[chunkIndex];
+                
+                tasks.push_back([=]()
+                {
+                    Transform::BeginDeferringChanges(*chunkChangedTransforms);
+                    
+                    for (u32 i = start; i < end; ++i)
+                    {
+                        components[i]->OnParallelUpdate(in_timeSinceLastUpdate);
+                    }
+                    
+                    Transform::EndDeferringChanges();
+                });
+            }
+            
+            m_isUpdatingInParallel = true;
+            
+            if (m_parallelUpdateEnabled == true)
+            {
+                Application::Get()->GetTaskScheduler()->ExecuteTasks(tasks);
+            }
+            else
+            {
+                for (const auto& task : tasks)
+                {
+                    task();
+                }
+            }
+            
+            m_isUpdatingInParallel = false;
+            
+            for (const auto& chunkChangedTransforms : changedTransforms)
+            {
+                Transform::CommitDeferredChanges(chunkChangedTransforms);
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::CompactUpdateList(Component::UpdatePhase in_phase)
+        {
+            const u32 phase = static_cast<u32>(in_phase);
+            
+            if (m_updateListsContainRemoved[phase] == true)
+            {
+                std::vector<Component*>& updateList = m_updateLists[phase];
+                
+                u32 numRemaining = 0;
+                for (Component* component : updateList)
+                {
+                    if (component != nullptr)
+                    {
+                        component->m_sceneUpdateListIndices[phase] = numRemaining;
+                        updateList[numRemaining++] = component;
+                    }
+                }
+                
+                updateList.resize(numRemaining);
+                m_updateListsContainRemoved[phase] = false;
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::AddToComponentPool(Component* in_component)
+        {
+            const InterfaceIDType typeId = in_component->GetInterfaceID();
+            
+            auto poolIt = m_componentPools.find(typeId);
+            if (poolIt == m_componentPools.end())
+            {
+                poolIt = m_componentPools.emplace(typeId, std::unique_ptr<ComponentPool>(new ComponentPool())).first;
+                
+                //resolve the new type against all existing queries.
+                for (auto& query : m_componentPoolQueries)
+                {
+                    if (in_component->IsA(query.first) == true)
+                    {
+                        query.second.push_back(poolIt->second.get());
+                    }
+                }
+            }
+            
+            ComponentPool* pool = poolIt->second.get();
+            in_component->m_scenePoolIndex = static_cast<u32>(pool->m_components.size());
+            in_component->m_sceneInsertionOrder = ++g_nextComponentInsertionOrder;
+            pool->m_components.push_back(in_component);
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::RemoveFromComponentPool(Component* in_component)
+        {
+            auto poolIt = m_componentPools.find(in_component->GetInterfaceID());
+            CS_ASSERT(poolIt != m_componentPools.end(), "Component is not in the scene.");
+            
+            ComponentPool* pool = poolIt->second.get();
+            const u32 index = in_component->m_scenePoolIndex;
+            CS_ASSERT(index < pool->m_components.size() && pool->m_components[index] == in_component, "Component pool is corrupt.");
+            
+            //the entry is cleared rather than swapped with the last so the pool stays in insertion order.
+            pool->m_components[index] = nullptr;
+            ++pool->m_numRemoved;
+            
+            if (pool->m_numRemoved == pool->m_components.size())
+            {
+                for (auto& query : m_componentPoolQueries)
+                {
+                    auto it = std::find(query.second.begin(), query.second.end(), pool);
+                    if (it != query.second.end())
+                    {
+                        query.second.erase(it);
+                    }
+                }
+                
+                m_componentPools.erase(poolIt);
+            }
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        const Scene::ComponentPoolList& Scene::GetComponentPools(InterfaceIDType in_interfaceId)
+        {
+            auto queryIt = m_componentPoolQueries.find(in_interfaceId);
+            if (queryIt == m_componentPoolQueries.end())
+            {
+                //compacted pools are never empty so the first component can be used to resolve the type.
+                ComponentPoolList pools;
+                for (const auto& pool : m_componentPools)
+                {
+                    CompactComponentPool(pool.second.get());
+                    
+                    if (pool.second->m_components.front()->IsA(in_interfaceId) == true)
+                    {
+                        pools.push_back(pool.second.get());
+                    }
+                }
+                
+                queryIt = m_componentPoolQueries.emplace(in_interfaceId, std::move(pools)).first;
+            }
+            else
+            {
+                for (ComponentPool* pool : queryIt->second)
+                {
+                    CompactComponentPool(pool);
+                }
+            }
+            
+            return queryIt->second;
+        }
+        //--------------------------------------------------------------------------------------------------
+        //--------------------------------------------------------------------------------------------------
+        void Scene::CompactComponentPool(ComponentPool* in_pool)
+        {
+            if (in_pool->m_numRemoved > 0)
+            {
+                u32 numRemaining = 0;
+                for (Component* component : in_pool->m_components)
+                {
+                    if (component != nullptr)
+                    {
+                        component->m_scenePoolIndex = numRemaining;
+                        in_pool->m_components[numRemaining++] = component;
+                    }
+                }
+                
+                in_pool->m_components.resize(numRemaining);
+                in_pool->m_numRemoved = 0;
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Scene::AddToNameIndex(Entity* in_entity)
+        {
+            if (m_nameIndexEnabled == true && in_entity->GetInternedName().IsEmpty() == false)
+            {
+                m_nameIndex.emplace(NameIndexKey(in_entity->GetParent(), in_entity->GetInternedName()), in_entity);
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
+        void Scene::RemoveFromNameIndex(Entity* in_entity)
+        {
+            if (m_nameIndexEnabled == true && in_entity->GetInternedName().IsEmpty() == false)
+            {
+                auto range = m_nameIndex.equal_range(NameIndexKey(in_entity->GetParent(), in_entity->GetInternedName()));
+                for (auto it = range.first; it != range.second; ++it)
+                {
+                    if (it->second == in_entity)
+                    {
+                        m_nameIndex.erase(it);
+                        return;
+                    }
+                }
+            }
         }
 		//--------------------------------------------------------------------------------------------------
 		//--------------------------------------------------------------------------------------------------
 		Scene::~Scene()
 		{
 			RemoveAllEntities();
+            ClearRecycledEntities();
+            m_transformHierarchy.reset();
 		}
 	}
 }
@@ -36,6 +36,9 @@
 #include <ChilliSource/Core/System/StateSystem.h>
 #include <ChilliSource/Core/Volume/VolumeComponent.h>
 
+#include <algorithm>
+#include <unordered_map>
+
 namespace ChilliSource
 {
 	namespace Core
@@ -44,6 +47,16 @@ namespace ChilliSource
         /// Holds the entities that form the scene. Entities will be updated from the scene and the
         /// scene is queried by other systems for render components etc.
         ///
+        /// Components in the scene are stored in pools by concrete type. The pools which satisfy
+        /// a given component query are resolved the first time the query is made and are kept up
+        /// to date as new types are added, so querying the scene for components is a contiguous
+        /// iteration over the matching pools rather than a search of every entity.
+        ///
+        /// The scene also keeps a list of the components which require each update phase, so
+        /// components that don't need updating are never visited. Components requiring the
+        /// parallel update phase are updated across the task scheduler before the serial update
+        /// phase.
+        ///
         /// @author S Downie
 		//--------------------------------------------------------------------------------------------------
 		class Scene final : public StateSystem
@@ -87,6 +100,19 @@ namespace ChilliSource
 			/// @param Entity
 			//-------------------------------------------------------
 			void Add(const EntitySPtr& in_entity);
+            //-------------------------------------------------------
+            /// Adds a batch of entities to the scene. This is
+            /// equivalent to adding each in turn, but storage for
+            /// the entities and their descendants is reserved up
+            /// front, so it is preferable when adding many
+            /// entities at once, such as those instantiated from a
+            /// prefab.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The entities. None can exist on another scene.
+            //-------------------------------------------------------
+            void Add(const std::vector<EntitySPtr>& in_entities);
             //-------------------------------------------------------
 			/// Remove all the entities from the scene
             ///
@@ -99,6 +125,36 @@ namespace ChilliSource
 			/// @return the list of all the entities in the scene.
 			//-------------------------------------------------------
 			const SharedEntityList& GetEntities() const;
+            //-------------------------------------------------------
+            /// Creates an empty entity, reusing a previously recycled
+            /// entity if one is available. Otherwise the entity is
+            /// allocated from the entity pool. The entity is not
+            /// added to the scene.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The new entity.
+            //-------------------------------------------------------
+            EntitySPtr CreateEntity();
+            //-------------------------------------------------------
+            /// Removes the entity from its parent or the scene,
+            /// resets it and keeps it for reuse by CreateEntity().
+            /// Its children are recycled in the same way. An entity
+            /// is only kept if the reference passed in is the last
+            /// one; otherwise it is simply released, so callers
+            /// should move their reference in.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The entity to recycle.
+            //-------------------------------------------------------
+            void RecycleEntity(EntitySPtr in_entity);
+            //-------------------------------------------------------
+            /// Releases all entities which are waiting to be reused.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------
+            void ClearRecycledEntities();
             //------------------------------------------------------
 			/// @author S Downie
 			///
@@ -151,6 +207,71 @@ namespace ChilliSource
             /// @author Ian Copland
 			//-------------------------------------------------------
 			void SuspendEntities();
+            //-------------------------------------------------------
+            /// Sets whether or not the parallel update phase is run
+            /// across the task scheduler. If disabled the phase is
+            /// still run, but serially on the calling thread, which
+            /// can be useful when debugging. This is enabled by
+            /// default.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Whether or not parallel updates are enabled.
+            //-------------------------------------------------------
+            void SetParallelUpdateEnabled(bool in_enabled);
+            //-------------------------------------------------------
+            /// Sets whether or not the scene keeps a hashed index of
+            /// entity names, keyed on each entity's parent and name.
+            /// While enabled, looking up a child by name with
+            /// Entity::GetEntityWithName() is a hash lookup rather
+            /// than a search of the children, and
+            /// Entity::GetEntityWithNameRecursive() uses it at each
+            /// level of the hierarchy. This is disabled by default.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Whether or not the name index is enabled.
+            //-------------------------------------------------------
+            void SetNameIndexEnabled(bool in_enabled);
+            //-------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return Whether or not the name index is enabled.
+            //-------------------------------------------------------
+            bool IsNameIndexEnabled() const;
+            //-------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return Whether or not parallel updates are enabled.
+            //-------------------------------------------------------
+            bool IsParallelUpdateEnabled() const;
+            //-------------------------------------------------------
+            /// Sets whether or not the transforms of entities in the
+            /// scene are stored contiguously in a transform hierarchy
+            /// owned by the scene. This allows world transforms to be
+            /// calculated in a single cache-friendly pass, which can
+            /// be split across threads. This is disabled by default.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Whether or not contiguous transforms are enabled.
+            //-------------------------------------------------------
+            void SetContiguousTransformsEnabled(bool in_enabled);
+            //-------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return Whether or not contiguous transforms are enabled.
+            //-------------------------------------------------------
+            bool IsContiguousTransformsEnabled() const;
+            //-------------------------------------------------------
+            /// Brings the world transforms of all entities in the
+            /// scene up to date. This does nothing if contiguous
+            /// transforms are not enabled, as world transforms are
+            /// otherwise calculated lazily.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------
+            void UpdateWorldTransforms();
 			//--------------------------------------------------------------------------------------------------
 			/// Traverses the contents of the scene and adds any objects that intersect with the ray to the
 			/// list. The list order is undefined. Use the query intersection value on the volume component
@@ -163,7 +284,8 @@ namespace ChilliSource
 			//--------------------------------------------------------------------------------------------------
 			void QuerySceneForIntersection(const Ray &in_ray, std::vector<VolumeComponent*>& out_volumeComponents);
             //--------------------------------------------------------------------------------------------------
-			/// Traverse the scene for the given component type and fill the list with those components
+			/// Traverse the scene for the given component type and fill the list with those components. The
+            /// components are added in the order they were added to the scene.
             ///
             /// @author S Downie
             ///
@@ -172,10 +294,33 @@ namespace ChilliSource
 			template <typename TComponentType>
             void QuerySceneForComponents(std::vector<TComponentType*>& out_components)
 			{
-				for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
-				{
-					(*it)->GetComponents<TComponentType>(out_components);
-				}
+                const ComponentPoolList& pools = GetComponentPools(TComponentType::InterfaceID);
+                
+                std::size_t numComponents = out_components.size();
+                for (const ComponentPool* pool : pools)
+                {
+                    numComponents += pool->m_components.size();
+                }
+                out_components.reserve(numComponents);
+                
+                const std::size_t firstIndex = out_components.size();
+                for (const ComponentPool* pool : pools)
+                {
+                    const std::size_t poolIndex = out_components.size();
+                    for (Component* component : pool->m_components)
+                    {
+                        out_components.push_back(static_cast<TComponentType*>(component));
+                    }
+                    
+                    //each pool is already in insertion order so they only need to be merged.
+                    if (poolIndex != firstIndex)
+                    {
+                        std::inplace_merge(out_components.begin() + firstIndex, out_components.begin() + poolIndex, out_components.end(), [](const TComponentType* in_a, const TComponentType* in_b)
+                        {
+                            return in_a->GetSceneInsertionOrder() < in_b->GetSceneInsertionOrder();
+                        });
+                    }
+                }
 			}
             //--------------------------------------------------------------------------------------------------
 			/// Traverse the scene for the given component types and fill the lists with those components
@@ -188,10 +333,8 @@ namespace ChilliSource
 			template <typename TComponentType1, typename TComponentType2>
             void QuerySceneForComponents(std::vector<TComponentType1*>& out_components1, std::vector<TComponentType2*>& out_components2)
 			{
-				for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
-				{
-					(*it)->GetComponents<TComponentType1, TComponentType2>(out_components1, out_components2);
-				}
+                QuerySceneForComponents(out_components1);
+                QuerySceneForComponents(out_components2);
 			}
             //--------------------------------------------------------------------------------------------------
 			/// Traverse the scene for the given component types and fill the lists with those components
@@ -205,15 +348,45 @@ namespace ChilliSource
 			template <typename TComponentType1, typename TComponentType2, typename TComponentType3>
             void QuerySceneForComponents(std::vector<TComponentType1*>& out_components1, std::vector<TComponentType2*>& out_components2, std::vector<TComponentType3*>& out_components3)
 			{
-				for(SharedEntityList::const_iterator it = m_entities.begin(); it != m_entities.end(); ++it)
-				{
-					(*it)->GetComponents<TComponentType1, TComponentType2, TComponentType3>(out_components1, out_components2, out_components3);
-				}
+                QuerySceneForComponents(out_components1);
+                QuerySceneForComponents(out_components2);
+                QuerySceneForComponents(out_components3);
 			}
             
         private:
             friend class Entity;
             
+            //-------------------------------------------------------
+            /// The components of a single concrete type, in the
+            /// order they were added to the scene. Removed
+            /// components leave a null entry until the pool is next
+            /// compacted so the order is preserved.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------
+            struct ComponentPool
+            {
+                std::vector<Component*> m_components;
+                u32 m_numRemoved = 0;
+            };
+            typedef std::vector<ComponentPool*> ComponentPoolList;
+            
+            typedef std::pair<const Entity*, InternedString> NameIndexKey;
+            //-------------------------------------------------------
+            /// Hashes name index keys, which are the parent entity,
+            /// or null for entities at the root of the scene, and
+            /// the name.
+            ///
+            /// @author Carlos Artesano
+            //-------------------------------------------------------
+            struct NameIndexKeyHash
+            {
+                std::size_t operator()(const NameIndexKey& in_key) const
+                {
+                    return std::hash<const Entity*>()(in_key.first) ^ (in_key.second.GetHash() * 31);
+                }
+            };
+            
             //-------------------------------------------------------
             /// Private to enforce use of factory method
             ///
@@ -228,11 +401,129 @@ namespace ChilliSource
             /// @param Entity
             //-------------------------------------------------------
             void Remove(Entity* inpEntity);
+            //-------------------------------------------------------
+            /// Adds the component to the pool for its concrete type,
+            /// creating the pool if required.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The component.
+            //-------------------------------------------------------
+            void AddToComponentPool(Component* in_component);
+            //-------------------------------------------------------
+            /// Called when a component is added to the scene. This
+            /// adds it to the component pools and update lists.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The component.
+            //-------------------------------------------------------
+            void OnComponentAdded(Component* in_component);
+            //-------------------------------------------------------
+            /// Called when a component is removed from the scene.
+            /// This removes it from the component pools and update
+            /// lists.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The component.
+            //-------------------------------------------------------
+            void OnComponentRemoved(Component* in_component);
+            //-------------------------------------------------------
+            /// Updates every component in the given update list.
+            /// Components added during the update are updated in
+            /// the same pass; components removed are skipped and
+            /// the list is compacted afterwards.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The update phase.
+            /// @param The time since the last update in seconds.
+            //-------------------------------------------------------
+            void UpdateComponents(Component::UpdatePhase in_phase, f32 in_timeSinceLastUpdate);
+            //-------------------------------------------------------
+            /// Runs the parallel update phase. Components are
+            /// grouped by entity and split into chunks which are
+            /// executed on the task scheduler.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The time since the last update in seconds.
+            //-------------------------------------------------------
+            void UpdateComponentsInParallel(f32 in_timeSinceLastUpdate);
+            //-------------------------------------------------------
+            /// Removes any cleared entries from the given update
+            /// list, preserving the order of the remaining entries.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The update phase.
+            //-------------------------------------------------------
+            void CompactUpdateList(Component::UpdatePhase in_phase);
+            //-------------------------------------------------------
+            /// Removes the component from the pool for its concrete
+            /// type. The pool is destroyed if it is now empty,
+            /// otherwise the entry is cleared and the pool is
+            /// compacted the next time it is queried.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The component.
+            //-------------------------------------------------------
+            void RemoveFromComponentPool(Component* in_component);
+            //-------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The interface ID of the component type.
+            ///
+            /// @return The pools containing components which
+            /// implement the given interface. This is calculated
+            /// the first time a type is queried.
+            //-------------------------------------------------------
+            const ComponentPoolList& GetComponentPools(InterfaceIDType in_interfaceId);
+            //-------------------------------------------------------
+            /// Removes any cleared entries from the given component
+            /// pool, preserving the order of the remaining entries.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The component pool.
+            //-------------------------------------------------------
+            void CompactComponentPool(ComponentPool* in_pool);
+            //-------------------------------------------------------
+            /// Adds the entity to the name index if it is enabled
+            /// and the entity is named.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The entity.
+            //-------------------------------------------------------
+            void AddToNameIndex(Entity* in_entity);
+            //-------------------------------------------------------
+            /// Removes the entity from the name index if it is
+            /// enabled and the entity is named.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The entity.
+            //-------------------------------------------------------
+            void RemoveFromNameIndex(Entity* in_entity);
             
 		private:
 			
 			SharedEntityList m_entities;
+            std::vector<EntitySPtr> m_recycledEntities;
             Colour m_clearColour;
+            TransformHierarchyUPtr m_transformHierarchy;
+            std::unordered_map<InterfaceIDType, std::unique_ptr<ComponentPool>> m_componentPools;
+            std::unordered_map<InterfaceIDType, ComponentPoolList> m_componentPoolQueries;
+            std::unordered_multimap<NameIndexKey, Entity*, NameIndexKeyHash> m_nameIndex;
+            std::vector<Component*> m_updateLists[static_cast<u32>(Component::UpdatePhase::k_total)];
+            bool m_updateListsContainRemoved[static_cast<u32>(Component::UpdatePhase::k_total)];
+            bool m_parallelUpdateListNeedsGrouping = false;
+            bool m_parallelUpdateEnabled = true;
+            bool m_nameIndexEnabled = false;
+            bool m_isUpdatingInParallel = false;
             bool m_entitiesActive = false;
             bool m_entitiesForegrounded = false;
 		};		
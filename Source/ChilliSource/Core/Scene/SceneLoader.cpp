@@ -0,0 +1,198 @@
+//
+//  SceneLoader.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Scene/SceneLoader.h>
+
+#include <ChilliSource/Core/Container/PoolAllocator.h>
+#include <ChilliSource/Core/Entity/Component.h>
+#include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/File/CSBinaryChunk.h>
+#include <ChilliSource/Core/Scene/Scene.h>
+
+#include <chrono>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        SceneLoader::SceneLoader(CSBinaryChunkUPtr in_entityChunk, u32 in_numEntities, std::vector<SceneSerialiser::DeserialiseDelegate> in_deserialiseDelegates, Scene* in_scene)
+            : m_entityChunk(std::move(in_entityChunk)), m_deserialiseDelegates(std::move(in_deserialiseDelegates)), m_scene(in_scene), m_numEntities(in_numEntities)
+        {
+            CS_ASSERT(m_entityChunk != nullptr, "The entity chunk cannot be null.");
+            
+            PoolAllocator<Entity>::Reserve(m_numEntities);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool SceneLoader::Load(f32 in_timeBudget)
+        {
+            typedef std::chrono::steady_clock Clock;
+            
+            const auto endTime = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<f32>(in_timeBudget));
+            
+            while (IsFinished() == false)
+            {
+                LoadNextEntity();
+                
+                if (Clock::now() >= endTime)
+                {
+                    break;
+                }
+            }
+            
+            return IsFinished();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void SceneLoader::LoadAll()
+        {
+            while (IsFinished() == false)
+            {
+                LoadNextEntity();
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool SceneLoader::IsFinished() const
+        {
+            return (m_numLoadedEntities >= m_numEntities);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 SceneLoader::GetNumEntities() const
+        {
+            return m_numEntities;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        u32 SceneLoader::GetNumLoadedEntities() const
+        {
+            return m_numLoadedEntities;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        const std::vector<EntitySPtr>& SceneLoader::GetRootEntities() const
+        {
+            return m_rootEntities;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void SceneLoader::LoadNextEntity()
+        {
+            const std::string name = m_entityChunk->ReadString();
+            const u32 numChildren = m_entityChunk->Read<u32>();
+            
+            Vector3 position;
+            position.x = m_entityChunk->Read<f32>();
+            position.y = m_entityChunk->Read<f32>();
+            position.z = m_entityChunk->Read<f32>();
+            
+            Vector3 scale;
+            scale.x = m_entityChunk->Read<f32>();
+            scale.y = m_entityChunk->Read<f32>();
+            scale.z = m_entityChunk->Read<f32>();
+            
+            Quaternion orientation;
+            orientation.x = m_entityChunk->Read<f32>();
+            orientation.y = m_entityChunk->Read<f32>();
+            orientation.z = m_entityChunk->Read<f32>();
+            orientation.w = m_entityChunk->Read<f32>();
+            
+            const u32 numComponents = m_entityChunk->Read<u32>();
+            
+            EntitySPtr entity = Entity::CreatePooled();
+            entity->Reserve(numComponents, numChildren);
+            entity->SetName(InternedString(name));
+            
+            if (position != Vector3::k_zero || scale != Vector3::k_one || orientation != Quaternion::k_identity)
+            {
+                entity->GetTransform().SetPositionScaleOrientation(position, scale, orientation);
+            }
+            
+            for (u32 i = 0; i < numComponents; ++i)
+            {
+                const u32 typeIndex = m_entityChunk->Read<u32>();
+                const u32 numProperties = m_entityChunk->Read<u32>();
+                
+                m_properties.clear();
+                for (u32 j = 0; j < numProperties; ++j)
+                {
+                    std::string key = m_entityChunk->ReadString();
+                    m_properties[std::move(key)] = m_entityChunk->ReadString();
+                }
+                
+                if (typeIndex >= m_deserialiseDelegates.size())
+                {
+                    CS_LOG_ERROR("Scene file contains an invalid component type index. The component will not be loaded.");
+                    continue;
+                }
+                
+                const auto& deserialiseDelegate = m_deserialiseDelegates[typeIndex];
+                if (deserialiseDelegate != nullptr)
+                {
+                    ComponentSPtr component = deserialiseDelegate(m_properties);
+                    if (component != nullptr)
+                    {
+                        entity->AddComponent(component);
+                    }
+                }
+            }
+            
+            ++m_numLoadedEntities;
+            
+            if (m_pendingEntities.empty() == false)
+            {
+                m_pendingEntities.back().m_entity->AddEntity(entity);
+                --m_pendingEntities.back().m_numRemainingChildren;
+            }
+            
+            PendingEntity pendingEntity;
+            pendingEntity.m_entity = std::move(entity);
+            pendingEntity.m_numRemainingChildren = numChildren;
+            m_pendingEntities.push_back(std::move(pendingEntity));
+            
+            //pop any entities which now have all of their children. If this completes a root entity, it is added to the scene.
+            while (m_pendingEntities.empty() == false && m_pendingEntities.back().m_numRemainingChildren == 0)
+            {
+                EntitySPtr completed = std::move(m_pendingEntities.back().m_entity);
+                m_pendingEntities.pop_back();
+                
+                if (m_pendingEntities.empty() == true)
+                {
+                    m_rootEntities.push_back(completed);
+                    if (m_scene != nullptr)
+                    {
+                        m_scene->Add(completed);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,150 @@
+//
+//  SceneLoader.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_SCENE_SCENELOADER_H_
+#define _CHILLISOURCE_CORE_SCENE_SCENELOADER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Scene/SceneSerialiser.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// Instantiates the entities stored in a binary scene file over a number of
+        /// calls to Load(), each of which is limited to a time budget. This allows
+        /// large scenes to be streamed in across multiple frames without stalling.
+        ///
+        /// The file is read into memory when the loader is created; entities and
+        /// their components are then created in the order they were saved. Each root
+        /// entity is only added to the target scene once it, and all of its
+        /// descendants, have been created, so partially loaded hierarchies are never
+        /// visible in the scene.
+        ///
+        /// Loaders are created using SceneSerialiser::CreateLoader(). They should
+        /// only be used on the main thread.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class SceneLoader final
+        {
+        public:
+            CS_DECLARE_NOCOPY(SceneLoader);
+            //------------------------------------------------------------------------------
+            /// Creates entities until either all entities have been loaded or the given
+            /// time budget has been used up. At least one entity is always created per
+            /// call, ensuring progress is made regardless of the budget.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The time budget in seconds.
+            ///
+            /// @return Whether or not loading has finished.
+            //------------------------------------------------------------------------------
+            bool Load(f32 in_timeBudget);
+            //------------------------------------------------------------------------------
+            /// Creates all remaining entities in one go.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void LoadAll();
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return Whether or not all entities have been loaded.
+            //------------------------------------------------------------------------------
+            bool IsFinished() const;
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The total number of entities in the scene file.
+            //------------------------------------------------------------------------------
+            u32 GetNumEntities() const;
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The number of entities which have been created so far.
+            //------------------------------------------------------------------------------
+            u32 GetNumLoadedEntities() const;
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The root entities which have been completely loaded so far.
+            //------------------------------------------------------------------------------
+            const std::vector<EntitySPtr>& GetRootEntities() const;
+            
+        private:
+            friend class SceneSerialiser;
+            //------------------------------------------------------------------------------
+            /// An entity which is still waiting on some of its children to be loaded.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            struct PendingEntity
+            {
+                EntitySPtr m_entity;
+                u32 m_numRemainingChildren;
+            };
+            //------------------------------------------------------------------------------
+            /// Constructor. Private to ensure the loader is only created through a scene
+            /// serialiser.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The chunk containing the entity records, which must already have
+            /// been validated.
+            /// @param The total number of entities in the chunk.
+            /// @param The deserialise delegate for each component type index in the
+            /// file. Delegates for unregistered types will be null.
+            /// @param The scene which loaded root entities are added to. Can be null.
+            //------------------------------------------------------------------------------
+            SceneLoader(CSBinaryChunkUPtr in_entityChunk, u32 in_numEntities, std::vector<SceneSerialiser::DeserialiseDelegate> in_deserialiseDelegates, Scene* in_scene);
+            //------------------------------------------------------------------------------
+            /// Reads the next entity record from the entity chunk, creates the entity and
+            /// attaches it to its parent.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void LoadNextEntity();
+            
+            CSBinaryChunkUPtr m_entityChunk;
+            std::vector<SceneSerialiser::DeserialiseDelegate> m_deserialiseDelegates;
+            Scene* m_scene = nullptr;
+            u32 m_numEntities = 0;
+            u32 m_numLoadedEntities = 0;
+            std::vector<PendingEntity> m_pendingEntities;
+            std::vector<EntitySPtr> m_rootEntities;
+            ParamDictionary m_properties;
+        };
+    }
+}
+
+#endif
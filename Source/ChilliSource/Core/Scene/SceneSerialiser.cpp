@@ -0,0 +1,442 @@
+//
+//  SceneSerialiser.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Scene/SceneSerialiser.h>
+
+#include <ChilliSource/Core/Entity/Component.h>
+#include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/File/CSBinaryInputStream.h>
+#include <ChilliSource/Core/File/CSBinaryChunk.h>
+#include <ChilliSource/Core/File/CSBinaryOutputStream.h>
+#include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/Scene/Scene.h>
+#include <ChilliSource/Core/Scene/SceneLoader.h>
+
+#include <cstring>
+#include <unordered_set>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const u32 k_sceneFileFormatId = 10;
+            const u32 k_sceneFileFormatVersion = 1;
+            const std::string k_typeChunkId = "TYPE";
+            const std::string k_entityChunkId = "ENTS";
+            
+            //the name length, child count, position, scale, orientation and component count.
+            const u32 k_minEntityRecordSize = 13 * sizeof(u32);
+            
+            //------------------------------------------------------------------------------
+            /// Reads a u32 from the given data if it lies within the data size, advancing
+            /// the offset past it.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The data.
+            /// @param The data size.
+            /// @param [In/Out] The offset to read from.
+            /// @param [Out] The value.
+            ///
+            /// @return Whether or not the value could be read.
+            //------------------------------------------------------------------------------
+            bool TryReadU32(const u8* in_data, u32 in_dataSize, u32& io_offset, u32& out_value)
+            {
+                if (in_dataSize - io_offset < sizeof(u32))
+                {
+                    return false;
+                }
+                
+                std::memcpy(&out_value, in_data + io_offset, sizeof(u32));
+                io_offset += sizeof(u32);
+                return true;
+            }
+            //------------------------------------------------------------------------------
+            /// Skips over a string in the given data if it lies within the data size.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The data.
+            /// @param The data size.
+            /// @param [In/Out] The offset of the string.
+            ///
+            /// @return Whether or not the string could be skipped.
+            //------------------------------------------------------------------------------
+            bool TrySkipString(const u8* in_data, u32 in_dataSize, u32& io_offset)
+            {
+                u32 length = 0;
+                if (TryReadU32(in_data, in_dataSize, io_offset, length) == false || in_dataSize - io_offset < length)
+                {
+                    return false;
+                }
+                
+                io_offset += length;
+                return true;
+            }
+            //------------------------------------------------------------------------------
+            /// Checks that the entity records in the given entity chunk, starting at its
+            /// read position, are well formed: every record lies within the chunk, every
+            /// component type index is within the type table, and the child counts
+            /// describe complete hierarchies containing exactly the given number of
+            /// entities. This allows the scene loader to read the records without
+            /// further checks.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The entity chunk.
+            /// @param The number of entities.
+            /// @param The number of component types.
+            ///
+            /// @return Whether or not the records are valid.
+            //------------------------------------------------------------------------------
+            bool ValidateEntityRecords(const CSBinaryChunk* in_entityChunk, u32 in_numEntities, u32 in_numTypes)
+            {
+                const u8* data = in_entityChunk->GetData();
+                const u32 dataSize = in_entityChunk->GetSize();
+                u32 offset = in_entityChunk->GetReadPosition();
+                
+                if (in_numEntities > (dataSize - offset) / k_minEntityRecordSize)
+                {
+                    return false;
+                }
+                
+                std::vector<u32> numRemainingChildren;
+                for (u32 i = 0; i < in_numEntities; ++i)
+                {
+                    u32 numChildren = 0;
+                    u32 numComponents = 0;
+                    if (TrySkipString(data, dataSize, offset) == false || TryReadU32(data, dataSize, offset, numChildren) == false || dataSize - offset < 10 * sizeof(f32))
+                    {
+                        return false;
+                    }
+                    
+                    offset += 10 * sizeof(f32);
+                    if (TryReadU32(data, dataSize, offset, numComponents) == false)
+                    {
+                        return false;
+                    }
+                    
+                    for (u32 j = 0; j < numComponents; ++j)
+                    {
+                        u32 typeIndex = 0;
+                        u32 numProperties = 0;
+                        if (TryReadU32(data, dataSize, offset, typeIndex) == false || typeIndex >= in_numTypes || TryReadU32(data, dataSize, offset, numProperties) == false)
+                        {
+                            return false;
+                        }
+                        
+                        for (u32 k = 0; k < numProperties; ++k)
+                        {
+                            if (TrySkipString(data, dataSize, offset) == false || TrySkipString(data, dataSize, offset) == false)
+                            {
+                                return false;
+                            }
+                        }
+                    }
+                    
+                    //an entity can't have more children than there are entities left to load.
+                    if (numChildren > in_numEntities - i - 1)
+                    {
+                        return false;
+                    }
+                    
+                    if (numRemainingChildren.empty() == false)
+                    {
+                        --numRemainingChildren.back();
+                    }
+                    
+                    numRemainingChildren.push_back(numChildren);
+                    while (numRemainingChildren.empty() == false && numRemainingChildren.back() == 0)
+                    {
+                        numRemainingChildren.pop_back();
+                    }
+                }
+                
+                return numRemainingChildren.empty();
+            }
+            
+            //------------------------------------------------------------------------------
+            /// Counts the given entity hierarchies and builds a table of the type names of
+            /// all registered components they contain, in the order they are first
+            /// encountered. Unregistered component types are logged once each.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The root entities.
+            /// @param The function used to query whether a type is registered.
+            /// @param [Out] The number of entities.
+            /// @param [Out] The type name table.
+            /// @param [Out] The index of each type name in the table.
+            //------------------------------------------------------------------------------
+            template <typename TIsRegisteredFunc> void BuildTypeTable(const std::vector<EntitySPtr>& in_rootEntities, const TIsRegisteredFunc& in_isRegistered, u32& out_numEntities,
+                                                                      std::vector<std::string>& out_typeNames, std::unordered_map<std::string, u32>& out_typeIndices)
+            {
+                std::unordered_set<std::string> unregisteredTypes;
+                
+                std::vector<const Entity*> toVisit;
+                for (const auto& entity : in_rootEntities)
+                {
+                    toVisit.push_back(entity.get());
+                }
+                
+                out_numEntities = 0;
+                while (toVisit.empty() == false)
+                {
+                    const Entity* entity = toVisit.back();
+                    toVisit.pop_back();
+                    ++out_numEntities;
+                    
+                    for (const auto& component : entity->GetComponents())
+                    {
+                        const std::string& typeName = component->GetInterfaceTypeName();
+                        if (out_typeIndices.find(typeName) != out_typeIndices.end())
+                        {
+                            continue;
+                        }
+                        
+                        if (in_isRegistered(typeName) == true)
+                        {
+                            out_typeIndices.emplace(typeName, static_cast<u32>(out_typeNames.size()));
+                            out_typeNames.push_back(typeName);
+                        }
+                        else if (unregisteredTypes.insert(typeName).second == true)
+                        {
+                            CS_LOG_WARNING("Component type '" + typeName + "' has not been registered with the scene serialiser. It will not be saved.");
+                        }
+                    }
+                    
+                    for (const auto& child : entity->GetEntities())
+                    {
+                        toVisit.push_back(child.get());
+                    }
+                }
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        SceneSerialiserUPtr SceneSerialiser::Create()
+        {
+            return SceneSerialiserUPtr(new SceneSerialiser());
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void SceneSerialiser::RegisterComponentType(const std::string& in_typeName, const SerialiseDelegate& in_serialiseDelegate, const DeserialiseDelegate& in_deserialiseDelegate)
+        {
+            CS_ASSERT(in_serialiseDelegate != nullptr, "Cannot register a component type with a null serialise delegate.");
+            CS_ASSERT(in_deserialiseDelegate != nullptr, "Cannot register a component type with a null deserialise delegate.");
+            
+            ComponentType componentType;
+            componentType.m_serialiseDelegate = in_serialiseDelegate;
+            componentType.m_deserialiseDelegate = in_deserialiseDelegate;
+            m_componentTypes[in_typeName] = componentType;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool SceneSerialiser::Save(const Scene* in_scene, StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            CS_ASSERT(in_scene != nullptr, "Cannot save a null scene.");
+            
+            std::vector<EntitySPtr> rootEntities;
+            for (const auto& entity : in_scene->GetEntities())
+            {
+                if (entity->GetParent() == nullptr)
+                {
+                    rootEntities.push_back(entity);
+                }
+            }
+            
+            return Save(rootEntities, in_storageLocation, in_filePath);
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool SceneSerialiser::Save(const std::vector<EntitySPtr>& in_rootEntities, StorageLocation in_storageLocation, const std::string& in_filePath) const
+        {
+            u32 numEntities = 0;
+            std::vector<std::string> typeNames;
+            std::unordered_map<std::string, u32> typeIndices;
+            BuildTypeTable(in_rootEntities, [this](const std::string& in_typeName)
+            {
+                return (m_componentTypes.find(in_typeName) != m_componentTypes.end());
+            }, numEntities, typeNames, typeIndices);
+            
+            CSBinaryOutputStream stream(in_storageLocation, in_filePath, k_sceneFileFormatId, k_sceneFileFormatVersion);
+            if (stream.IsValid() == false)
+            {
+                CS_LOG_ERROR("Could not open scene file for writing: " + in_filePath);
+                return false;
+            }
+            
+            stream.BeginChunk(k_typeChunkId);
+            stream.Write(static_cast<u32>(typeNames.size()));
+            for (const auto& typeName : typeNames)
+            {
+                stream.WriteString(typeName);
+            }
+            stream.EndChunk();
+            
+            //entities are written depth first, with each record followed by the records of its children.
+            stream.BeginChunk(k_entityChunkId);
+            stream.Write(numEntities);
+            
+            std::vector<const Entity*> toWrite;
+            for (auto it = in_rootEntities.rbegin(); it != in_rootEntities.rend(); ++it)
+            {
+                toWrite.push_back(it->get());
+            }
+            
+            std::vector<const Component*> components;
+            ParamDictionary properties;
+            while (toWrite.empty() == false)
+            {
+                const Entity* entity = toWrite.back();
+                toWrite.pop_back();
+                
+                stream.WriteString(entity->GetName());
+                stream.Write(entity->GetNumEntities());
+                
+                const Transform& transform = entity->GetTransform();
+                const Vector3& position = transform.GetLocalPosition();
+                const Vector3& scale = transform.GetLocalScale();
+                const Quaternion& orientation = transform.GetLocalOrientation();
+                stream.Write(position.x);
+                stream.Write(position.y);
+                stream.Write(position.z);
+                stream.Write(scale.x);
+                stream.Write(scale.y);
+                stream.Write(scale.z);
+                stream.Write(orientation.x);
+                stream.Write(orientation.y);
+                stream.Write(orientation.z);
+                stream.Write(orientation.w);
+                
+                components.clear();
+                for (const auto& component : entity->GetComponents())
+                {
+                    if (typeIndices.find(component->GetInterfaceTypeName()) != typeIndices.end())
+                    {
+                        components.push_back(component.get());
+                    }
+                }
+                
+                stream.Write(static_cast<u32>(components.size()));
+                for (const auto component : components)
+                {
+                    const std::string& typeName = component->GetInterfaceTypeName();
+                    
+                    properties.clear();
+                    m_componentTypes.find(typeName)->second.m_serialiseDelegate(component, properties);
+                    
+                    stream.Write(typeIndices.find(typeName)->second);
+                    stream.Write(static_cast<u32>(properties.size()));
+                    for (const auto& property : properties)
+                    {
+                        stream.WriteString(property.first);
+                        stream.WriteString(property.second);
+                    }
+                }
+                
+                const auto& children = entity->GetEntities();
+                for (auto it = children.rbegin(); it != children.rend(); ++it)
+                {
+                    toWrite.push_back(it->get());
+                }
+            }
+            stream.EndChunk();
+            
+            if (stream.Close() == false)
+            {
+                CS_LOG_ERROR("Failed to write scene file: " + in_filePath);
+                return false;
+            }
+            
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        SceneLoaderUPtr SceneSerialiser::CreateLoader(StorageLocation in_storageLocation, const std::string& in_filePath, Scene* in_scene) const
+        {
+            CSBinaryInputStream stream(in_storageLocation, in_filePath);
+            if (stream.IsValid() == false)
+            {
+                CS_LOG_ERROR("Could not open scene file: " + in_filePath);
+                return nullptr;
+            }
+            
+            if (stream.GetFileFormatId() != k_sceneFileFormatId || stream.GetFileFormatVersion() != k_sceneFileFormatVersion)
+            {
+                CS_LOG_ERROR("Unsupported scene file format or version: " + in_filePath);
+                return nullptr;
+            }
+            
+            CSBinaryChunkUPtr typeChunk = stream.ReadChunk(k_typeChunkId);
+            CSBinaryChunkUPtr entityChunk = stream.ReadChunk(k_entityChunkId);
+            if (typeChunk == nullptr || entityChunk == nullptr)
+            {
+                CS_LOG_ERROR("Scene file is missing required chunks: " + in_filePath);
+                return nullptr;
+            }
+            
+            const u32 numTypes = typeChunk->Read<u32>();
+            std::vector<DeserialiseDelegate> deserialiseDelegates;
+            deserialiseDelegates.reserve(numTypes);
+            for (u32 i = 0; i < numTypes; ++i)
+            {
+                const std::string typeName = typeChunk->ReadString();
+                
+                auto it = m_componentTypes.find(typeName);
+                if (it != m_componentTypes.end())
+                {
+                    deserialiseDelegates.push_back(it->second.m_deserialiseDelegate);
+                }
+                else
+                {
+                    CS_LOG_WARNING("Component type '" + typeName + "' in scene file '" + in_filePath + "' has not been registered with the scene serialiser. It will not be loaded.");
+                    deserialiseDelegates.push_back(nullptr);
+                }
+            }
+            
+            if (entityChunk->GetSize() < sizeof(u32))
+            {
+                CS_LOG_ERROR("Scene file contains an invalid entity chunk: " + in_filePath);
+                return nullptr;
+            }
+            
+            const u32 numEntities = entityChunk->Read<u32>();
+            if (ValidateEntityRecords(entityChunk.get(), numEntities, numTypes) == false)
+            {
+                CS_LOG_ERROR("Scene file contains invalid entity records: " + in_filePath);
+                return nullptr;
+            }
+            
+            return SceneLoaderUPtr(new SceneLoader(std::move(entityChunk), numEntities, std::move(deserialiseDelegates), in_scene));
+        }
+    }
+}
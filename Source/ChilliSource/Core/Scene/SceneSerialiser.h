@@ -0,0 +1,186 @@
+//
+//  SceneSerialiser.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_SCENE_SCENESERIALISER_H_
+#define _CHILLISOURCE_CORE_SCENE_SCENESERIALISER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/ParamDictionary.h>
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// Saves entity hierarchies to a binary scene file, and creates loaders which
+        /// stream them back in. Scene files use the Chilli Source "Chunked" binary
+        /// format and store the name and local transform of each entity, along with
+        /// the properties of each of its components.
+        ///
+        /// Components are only saved if their type has been registered with the
+        /// serialiser. Each registered type provides a delegate which writes the
+        /// component's properties to a dictionary and a delegate which creates a new
+        /// component from that dictionary. Components of unregistered types are
+        /// skipped with a warning.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class SceneSerialiser final
+        {
+        public:
+            CS_DECLARE_NOCOPY(SceneSerialiser);
+            //------------------------------------------------------------------------------
+            /// A delegate which writes the properties of a component to a dictionary.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The component.
+            /// @param [Out] The dictionary of properties.
+            //------------------------------------------------------------------------------
+            typedef std::function<void(const Component*, ParamDictionary&)> SerialiseDelegate;
+            //------------------------------------------------------------------------------
+            /// A delegate which creates a new component from a dictionary of properties.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The dictionary of properties.
+            ///
+            /// @return The new component, or null if it could not be created.
+            //------------------------------------------------------------------------------
+            typedef std::function<ComponentSPtr(const ParamDictionary&)> DeserialiseDelegate;
+            //------------------------------------------------------------------------------
+            /// Factory method for creating a new serialiser with no registered component
+            /// types.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The new serialiser.
+            //------------------------------------------------------------------------------
+            static SceneSerialiserUPtr Create();
+            //------------------------------------------------------------------------------
+            /// Registers a component type with the serialiser. The template parameter
+            /// must be a named type, i.e declare itself using CS_DECLARE_NAMEDTYPE().
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The serialise delegate.
+            /// @param The deserialise delegate.
+            //------------------------------------------------------------------------------
+            template <typename TComponentType> void RegisterComponentType(const SerialiseDelegate& in_serialiseDelegate, const DeserialiseDelegate& in_deserialiseDelegate);
+            //------------------------------------------------------------------------------
+            /// Registers a component type with the serialiser.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The type name of the component. This must match the value returned
+            /// by the component's GetInterfaceTypeName().
+            /// @param The serialise delegate.
+            /// @param The deserialise delegate.
+            //------------------------------------------------------------------------------
+            void RegisterComponentType(const std::string& in_typeName, const SerialiseDelegate& in_serialiseDelegate, const DeserialiseDelegate& in_deserialiseDelegate);
+            //------------------------------------------------------------------------------
+            /// Saves all entities in the given scene to a binary scene file.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The scene.
+            /// @param The storage location to save to.
+            /// @param The file path to save to.
+            ///
+            /// @return Whether or not the file was successfully saved.
+            //------------------------------------------------------------------------------
+            bool Save(const Scene* in_scene, StorageLocation in_storageLocation, const std::string& in_filePath) const;
+            //------------------------------------------------------------------------------
+            /// Saves the given entities and all of their descendants to a binary scene
+            /// file.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The root entities to save.
+            /// @param The storage location to save to.
+            /// @param The file path to save to.
+            ///
+            /// @return Whether or not the file was successfully saved.
+            //------------------------------------------------------------------------------
+            bool Save(const std::vector<EntitySPtr>& in_rootEntities, StorageLocation in_storageLocation, const std::string& in_filePath) const;
+            //------------------------------------------------------------------------------
+            /// Opens a binary scene file and creates a loader which can be used to
+            /// instantiate its entities over a number of frames. Components of types which
+            /// haven't been registered with this serialiser are skipped.
+            ///
+            /// The loader takes a copy of the registered types, so the serialiser does not
+            /// need to outlive it. The entity records are validated up front, so a
+            /// truncated or corrupt file fails here rather than part way through loading.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The storage location of the scene file.
+            /// @param The file path of the scene file.
+            /// @param The scene to which each root entity will be added once it, and all
+            /// of its descendants, have been loaded. Can be null, in which case entities
+            /// will need to be added manually.
+            ///
+            /// @return The new loader, or null if the file could not be opened or is
+            /// invalid.
+            //------------------------------------------------------------------------------
+            SceneLoaderUPtr CreateLoader(StorageLocation in_storageLocation, const std::string& in_filePath, Scene* in_scene = nullptr) const;
+            
+        private:
+            //------------------------------------------------------------------------------
+            /// A container for the delegates of a single registered component type.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            struct ComponentType
+            {
+                SerialiseDelegate m_serialiseDelegate;
+                DeserialiseDelegate m_deserialiseDelegate;
+            };
+            //------------------------------------------------------------------------------
+            /// Private constructor to enforce use of the factory method.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            SceneSerialiser() = default;
+            
+            std::unordered_map<std::string, ComponentType> m_componentTypes;
+        };
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        template <typename TComponentType> void SceneSerialiser::RegisterComponentType(const SerialiseDelegate& in_serialiseDelegate, const DeserialiseDelegate& in_deserialiseDelegate)
+        {
+            RegisterComponentType(TComponentType::TypeName, in_serialiseDelegate, in_deserialiseDelegate);
+        }
+    }
+}
+
+#endif
@@ -99,6 +99,8 @@ namespace ChilliSource
             m_scene->UpdateEntities(in_timeSinceLastUpdate);
             
             OnUpdate(in_timeSinceLastUpdate);
+            
+            m_scene->UpdateWorldTransforms();
         }
         //-----------------------------------------
         //-----------------------------------------
@@ -0,0 +1,223 @@
+//
+//  InternedString.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/String/InternedString.h>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        namespace
+        {
+            const std::string k_emptyString;
+        }
+        
+        //------------------------------------------------------------
+        /// An entry in the string table. The string itself is the
+        /// table key. The table is held as static members here as
+        /// the entry type is private to InternedString.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------
+        struct InternedString::Entry final
+        {
+            Entry() : m_refCount(0) {}
+            
+            const std::string* m_string = nullptr;
+            std::atomic<u32> m_refCount;
+            
+            static std::mutex s_tableMutex;
+            static std::unordered_map<std::string, Entry> s_table;
+        };
+        
+        std::mutex InternedString::Entry::s_tableMutex;
+        std::unordered_map<std::string, InternedString::Entry> InternedString::Entry::s_table;
+        
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        InternedString::InternedString(const std::string& in_string)
+        {
+            //the empty string is represented by null so default constructed strings compare equal.
+            if (in_string.empty() == false)
+            {
+                std::unique_lock<std::mutex> lock(Entry::s_tableMutex);
+                auto it = Entry::s_table.emplace(std::piecewise_construct, std::forward_as_tuple(in_string), std::forward_as_tuple()).first;
+                it->second.m_string = &it->first;
+                
+                //while the lock is held the entry can't be removed, so the reference is safe to add.
+                m_entry = &it->second;
+                ++m_entry->m_refCount;
+            }
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        InternedString::InternedString(const InternedString& in_toCopy)
+            : m_entry(in_toCopy.m_entry)
+        {
+            AddReference();
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        InternedString::InternedString(InternedString&& in_toMove)
+            : m_entry(in_toMove.m_entry)
+        {
+            in_toMove.m_entry = nullptr;
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        InternedString& InternedString::operator=(const InternedString& in_toCopy)
+        {
+            if (m_entry != in_toCopy.m_entry)
+            {
+                Release();
+                m_entry = in_toCopy.m_entry;
+                AddReference();
+            }
+            
+            return *this;
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        InternedString& InternedString::operator=(InternedString&& in_toMove)
+        {
+            if (this != &in_toMove)
+            {
+                Release();
+                m_entry = in_toMove.m_entry;
+                in_toMove.m_entry = nullptr;
+            }
+            
+            return *this;
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        bool InternedString::TryGetExisting(const std::string& in_string, InternedString& out_internedString)
+        {
+            if (in_string.empty() == true)
+            {
+                out_internedString = InternedString();
+                return true;
+            }
+            
+            Entry* entry = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(Entry::s_tableMutex);
+                auto it = Entry::s_table.find(in_string);
+                if (it == Entry::s_table.end())
+                {
+                    return false;
+                }
+                
+                entry = &it->second;
+                ++entry->m_refCount;
+            }
+            
+            out_internedString.Release();
+            out_internedString.m_entry = entry;
+            return true;
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        const std::string& InternedString::GetString() const
+        {
+            return (m_entry != nullptr) ? *m_entry->m_string : k_emptyString;
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        bool InternedString::IsEmpty() const
+        {
+            return (m_entry == nullptr);
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        std::size_t InternedString::GetHash() const
+        {
+            return std::hash<const Entry*>()(m_entry);
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        bool InternedString::operator==(const InternedString& in_other) const
+        {
+            return (m_entry == in_other.m_entry);
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        bool InternedString::operator!=(const InternedString& in_other) const
+        {
+            return (m_entry != in_other.m_entry);
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        void InternedString::AddReference()
+        {
+            if (m_entry != nullptr)
+            {
+                ++m_entry->m_refCount;
+            }
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        void InternedString::Release()
+        {
+            if (m_entry == nullptr)
+            {
+                return;
+            }
+            
+            Entry* entry = m_entry;
+            m_entry = nullptr;
+            
+            //only the final reference needs the lock. References can only be added without the lock by
+            //something which already holds one, so if this isn't the last it can be released directly.
+            u32 refCount = entry->m_refCount.load();
+            while (refCount > 1)
+            {
+                if (entry->m_refCount.compare_exchange_weak(refCount, refCount - 1) == true)
+                {
+                    return;
+                }
+            }
+            
+            std::unique_lock<std::mutex> lock(Entry::s_tableMutex);
+            if (--entry->m_refCount == 0)
+            {
+                Entry::s_table.erase(*entry->m_string);
+            }
+        }
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        InternedString::~InternedString()
+        {
+            Release();
+        }
+    }
+}
@@ -0,0 +1,209 @@
+//
+//  InternedString.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_STRING_INTERNEDSTRING_H_
+#define _CHILLISOURCE_CORE_STRING_INTERNEDSTRING_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <functional>
+#include <string>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------
+        /// A handle to a string stored in a global table of unique
+        /// strings. Interning a string costs a hash lookup, but after
+        /// that two interned strings can be compared and hashed using
+        /// only their pointers. This makes them suitable for names
+        /// which are frequently compared, such as entity names.
+        ///
+        /// Entries in the table are reference counted and removed once
+        /// the last interned string referring to them is destroyed, so
+        /// strings generated at runtime don't accumulate. Interning is
+        /// thread-safe. Interned strings should not have static storage
+        /// duration, as the table may be destroyed before them.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------
+        class InternedString final
+        {
+        public:
+            //------------------------------------------------------------
+            /// Constructs an empty interned string.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------
+            InternedString() = default;
+            //------------------------------------------------------------
+            /// Constructs an interned string from the given string,
+            /// adding it to the string table if it isn't already.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The string to intern.
+            //------------------------------------------------------------
+            explicit InternedString(const std::string& in_string);
+            //------------------------------------------------------------
+            /// Copy constructor. This adds a reference to the string.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The interned string to copy.
+            //------------------------------------------------------------
+            InternedString(const InternedString& in_toCopy);
+            //------------------------------------------------------------
+            /// Move constructor. The moved from string is left empty.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The interned string to move.
+            //------------------------------------------------------------
+            InternedString(InternedString&& in_toMove);
+            //------------------------------------------------------------
+            /// Copy assignment. This adds a reference to the new string
+            /// and releases the reference to the previous one.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The interned string to copy.
+            ///
+            /// @return A reference to this.
+            //------------------------------------------------------------
+            InternedString& operator=(const InternedString& in_toCopy);
+            //------------------------------------------------------------
+            /// Move assignment. The moved from string is left empty.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The interned string to move.
+            ///
+            /// @return A reference to this.
+            //------------------------------------------------------------
+            InternedString& operator=(InternedString&& in_toMove);
+            //------------------------------------------------------------
+            /// Gets the interned version of the given string without
+            /// adding it to the string table. This is useful for lookups
+            /// which shouldn't grow the table: if the string hasn't been
+            /// interned then nothing can be named with it.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The string to look up.
+            /// @param [Out] The interned string, if it exists.
+            ///
+            /// @return Whether or not the string has been interned. The
+            /// empty string is always considered interned.
+            //------------------------------------------------------------
+            static bool TryGetExisting(const std::string& in_string, InternedString& out_internedString);
+            //------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return The string.
+            //------------------------------------------------------------
+            const std::string& GetString() const;
+            //------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return Whether or not this is the empty string.
+            //------------------------------------------------------------
+            bool IsEmpty() const;
+            //------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @return A hash of the string. This is only consistent while
+            /// the string remains interned.
+            //------------------------------------------------------------
+            std::size_t GetHash() const;
+            //------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The other interned string.
+            ///
+            /// @return Whether or not the strings are the same.
+            //------------------------------------------------------------
+            bool operator==(const InternedString& in_other) const;
+            //------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param The other interned string.
+            ///
+            /// @return Whether or not the strings are different.
+            //------------------------------------------------------------
+            bool operator!=(const InternedString& in_other) const;
+            //------------------------------------------------------------
+            /// Destructor. This releases the reference to the string,
+            /// removing it from the table if this was the last.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------
+            ~InternedString();
+            
+        private:
+            struct Entry;
+            
+            //------------------------------------------------------------
+            /// Adds a reference to the current entry, if there is one.
+            /// The caller must already hold a reference to it.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------
+            void AddReference();
+            //------------------------------------------------------------
+            /// Releases the reference to the current entry, if there is
+            /// one, and leaves the string empty.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------
+            void Release();
+            
+            Entry* m_entry = nullptr;
+        };
+    }
+}
+
+namespace std
+{
+    //------------------------------------------------------------
+    /// Allows interned strings to be used as keys in unordered
+    /// containers.
+    ///
+    /// @author Carlos Artesano
+    //------------------------------------------------------------
+    template <> struct hash<ChilliSource::Core::InternedString>
+    {
+        std::size_t operator()(const ChilliSource::Core::InternedString& in_string) const
+        {
+            return in_string.GetHash();
+        }
+    };
+}
+
+#endif
@@ -30,6 +30,7 @@
 #define _CHILLISOURCE_CORE_THREADING_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Threading/ReadWriteMutex.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Core/Threading/ThreadPool.h>
 
@@ -0,0 +1,165 @@
+//
+//  ReadWriteMutex.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Core/Threading/ReadWriteMutex.h>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ReadWriteMutex::LockRead()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (m_isWriting == true || m_numWaitingWriters > 0)
+            {
+                m_readersCondition.wait(lock);
+            }
+            
+            ++m_numReaders;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ReadWriteMutex::UnlockRead()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            CS_ASSERT(m_numReaders > 0, "Cannot unlock a read lock which isn't held.");
+            
+            --m_numReaders;
+            if (m_numReaders == 0 && m_numWaitingWriters > 0)
+            {
+                lock.unlock();
+                m_writersCondition.notify_one();
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ReadWriteMutex::LockWrite()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            ++m_numWaitingWriters;
+            while (m_isWriting == true || m_numReaders > 0)
+            {
+                m_writersCondition.wait(lock);
+            }
+            --m_numWaitingWriters;
+            
+            m_isWriting = true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ReadWriteMutex::UnlockWrite()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            CS_ASSERT(m_isWriting == true, "Cannot unlock a write lock which isn't held.");
+            
+            m_isWriting = false;
+            const bool hasWaitingWriters = (m_numWaitingWriters > 0);
+            lock.unlock();
+            
+            if (hasWaitingWriters == true)
+            {
+                m_writersCondition.notify_one();
+            }
+            else
+            {
+                m_readersCondition.notify_all();
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ReadLock::ReadLock(ReadWriteMutex& in_mutex)
+            : m_mutex(in_mutex)
+        {
+            Lock();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ReadLock::Lock()
+        {
+            CS_ASSERT(m_isLocked == false, "Read lock is already locked.");
+            
+            m_mutex.LockRead();
+            m_isLocked = true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ReadLock::Unlock()
+        {
+            CS_ASSERT(m_isLocked == true, "Read lock is not locked.");
+            
+            m_mutex.UnlockRead();
+            m_isLocked = false;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ReadLock::~ReadLock()
+        {
+            if (m_isLocked == true)
+            {
+                m_mutex.UnlockRead();
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        WriteLock::WriteLock(ReadWriteMutex& in_mutex)
+            : m_mutex(in_mutex)
+        {
+            Lock();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void WriteLock::Lock()
+        {
+            CS_ASSERT(m_isLocked == false, "Write lock is already locked.");
+            
+            m_mutex.LockWrite();
+            m_isLocked = true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void WriteLock::Unlock()
+        {
+            CS_ASSERT(m_isLocked == true, "Write lock is not locked.");
+            
+            m_mutex.UnlockWrite();
+            m_isLocked = false;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        WriteLock::~WriteLock()
+        {
+            if (m_isLocked == true)
+            {
+                m_mutex.UnlockWrite();
+            }
+        }
+    }
+}
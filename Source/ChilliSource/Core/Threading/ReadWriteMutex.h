@@ -0,0 +1,184 @@
+//
+//  ReadWriteMutex.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_THREADING_READWRITEMUTEX_H_
+#define _CHILLISOURCE_CORE_THREADING_READWRITEMUTEX_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <condition_variable>
+#include <mutex>
+
+namespace ChilliSource
+{
+    namespace Core
+    {
+        //------------------------------------------------------------------------------
+        /// A mutex which can either be locked for reading by any number of threads at
+        /// once, or for writing by a single thread. Writers take priority: once a
+        /// writer is waiting no new readers will acquire the lock, ensuring writers
+        /// are not starved by a constant stream of readers.
+        ///
+        /// The mutex is not recursive; a thread which already holds the lock in either
+        /// mode must not attempt to lock it again.
+        ///
+        /// This is usually used through the ReadLock and WriteLock scoped locks.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class ReadWriteMutex final
+        {
+        public:
+            CS_DECLARE_NOCOPY(ReadWriteMutex);
+            //------------------------------------------------------------------------------
+            /// Constructor.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            ReadWriteMutex() = default;
+            //------------------------------------------------------------------------------
+            /// Locks the mutex for reading, blocking until no writer holds or is waiting
+            /// for the lock.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void LockRead();
+            //------------------------------------------------------------------------------
+            /// Releases a read lock on the mutex.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void UnlockRead();
+            //------------------------------------------------------------------------------
+            /// Locks the mutex for writing, blocking until there are no readers or other
+            /// writers.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void LockWrite();
+            //------------------------------------------------------------------------------
+            /// Releases the write lock on the mutex.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void UnlockWrite();
+            
+        private:
+            std::mutex m_mutex;
+            std::condition_variable m_readersCondition;
+            std::condition_variable m_writersCondition;
+            u32 m_numReaders = 0;
+            u32 m_numWaitingWriters = 0;
+            bool m_isWriting = false;
+        };
+        //------------------------------------------------------------------------------
+        /// A scoped read lock on a ReadWriteMutex. The mutex is locked for reading on
+        /// construction and unlocked on destruction, if still locked.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class ReadLock final
+        {
+        public:
+            CS_DECLARE_NOCOPY(ReadLock);
+            //------------------------------------------------------------------------------
+            /// Constructor. Locks the given mutex for reading.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The mutex.
+            //------------------------------------------------------------------------------
+            explicit ReadLock(ReadWriteMutex& in_mutex);
+            //------------------------------------------------------------------------------
+            /// Re-locks the mutex after a call to Unlock().
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void Lock();
+            //------------------------------------------------------------------------------
+            /// Unlocks the mutex before the lock goes out of scope.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void Unlock();
+            //------------------------------------------------------------------------------
+            /// Destructor. Unlocks the mutex if it is still locked.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            ~ReadLock();
+            
+        private:
+            ReadWriteMutex& m_mutex;
+            bool m_isLocked = false;
+        };
+        //------------------------------------------------------------------------------
+        /// A scoped write lock on a ReadWriteMutex. The mutex is locked for writing on
+        /// construction and unlocked on destruction, if still locked.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class WriteLock final
+        {
+        public:
+            CS_DECLARE_NOCOPY(WriteLock);
+            //------------------------------------------------------------------------------
+            /// Constructor. Locks the given mutex for writing.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The mutex.
+            //------------------------------------------------------------------------------
+            explicit WriteLock(ReadWriteMutex& in_mutex);
+            //------------------------------------------------------------------------------
+            /// Re-locks the mutex after a call to Unlock().
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void Lock();
+            //------------------------------------------------------------------------------
+            /// Unlocks the mutex before the lock goes out of scope.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void Unlock();
+            //------------------------------------------------------------------------------
+            /// Destructor. Unlocks the mutex if it is still locked.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            ~WriteLock();
+            
+        private:
+            ReadWriteMutex& m_mutex;
+            bool m_isLocked = false;
+        };
+    }
+}
+
+#endif
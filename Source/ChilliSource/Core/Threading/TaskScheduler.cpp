@@ -31,6 +31,10 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/Device.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+
 namespace ChilliSource
 {
     namespace Core
@@ -60,7 +64,8 @@ namespace ChilliSource
 		void TaskScheduler::OnInit()
 		{
             Device* device = Core::Application::Get()->GetSystem<Device>();
-			m_threadPool = ThreadPoolUPtr(new Core::ThreadPool(device->GetNumberOfCPUCores() * 2));
+            m_numThreads = device->GetNumberOfCPUCores() * 2;
+			m_threadPool = ThreadPoolUPtr(new Core::ThreadPool(m_numThreads));
             
             m_mainThreadId = std::this_thread::get_id();
 		}
@@ -76,6 +81,67 @@ namespace ChilliSource
 		{
 			m_threadPool->Schedule(in_task);
 		}
+		//------------------------------------------------
+		//------------------------------------------------
+		void TaskScheduler::ExecuteTasks(const std::vector<GenericTaskType>& in_tasks)
+		{
+            if (in_tasks.size() <= 1)
+            {
+                for (const auto& task : in_tasks)
+                {
+                    task();
+                }
+                return;
+            }
+            
+            //Workers which start after all tasks have been claimed only touch the shared state,
+            //which is kept alive by the worker itself; the task list is only accessed while
+            //there are unclaimed tasks, during which time the caller is still waiting.
+            struct ExecutionState
+            {
+                std::atomic<u32> m_nextTask;
+                std::atomic<u32> m_numRemaining;
+                std::mutex m_mutex;
+                std::condition_variable m_condition;
+            };
+            
+            const u32 numTasks = static_cast<u32>(in_tasks.size());
+            auto state = std::make_shared<ExecutionState>();
+            state->m_nextTask = 0;
+            state->m_numRemaining = numTasks;
+            
+            const std::vector<GenericTaskType>* tasks = &in_tasks;
+            auto executeTasks = [state, tasks, numTasks]()
+            {
+                u32 taskIndex = state->m_nextTask++;
+                while (taskIndex < numTasks)
+                {
+                    (*tasks)[taskIndex]();
+                    
+                    if (--state->m_numRemaining == 0)
+                    {
+                        std::unique_lock<std::mutex> lock(state->m_mutex);
+                        state->m_condition.notify_all();
+                    }
+                    
+                    taskIndex = state->m_nextTask++;
+                }
+            };
+            
+            const u32 numWorkers = std::min(numTasks - 1, m_numThreads);
+            for (u32 i = 0; i < numWorkers; ++i)
+            {
+                m_threadPool->Schedule(executeTasks);
+            }
+            
+            executeTasks();
+            
+            std::unique_lock<std::mutex> lock(state->m_mutex);
+            state->m_condition.wait(lock, [&state]()
+            {
+                return state->m_numRemaining == 0;
+            });
+		}
 		//----------------------------------------------------
 		//----------------------------------------------------
 		void TaskScheduler::ScheduleMainThreadTask(const GenericTaskType& in_task)
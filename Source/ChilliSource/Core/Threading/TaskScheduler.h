@@ -70,6 +70,22 @@ namespace ChilliSource
             /// @param Task
             //------------------------------------------------
 			void ScheduleTask(const GenericTaskType& in_task);
+            //------------------------------------------------
+            /// Executes the given tasks across the thread pool
+            /// and blocks until they have all finished. The
+            /// calling thread also executes tasks while it
+            /// waits, so this is safe to call from any thread,
+            /// including from within another task.
+            ///
+            /// This is intended for splitting large, evenly
+            /// sized pieces of work into chunks; each task
+            /// should be reasonably substantial.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The tasks to execute.
+            //------------------------------------------------
+			void ExecuteTasks(const std::vector<GenericTaskType>& in_tasks);
             //----------------------------------------------------
             /// Schedule a task to be executed by the main
             /// thread
@@ -135,6 +151,7 @@ namespace ChilliSource
             std::vector<GenericTaskType> m_mainThreadTasks;
             
             std::thread::id m_mainThreadId;
+            u32 m_numThreads = 0;
         };
     }
 }
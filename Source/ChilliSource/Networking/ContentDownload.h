@@ -31,6 +31,7 @@
 #define _CHILLISOURCE_NETWORKING_CONTENTDOWNLOAD_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Networking/ContentDownload/ChecksumCache.h>
 #include <ChilliSource/Networking/ContentDownload/ContentManagementSystem.h>
 #include <ChilliSource/Networking/ContentDownload/IContentDownloader.h>
 #include <ChilliSource/Networking/ContentDownload/MoContentDownloader.h>
@@ -0,0 +1,304 @@
+//
+//  ChecksumCache.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Networking/ContentDownload/ChecksumCache.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+#include <ChilliSource/Core/File/MemoryReader.h>
+#include <ChilliSource/Core/String/ToString.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+
+namespace ChilliSource
+{
+    namespace Networking
+    {
+        namespace
+        {
+            const u32 k_indexMagicNumber = 0x4B435343; //'CSCK'
+            const u32 k_indexVersion = 1;
+            
+            //------------------------------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param in_location - The storage location of the file.
+            /// @param in_filePath - The file path.
+            ///
+            /// @return The key used to identify the given file in the cache.
+            //------------------------------------------------------------------------------
+            std::string GetKey(Core::StorageLocation in_location, const std::string& in_filePath)
+            {
+                return Core::ToString(static_cast<u32>(in_location)) + ":" + in_filePath;
+            }
+            //------------------------------------------------------------------------------
+            /// Appends the given value to the buffer in its in-memory representation.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_value - The value.
+            /// @param out_buffer - [Out] The buffer to append to.
+            //------------------------------------------------------------------------------
+            template <typename TType> void Write(TType in_value, std::string& out_buffer)
+            {
+                out_buffer.append(reinterpret_cast<const s8*>(&in_value), sizeof(TType));
+            }
+            //------------------------------------------------------------------------------
+            /// Appends the given string to the buffer, prefixed with its length.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_string - The string.
+            /// @param out_buffer - [Out] The buffer to append to.
+            //------------------------------------------------------------------------------
+            void WriteString(const std::string& in_string, std::string& out_buffer)
+            {
+                Write(static_cast<u32>(in_string.size()), out_buffer);
+                out_buffer.append(in_string);
+            }
+            //------------------------------------------------------------------------------
+            /// Reads a string prefixed with its length from the given reader.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_reader - The reader.
+            /// @param out_string - [Out] The string. This is only set if successful.
+            ///
+            /// @return Whether or not there was enough data to read the string.
+            //------------------------------------------------------------------------------
+            bool TryReadString(Core::MemoryReader& in_reader, std::string& out_string)
+            {
+                if (in_reader.GetRemainingSize() < sizeof(u32))
+                {
+                    return false;
+                }
+                
+                u32 length = in_reader.Read<u32>();
+                if (in_reader.GetRemainingSize() < length)
+                {
+                    return false;
+                }
+                
+                out_string = std::string(reinterpret_cast<const s8*>(in_reader.Read(length)), length);
+                return true;
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        ChecksumCache::ChecksumCache(Core::StorageLocation in_indexLocation, const std::string& in_indexFilePath, const ChecksumDelegate& in_checksumDelegate)
+            : m_indexLocation(in_indexLocation), m_indexFilePath(in_indexFilePath), m_checksumDelegate(in_checksumDelegate)
+        {
+            CS_ASSERT(m_checksumDelegate, "Checksum Cache requires a checksum delegate.");
+            
+            Load();
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        std::string ChecksumCache::GetChecksum(Core::StorageLocation in_location, const std::string& in_filePath)
+        {
+            Core::FileSystem::FileInfo fileInfo;
+            if (Core::Application::Get()->GetFileSystem()->TryGetFileInfo(in_location, in_filePath, fileInfo) == false)
+            {
+                return m_checksumDelegate(in_location, in_filePath);
+            }
+            
+            std::string key = GetKey(in_location, in_filePath);
+            std::string checksum;
+            if (TryGetCachedChecksum(key, fileInfo, checksum) == false)
+            {
+                checksum = m_checksumDelegate(in_location, in_filePath);
+                AddChecksum(key, fileInfo, checksum);
+            }
+            
+            return checksum;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ChecksumCache::CalculateChecksums(Core::StorageLocation in_location, const std::vector<std::string>& in_filePaths)
+        {
+            auto fileSystem = Core::Application::Get()->GetFileSystem();
+            
+            std::vector<Core::TaskScheduler::GenericTaskType> tasks;
+            for (const auto& filePath : in_filePaths)
+            {
+                Core::FileSystem::FileInfo fileInfo;
+                if (fileSystem->TryGetFileInfo(in_location, filePath, fileInfo) == false)
+                {
+                    continue;
+                }
+                
+                std::string key = GetKey(in_location, filePath);
+                std::string checksum;
+                if (TryGetCachedChecksum(key, fileInfo, checksum) == false)
+                {
+                    tasks.push_back([=]()
+                    {
+                        AddChecksum(key, fileInfo, m_checksumDelegate(in_location, filePath));
+                    });
+                }
+            }
+            
+            if (tasks.empty() == false)
+            {
+                Core::Application::Get()->GetTaskScheduler()->ExecuteTasks(tasks);
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ChecksumCache::SetChecksum(Core::StorageLocation in_location, const std::string& in_filePath, const std::string& in_checksum)
+        {
+            Core::FileSystem::FileInfo fileInfo;
+            if (Core::Application::Get()->GetFileSystem()->TryGetFileInfo(in_location, in_filePath, fileInfo) == true)
+            {
+                AddChecksum(GetKey(in_location, in_filePath), fileInfo, in_checksum);
+            }
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool ChecksumCache::Save()
+        {
+            std::string buffer;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (m_isDirty == false)
+                {
+                    return true;
+                }
+                
+                Write(k_indexMagicNumber, buffer);
+                Write(k_indexVersion, buffer);
+                Write(static_cast<u32>(m_entries.size()), buffer);
+                for (const auto& entry : m_entries)
+                {
+                    WriteString(entry.first, buffer);
+                    Write(entry.second.m_size, buffer);
+                    Write(entry.second.m_modificationTime, buffer);
+                    WriteString(entry.second.m_checksum, buffer);
+                }
+                
+                m_isDirty = false;
+            }
+            
+            if (Core::Application::Get()->GetFileSystem()->WriteFile(m_indexLocation, m_indexFilePath, buffer) == false)
+            {
+                CS_LOG_ERROR("Checksum Cache: Failed to save index '" + m_indexFilePath + "'.");
+                
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_isDirty = true;
+                return false;
+            }
+            
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ChecksumCache::Clear()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_entries.clear();
+            m_isDirty = true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ChecksumCache::Load()
+        {
+            auto fileSystem = Core::Application::Get()->GetFileSystem();
+            if (fileSystem->DoesFileExist(m_indexLocation, m_indexFilePath) == false)
+            {
+                return;
+            }
+            
+            Core::MemoryMappedFileCSPtr indexFile = fileSystem->CreateMemoryMappedFile(m_indexLocation, m_indexFilePath);
+            if (indexFile == nullptr)
+            {
+                return;
+            }
+            
+            Core::MemoryReader reader(indexFile->GetData(), indexFile->GetSize());
+            if (reader.GetRemainingSize() < 3 * sizeof(u32) || reader.Read<u32>() != k_indexMagicNumber || reader.Read<u32>() != k_indexVersion)
+            {
+                CS_LOG_WARNING("Checksum Cache: Discarding invalid index '" + m_indexFilePath + "'.");
+                return;
+            }
+            
+            std::unordered_map<std::string, Entry> entries;
+            u32 numEntries = reader.Read<u32>();
+            for (u32 i = 0; i < numEntries; ++i)
+            {
+                std::string key;
+                Entry entry;
+                if (TryReadString(reader, key) == false || reader.GetRemainingSize() < 2 * sizeof(u64))
+                {
+                    CS_LOG_WARNING("Checksum Cache: Discarding invalid index '" + m_indexFilePath + "'.");
+                    return;
+                }
+                
+                entry.m_size = reader.Read<u64>();
+                entry.m_modificationTime = reader.Read<u64>();
+                if (TryReadString(reader, entry.m_checksum) == false)
+                {
+                    CS_LOG_WARNING("Checksum Cache: Discarding invalid index '" + m_indexFilePath + "'.");
+                    return;
+                }
+                
+                entries.emplace(std::move(key), std::move(entry));
+            }
+            
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_entries = std::move(entries);
+            m_isDirty = false;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        bool ChecksumCache::TryGetCachedChecksum(const std::string& in_key, const Core::FileSystem::FileInfo& in_fileInfo, std::string& out_checksum) const
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            
+            auto it = m_entries.find(in_key);
+            if (it == m_entries.end() || it->second.m_size != in_fileInfo.m_size || it->second.m_modificationTime != in_fileInfo.m_modificationTime)
+            {
+                return false;
+            }
+            
+            out_checksum = it->second.m_checksum;
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        void ChecksumCache::AddChecksum(const std::string& in_key, const Core::FileSystem::FileInfo& in_fileInfo, const std::string& in_checksum)
+        {
+            Entry entry;
+            entry.m_size = in_fileInfo.m_size;
+            entry.m_modificationTime = in_fileInfo.m_modificationTime;
+            entry.m_checksum = in_checksum;
+            
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_entries[in_key] = std::move(entry);
+            m_isDirty = true;
+        }
+    }
+}
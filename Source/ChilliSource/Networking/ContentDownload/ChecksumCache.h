@@ -0,0 +1,190 @@
+//
+//  ChecksumCache.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_NETWORKING_CONTENTDOWNLOAD_CHECKSUMCACHE_H_
+#define _CHILLISOURCE_NETWORKING_CONTENTDOWNLOAD_CHECKSUMCACHE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace ChilliSource
+{
+    namespace Networking
+    {
+        //------------------------------------------------------------------------------
+        /// A persistent cache of file checksums. Each checksum is stored alongside the
+        /// size and modification time of the file it was calculated from, and is only
+        /// recalculated if either of these change. Files for which the file system
+        /// cannot provide this information are never cached.
+        ///
+        /// Checksums which are not in the cache can be calculated in parallel on the
+        /// task scheduler with CalculateChecksums().
+        ///
+        /// This is thread-safe, though the checksum delegate must also be thread-safe
+        /// if CalculateChecksums() is used.
+        ///
+        /// @author Carlos Artesano
+        //------------------------------------------------------------------------------
+        class ChecksumCache final
+        {
+        public:
+            CS_DECLARE_NOCOPY(ChecksumCache);
+            //------------------------------------------------------------------------------
+            /// A delegate used to calculate the checksum of a file.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_location - The storage location of the file.
+            /// @param in_filePath - The file path.
+            ///
+            /// @return The checksum.
+            //------------------------------------------------------------------------------
+            using ChecksumDelegate = std::function<std::string(Core::StorageLocation in_location, const std::string& in_filePath)>;
+            //------------------------------------------------------------------------------
+            /// Constructor. Loads the cache index from the given file if it exists.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_indexLocation - The storage location of the cache index.
+            /// @param in_indexFilePath - The file path of the cache index.
+            /// @param in_checksumDelegate - The delegate used to calculate checksums.
+            //------------------------------------------------------------------------------
+            ChecksumCache(Core::StorageLocation in_indexLocation, const std::string& in_indexFilePath, const ChecksumDelegate& in_checksumDelegate);
+            //------------------------------------------------------------------------------
+            /// Gets the checksum of the given file, calculating it if it isn't in the
+            /// cache or the file has changed since it was cached.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_location - The storage location of the file.
+            /// @param in_filePath - The file path.
+            ///
+            /// @return The checksum.
+            //------------------------------------------------------------------------------
+            std::string GetChecksum(Core::StorageLocation in_location, const std::string& in_filePath);
+            //------------------------------------------------------------------------------
+            /// Calculates the checksum of each of the given files which isn't already in
+            /// the cache. The checksums are calculated in parallel on the task scheduler
+            /// and this blocks until they are all complete, after which GetChecksum() will
+            /// return them without touching the file contents.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_location - The storage location of the files.
+            /// @param in_filePaths - The file paths.
+            //------------------------------------------------------------------------------
+            void CalculateChecksums(Core::StorageLocation in_location, const std::vector<std::string>& in_filePaths);
+            //------------------------------------------------------------------------------
+            /// Adds a checksum which is already known, for example because it was
+            /// calculated while the file was written, to the cache. This should only be
+            /// called after the file has been closed. Nothing is cached if the file
+            /// system cannot provide the current state of the file.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_location - The storage location of the file.
+            /// @param in_filePath - The file path.
+            /// @param in_checksum - The checksum of the current file contents.
+            //------------------------------------------------------------------------------
+            void SetChecksum(Core::StorageLocation in_location, const std::string& in_filePath, const std::string& in_checksum);
+            //------------------------------------------------------------------------------
+            /// Writes the cache index to disk if it has changed since it was last loaded
+            /// or saved.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return Whether or not the index was successfully saved.
+            //------------------------------------------------------------------------------
+            bool Save();
+            //------------------------------------------------------------------------------
+            /// Removes all checksums from the cache. This doesn't affect the index on disk
+            /// until Save() is called.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void Clear();
+            
+        private:
+            //------------------------------------------------------------------------------
+            /// A container for a single cached checksum and the state of the file it was
+            /// calculated from.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            struct Entry final
+            {
+                u64 m_size = 0;
+                u64 m_modificationTime = 0;
+                std::string m_checksum;
+            };
+            //------------------------------------------------------------------------------
+            /// Reads the cache index from disk. If the index doesn't exist or is invalid
+            /// the cache is left empty.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------------------------
+            void Load();
+            //------------------------------------------------------------------------------
+            /// Looks up the checksum of the given file in the cache.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_key - The cache key of the file.
+            /// @param in_fileInfo - The current state of the file.
+            /// @param out_checksum - [Out] The checksum. This is only set if it is found.
+            ///
+            /// @return Whether or not there was an up-to-date checksum in the cache.
+            //------------------------------------------------------------------------------
+            bool TryGetCachedChecksum(const std::string& in_key, const Core::FileSystem::FileInfo& in_fileInfo, std::string& out_checksum) const;
+            //------------------------------------------------------------------------------
+            /// Adds the given checksum to the cache, replacing any previous entry.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param in_key - The cache key of the file.
+            /// @param in_fileInfo - The state of the file the checksum was calculated from.
+            /// @param in_checksum - The checksum.
+            //------------------------------------------------------------------------------
+            void AddChecksum(const std::string& in_key, const Core::FileSystem::FileInfo& in_fileInfo, const std::string& in_checksum);
+            
+            Core::StorageLocation m_indexLocation;
+            std::string m_indexFilePath;
+            ChecksumDelegate m_checksumDelegate;
+            
+            mutable std::mutex m_mutex;
+            std::unordered_map<std::string, Entry> m_entries;
+            bool m_isDirty = false;
+        };
+    }
+}
+
+#endif
@@ -34,11 +34,14 @@
 #include <ChilliSource/Core/Cryptographic/HashMD5.h>
 #include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/File/FileStream.h>
+#include <ChilliSource/Core/File/TaggedFilePathResolver.h>
 #include <ChilliSource/Core/File/AppDataStore.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Networking/ContentDownload/ChecksumCache.h>
 
 #include <minizip/unzip.h>
+#include <SHA1/SHA1.h>
 
 namespace ChilliSource
 {
@@ -47,7 +50,100 @@ namespace ChilliSource
         namespace
         {
             const std::string k_adsKeyHasCached = "_CMSCachedDLC";
+            const std::string k_checksumCacheFilePath = "_CMSChecksumCache.bin";
+            const u32 k_extractChunkSize = 64 * 1024;
             
+            //--------------------------------------------------------
+            /// Converts a hex SHA1 hash into the default checksum
+            /// format: the lower case hex string, base 64 encoded
+            /// with the trailing '=' removed.
+            ///
+            /// @author S Downie
+            ///
+            /// @param The hex SHA1 hash.
+            ///
+            /// @return Checksum string
+            //--------------------------------------------------------
+            std::string EncodeSHA1Checksum(std::string in_hexChecksum)
+            {
+                CSCore::StringUtils::ToLowerCase(in_hexChecksum);
+                std::string base64Encoded = Core::BaseEncoding::Base64Encode(in_hexChecksum);
+                Core::StringUtils::ChopTrailingChars(base64Encoded, '=');
+                return base64Encoded;
+            }
+            //--------------------------------------------------------
+            /// Calculates the default checksum for a file: an SHA1
+            /// hash of the file, base 64 encoded with the trailing
+            /// '=' removed.
+            ///
+            /// @author S Downie
+            ///
+            /// @param File location
+            /// @param File path
+            ///
+            /// @return Checksum string
+            //--------------------------------------------------------
+            std::string CalculateSHA1Checksum(Core::StorageLocation in_location, const std::string& in_filePath)
+            {
+                return EncodeSHA1Checksum(Core::Application::Get()->GetFileSystem()->GetFileChecksumSHA1(in_location, in_filePath));
+            }
+            //--------------------------------------------------------
+            /// @author Carlos Artesano
+            ///
+            /// @param A finalised SHA1 hash.
+            ///
+            /// @return The hash in the default checksum format.
+            //--------------------------------------------------------
+            std::string EncodeSHA1Checksum(const CSHA1& in_hash)
+            {
+                const char k_hexDigits[] = "0123456789abcdef";
+                
+                u8 digest[20];
+                in_hash.GetHash(digest);
+                
+                std::string hexChecksum;
+                for (u8 byte : digest)
+                {
+                    hexChecksum += k_hexDigits[byte >> 4];
+                    hexChecksum += k_hexDigits[byte & 0xf];
+                }
+                
+                return EncodeSHA1Checksum(hexChecksum);
+            }
+            //--------------------------------------------------------
+            /// Reads the central directory of the given zip to find
+            /// the total uncompressed size of its contents.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The absolute path to the zip.
+            ///
+            /// @return The uncompressed size.
+            //--------------------------------------------------------
+            u64 GetUncompressedSize(const std::string& in_zipFilePath)
+            {
+                unzFile zippedFile = unzOpen(in_zipFilePath.c_str());
+                if(zippedFile == nullptr)
+                {
+                    return 0;
+                }
+                
+                u64 size = 0;
+                s32 status = unzGoToFirstFile(zippedFile);
+                while(status == UNZ_OK)
+                {
+                    unz_file_info fileInfo;
+                    if(unzGetCurrentFileInfo(zippedFile, &fileInfo, nullptr, 0, nullptr, 0, nullptr, 0) == UNZ_OK)
+                    {
+                        size += static_cast<u64>(fileInfo.uncompressed_size);
+                    }
+                    
+                    status = unzGoToNextFile(zippedFile);
+                }
+                
+                unzClose(zippedFile);
+                return size;
+            }
             //--------------------------------------------------------
             /// @author S Downie
             ///
@@ -103,6 +199,8 @@ namespace ChilliSource
         ContentManagementSystem::ContentManagementSystem(IContentDownloader* in_contentDownloader)
         :m_contentDownloader(in_contentDownloader)
         ,m_serverManifest(nullptr)
+        ,m_runningToInstallTotal(0)
+        ,m_runningInstalledTotal(0)
         {
         }
         //------------------------------------------------------------
@@ -110,6 +208,7 @@ namespace ChilliSource
         void ContentManagementSystem::OnInit()
         {
             m_contentDirectory = Core::Application::Get()->GetFileSystem()->GetAbsolutePathToStorageLocation(Core::StorageLocation::k_DLC);
+            m_checksumCache = ChecksumCacheUPtr(new ChecksumCache(Core::StorageLocation::k_cache, k_checksumCacheFilePath, CalculateSHA1Checksum));
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
@@ -140,7 +239,7 @@ namespace ChilliSource
         //-----------------------------------------------------------
         std::string ContentManagementSystem::GetManifestChecksumForFile(const std::string& in_filename) const
         {
-            return CalculateChecksum(Core::StorageLocation::k_DLC, in_filename);
+            return GetFileChecksum(Core::StorageLocation::k_DLC, in_filename);
         }
 		//-----------------------------------------------------------
 		//-----------------------------------------------------------
@@ -152,14 +251,21 @@ namespace ChilliSource
                 return m_checksumDelegate(in_location, in_filePath);
             }
             
-            std::string checksum = Core::Application::Get()->GetFileSystem()->GetFileChecksumSHA1(in_location, in_filePath);
-            CSCore::StringUtils::ToLowerCase(checksum);
-			std::string base64Encoded = Core::BaseEncoding::Base64Encode(checksum);
-			Core::StringUtils::ChopTrailingChars(base64Encoded, '=');
-			return base64Encoded;
+            return CalculateSHA1Checksum(in_location, in_filePath);
 		}
         //-----------------------------------------------------------
         //-----------------------------------------------------------
+        std::string ContentManagementSystem::GetFileChecksum(Core::StorageLocation in_location, const std::string& in_filePath) const
+        {
+            if(m_checksumDelegate)
+            {
+                return m_checksumDelegate(in_location, in_filePath);
+            }
+            
+            return m_checksumCache->GetChecksum(in_location, in_filePath);
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
         void ContentManagementSystem::ClearDownloadData()
         {
         	//Clear the old crap
@@ -171,6 +277,8 @@ namespace ChilliSource
         //-----------------------------------------------------------
         void ContentManagementSystem::CheckForUpdates(const ContentManagementSystem::CheckForUpdateDelegate& in_delegate)
         {
+            CS_ASSERT(m_isInstalling == false, "CMS: Cannot check for updates while an install is in progress.");
+            
             //Clear any stale data from last update check
             ClearDownloadData();
             
@@ -198,6 +306,8 @@ namespace ChilliSource
         //-----------------------------------------------------------
         void ContentManagementSystem::DownloadUpdates(const ContentManagementSystem::CompleteDelegate& in_delegate)
         {
+            CS_ASSERT(m_isInstalling == false, "CMS: Cannot download updates while an install is in progress.");
+            
         	m_onDownloadCompleteDelegate = in_delegate;
             m_currentPackageDownload = 0;
             
@@ -224,22 +334,100 @@ namespace ChilliSource
         //-----------------------------------------------------------
         void ContentManagementSystem::InstallUpdates(const CompleteDelegate& inDelegate)
         {
-            if(!m_packageDetails.empty() || !m_removePackageIds.empty())
+            CS_ASSERT(m_isInstalling == false, "CMS: Cannot install updates while an install is already in progress.");
+            
+            if(m_packageDetails.empty() && m_removePackageIds.empty())
             {
-				if(!m_packageDetails.empty())
-				{
-					//Unzip all the files and overwrite the old manifest
-					for (const auto& details : m_packageDetails)
-					{
-						ExtractFilesFromPackage(details);
-					}
-				}
+                //Tell the delegate all is bad
+                inDelegate(Result::k_failed);
+                ClearDownloadData();
+                return;
+            }
+            
+            m_isInstalling = true;
+            m_runningToInstallTotal = 0;
+            m_runningInstalledTotal = 0;
+            
+            //Gather the expected checksum of each file so they can be validated as they are extracted
+            std::unordered_map<std::string, std::string> fileChecksums;
+            if(!m_checksumDelegate)
+            {
+                Core::XML::Node* serverManifestRootNode = Core::XMLUtils::GetFirstChildElement(m_serverManifest->GetDocument());
+                Core::XML::Node* packageEl = Core::XMLUtils::GetFirstChildElement(serverManifestRootNode, "Package");
+                while(packageEl)
+                {
+                    std::string packageId = Core::XMLUtils::GetAttributeValue<std::string>(packageEl, "ID", "");
+                    
+                    Core::XML::Node* fileEl = Core::XMLUtils::GetFirstChildElement(packageEl, "File");
+                    while(fileEl)
+                    {
+                        std::string filePath = Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Location", "");
+                        if(filePath.empty())
+                        {
+                            filePath = packageId + "/" + Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Name", "");
+                        }
+                        
+                        fileChecksums.insert(std::make_pair(filePath, Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Checksum", "")));
+                        fileEl = Core::XMLUtils::GetNextSiblingElement(fileEl, "File");
+                    }
+                    
+                    packageEl = Core::XMLUtils::GetNextSiblingElement(packageEl, "Package");
+                }
+            }
+            
+            //Unzip all the packages concurrently in the background, then finish the install on the main thread
+            std::vector<PackageDetails> packageDetails = m_packageDetails;
+            auto taskScheduler = Core::Application::Get()->GetTaskScheduler();
+            taskScheduler->ScheduleTask([=]()
+            {
+                u64 totalSize = 0;
+                for (const auto& details : packageDetails)
+                {
+                    totalSize += GetUncompressedSize(m_contentDirectory + "/Temp/" + details.m_id + ".packzip");
+                }
+                m_runningToInstallTotal = totalSize;
                 
-                //Remove the temp zips
-                DeleteDirectory("Temp");
+                std::atomic<bool> success(true);
+                std::vector<Core::TaskScheduler::GenericTaskType> tasks;
+                for (const auto& details : packageDetails)
+                {
+                    tasks.push_back([this, &details, &fileChecksums, &success]()
+                    {
+                        if(ExtractFilesFromPackage(details, fileChecksums) == false)
+                        {
+                            success = false;
+                        }
+                    });
+                }
                 
-                m_packageDetails.clear();
-			
+                if(tasks.empty() == false)
+                {
+                    taskScheduler->ExecuteTasks(tasks);
+                }
+                
+                bool result = success;
+                taskScheduler->ScheduleMainThreadTask([=]()
+                {
+                    OnInstallComplete(result, inDelegate);
+                });
+            });
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        void ContentManagementSystem::OnInstallComplete(bool in_success, const CompleteDelegate& inDelegate)
+        {
+            m_isInstalling = false;
+            
+            //Remove the temp zips
+            DeleteDirectory("Temp");
+            
+            m_packageDetails.clear();
+            
+            //The checksums of the extracted files were calculated while they were written
+            m_checksumCache->Save();
+            
+            if(in_success)
+            {
 				if(!m_removePackageIds.empty())
 				{
 					//Remove any unused files from the documents
@@ -252,6 +440,9 @@ namespace ChilliSource
                 //Save the new content manifest
                 CSCore::XMLUtils::WriteDocument(m_serverManifest->GetDocument(), Core::StorageLocation::k_DLC, "ContentManifest.moman");
                 
+                //The contents of the DLC directory have changed so any previously resolved file paths may be stale.
+                Core::Application::Get()->GetTaggedFilePathResolver()->ClearCache();
+                
                 m_dlcCachePurged = false;
                 
                 //Store that we have DLC cached. If there is no DLC on next check then 
@@ -264,7 +455,11 @@ namespace ChilliSource
             }
             else
             {
+                //Some of the content may have been overwritten, so any previously resolved file paths may be stale.
+                Core::Application::Get()->GetTaggedFilePathResolver()->ClearCache();
+                
                 //Tell the delegate all is bad
+                CS_LOG_ERROR("CMS: Failed to install content packages.");
                 inDelegate(Result::k_failed);
             }
             
@@ -372,6 +567,8 @@ namespace ChilliSource
             //are in the bundle and pull down the others
 			if(currentManifest == nullptr || Core::XMLUtils::GetFirstChildElement(currentManifest->GetDocument()) == nullptr)
 			{
+                CalculateLocalChecksums(serverManifestRootNode, std::unordered_map<std::string, std::string>());
+                
                 //Grab all the URL's from the new manifest
                 
                 Core::XML::Node* serverPackageEl = Core::XMLUtils::GetFirstChildElement(serverManifestRootNode, "Package");
@@ -408,6 +605,8 @@ namespace ChilliSource
                         pLocalPackageEl = Core::XMLUtils::GetNextSiblingElement(pLocalPackageEl, "Package");
                     }
                 }
+                
+                CalculateLocalChecksums(serverManifestRootNode, mapPackageIDToChecksum);
 				
                 //Now process the server manifest and see whats different between the two
                 Core::XML::Node* pServerPackageEl = Core::XMLUtils::GetFirstChildElement(serverManifestRootNode, "Package");
@@ -487,6 +686,8 @@ namespace ChilliSource
                 }
             }
             
+            m_checksumCache->Save();
+            
             //Notify the delegate of our completion and whether the need to update anything
             bool bRequiresUpdating = (!m_removePackageIds.empty() || !m_packageDetails.empty());
             
@@ -540,6 +741,7 @@ namespace ChilliSource
                     //It exists in the bundle let's remove the old version from DLC cache
                     //Remove old content
                     Core::Application::Get()->GetFileSystem()->DeleteFile(Core::StorageLocation::k_DLC, filePath);
+                    Core::Application::Get()->GetTaggedFilePathResolver()->ClearCache();
                     
                     //On to the next file
                     pFileEl = Core::XMLUtils::GetNextSiblingElement(pFileEl, "File");
@@ -548,6 +750,56 @@ namespace ChilliSource
         }
         //-----------------------------------------------------------
         //-----------------------------------------------------------
+        void ContentManagementSystem::CalculateLocalChecksums(Core::XML::Node* in_serverManifestRootNode, const std::unordered_map<std::string, std::string>& in_localPackageChecksums)
+        {
+            if(m_checksumDelegate)
+            {
+                return;
+            }
+            
+            const std::string& packageDLCPath = Core::Application::Get()->GetFileSystem()->GetPackageDLCPath();
+            
+            std::vector<std::string> dlcFilePaths;
+            std::vector<std::string> packageFilePaths;
+            
+            Core::XML::Node* packageEl = Core::XMLUtils::GetFirstChildElement(in_serverManifestRootNode, "Package");
+            while(packageEl)
+            {
+                std::string packageId = Core::XMLUtils::GetAttributeValue<std::string>(packageEl, "ID", "");
+                std::string packageChecksum = Core::XMLUtils::GetAttributeValue<std::string>(packageEl, "Checksum", "");
+                
+                auto it = in_localPackageChecksums.find(packageId);
+                bool validateInDLC = (it != in_localPackageChecksums.end() && it->second == packageChecksum);
+                
+                Core::XML::Node* fileEl = Core::XMLUtils::GetFirstChildElement(packageEl, "File");
+                while(fileEl)
+                {
+                    std::string filePath = Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Location", "");
+                    if(filePath.empty())
+                    {
+                        filePath = packageId + "/" + Core::XMLUtils::GetAttributeValue<std::string>(fileEl, "Name", "");
+                    }
+                    
+                    if(validateInDLC)
+                    {
+                        dlcFilePaths.push_back(filePath);
+                    }
+                    else
+                    {
+                        packageFilePaths.push_back(packageDLCPath + filePath);
+                    }
+                    
+                    fileEl = Core::XMLUtils::GetNextSiblingElement(fileEl, "File");
+                }
+                
+                packageEl = Core::XMLUtils::GetNextSiblingElement(packageEl, "Package");
+            }
+            
+            m_checksumCache->CalculateChecksums(Core::StorageLocation::k_DLC, dlcFilePaths);
+            m_checksumCache->CalculateChecksums(Core::StorageLocation::k_package, packageFilePaths);
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
         bool ContentManagementSystem::SavePackageToFile(const PackageDetails& in_packageDetails, const std::string& in_zippedPackage, bool in_fullyDownloaded)
         {
             std::string strFile = "Temp/" + in_packageDetails.m_id + ".packzip";
@@ -579,7 +831,7 @@ namespace ChilliSource
 
         //-----------------------------------------------------------
         //-----------------------------------------------------------
-        void ContentManagementSystem::ExtractFilesFromPackage(const ContentManagementSystem::PackageDetails& in_packageDetails) const
+        bool ContentManagementSystem::ExtractFilesFromPackage(const ContentManagementSystem::PackageDetails& in_packageDetails, const std::unordered_map<std::string, std::string>& in_fileChecksums) const
         {
 			//Open zip
 			std::string strZipFilePath(m_contentDirectory + "/Temp/" + in_packageDetails.m_id + ".packzip");
@@ -588,12 +840,18 @@ namespace ChilliSource
 			if(!ZippedFile)
 			{
 				CS_LOG_ERROR("CMS: Cannot unzip content package: " + in_packageDetails.m_id);
-				return;
+				return false;
 			}
 
             //Remove old content before installing the new stuff
             DeleteDirectory(in_packageDetails.m_id);
             
+            auto fileSystem = Core::Application::Get()->GetFileSystem();
+            bool success = true;
+            
+            //Files are streamed through a single buffer rather than read whole
+            std::unique_ptr<s8[]> dataBuffer(new s8[k_extractChunkSize]);
+            
             //Go to the first file in the zip
             const u64 uddwFilenameLength = 256;
             s8 byaFileName[uddwFilenameLength];
@@ -604,16 +862,14 @@ namespace ChilliSource
             {
                 //Open the next file
                 if (unzOpenCurrentFile(ZippedFile) != UNZ_OK)
+                {
+                    success = false;
                     break;
+                }
                 
                 //Get file information
                 unz_file_info FileInfo;
                 unzGetCurrentFileInfo(ZippedFile, &FileInfo, byaFileName, uddwFilenameLength, nullptr, 0, nullptr, 0);
-                CS_ASSERT(FileInfo.uncompressed_size < static_cast<uLong>(std::numeric_limits<u32>::max()), "File is too large. It cannot exceed " + CSCore::ToString(std::numeric_limits<u32>::max()) + " bytes.");
-                
-                //Load the file into memory and then save it out to the directory
-                s8* pbyDataBuffer =  new s8[FileInfo.uncompressed_size];
-                unzReadCurrentFile(ZippedFile, pbyDataBuffer, static_cast<unsigned>(FileInfo.uncompressed_size));
                 
                 //Create new stuff
                 std::string strFilePath = std::string(byaFileName);
@@ -621,22 +877,71 @@ namespace ChilliSource
                 {
                     //There is a nested folder so we need to create the directory structure
                     std::string strPath = GetPathExcludingFileName(strFilePath);
-                    Core::Application::Get()->GetFileSystem()->CreateDirectoryPath(Core::StorageLocation::k_DLC, "/" + strPath);
+                    fileSystem->CreateDirectoryPath(Core::StorageLocation::k_DLC, "/" + strPath);
                 }
                 
                 if(IsFile(strFilePath))
                 {
-                    Core::Application::Get()->GetFileSystem()->WriteFile(Core::StorageLocation::k_DLC, "/" + strFilePath, pbyDataBuffer, static_cast<u32>(FileInfo.uncompressed_size));
+                    auto checksumIt = in_fileChecksums.find(strFilePath);
+                    bool validateChecksum = (checksumIt != in_fileChecksums.end());
+                    
+                    CSHA1 hash;
+                    hash.Reset();
+                    
+                    Core::FileStreamUPtr fileStream = fileSystem->CreateFileStream(Core::StorageLocation::k_DLC, "/" + strFilePath, Core::FileMode::k_writeBinary);
+                    bool fileSuccess = (fileStream != nullptr);
+                    
+                    s32 bytesRead = 0;
+                    while(fileSuccess && (bytesRead = unzReadCurrentFile(ZippedFile, dataBuffer.get(), k_extractChunkSize)) > 0)
+                    {
+                        fileStream->Write(dataBuffer.get(), bytesRead);
+                        if(validateChecksum)
+                        {
+                            hash.Update(reinterpret_cast<u8*>(dataBuffer.get()), static_cast<u32>(bytesRead));
+                        }
+                        
+                        m_runningInstalledTotal += static_cast<u64>(bytesRead);
+                    }
+                    fileStream.reset();
+                    
+                    if(bytesRead < 0)
+                    {
+                        fileSuccess = false;
+                    }
+                    
+                    if(fileSuccess && validateChecksum)
+                    {
+                        hash.Final();
+                        std::string checksum = EncodeSHA1Checksum(hash);
+                        if(checksum == checksumIt->second)
+                        {
+                            //The file doesn't need hashing again on the next update check
+                            m_checksumCache->SetChecksum(Core::StorageLocation::k_DLC, strFilePath, checksum);
+                        }
+                        else
+                        {
+                            CS_LOG_ERROR("CMS: " + in_packageDetails.m_id + " Checksum mismatch for extracted file: " + strFilePath);
+                            fileSuccess = false;
+                        }
+                    }
+                    
+                    if(fileSuccess == false)
+                    {
+                        CS_LOG_ERROR("CMS: " + in_packageDetails.m_id + " Failed to extract file: " + strFilePath);
+                        fileSystem->DeleteFile(Core::StorageLocation::k_DLC, "/" + strFilePath);
+                        success = false;
+                    }
                 }
                 
                 //Close current file and jump to the next
-                CS_SAFEDELETE_ARRAY(pbyDataBuffer);
                 unzCloseCurrentFile(ZippedFile);
                 dwStatus = unzGoToNextFile(ZippedFile);
             }
             
             //Close the zip
             unzClose(ZippedFile);
+            
+            return success;
         }
 		//-----------------------------------------------------------
 		//-----------------------------------------------------------
@@ -652,6 +957,18 @@ namespace ChilliSource
 		}
         //-----------------------------------------------------------
         //-----------------------------------------------------------
+        u64 ContentManagementSystem::GetRunningTotalToInstall() const
+        {
+            return m_runningToInstallTotal;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
+        u64 ContentManagementSystem::GetRunningTotalInstalled() const
+        {
+            return m_runningInstalledTotal;
+        }
+        //-----------------------------------------------------------
+        //-----------------------------------------------------------
         IContentDownloader* ContentManagementSystem::GetContentDownloader() const
         {
             return m_contentDownloader;
@@ -671,7 +988,7 @@ namespace ChilliSource
                 if(Core::Application::Get()->GetFileSystem()->DoesFileExist(Core::StorageLocation::k_package, Core::Application::Get()->GetFileSystem()->GetPackageDLCPath() + in_filename))
                 {
                     //Check if the file has become corrupted
-                    return (CalculateChecksum(Core::StorageLocation::k_package, Core::Application::Get()->GetFileSystem()->GetPackageDLCPath() + in_filename) == in_checksum);
+                    return (GetFileChecksum(Core::StorageLocation::k_package, Core::Application::Get()->GetFileSystem()->GetPackageDLCPath() + in_filename) == in_checksum);
                 }
                 
                 return false;
@@ -681,7 +998,7 @@ namespace ChilliSource
                 if(Core::Application::Get()->GetFileSystem()->DoesFileExist(Core::StorageLocation::k_DLC, in_filename))
                 {
                     //Check if the file has become corrupted
-                    return (CalculateChecksum(Core::StorageLocation::k_DLC, in_filename) == in_checksum);
+                    return (GetFileChecksum(Core::StorageLocation::k_DLC, in_filename) == in_checksum);
                 }
                 
                 return false;
@@ -35,6 +35,9 @@
 #include <ChilliSource/Core/XML/XMLUtils.h>
 #include <ChilliSource/Networking/ContentDownload/IContentDownloader.h>
 
+#include <atomic>
+#include <unordered_map>
+
 namespace ChilliSource
 {
     namespace Networking
@@ -153,7 +156,16 @@ namespace ChilliSource
             void DownloadUpdates(const CompleteDelegate& in_delegate);
             //-----------------------------------------------------------
             /// Having downloaded the update packages this method
-            /// unzips the packages and overwrites any old assets
+            /// unzips the packages and overwrites any old assets.
+            ///
+            /// Packages are extracted concurrently on background
+            /// threads and the delegate is called on the main thread
+            /// once they are all complete. No other update methods
+            /// should be called until then. Progress can be monitored
+            /// with GetRunningTotalInstalled().
+            ///
+            /// Installation fails if any extracted file doesn't match
+            /// its checksum in the server manifest.
             ///
             /// @author S Downie
             ///
@@ -195,12 +207,35 @@ namespace ChilliSource
             //-----------------------------------------------------------
             u32 GetRunningTotalDownloaded() const;
             //-----------------------------------------------------------
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The total uncompressed size of the packages
+            /// being installed. This is zero until the install has
+            /// read the contents of each package.
+            //-----------------------------------------------------------
+            u64 GetRunningTotalToInstall() const;
+            //-----------------------------------------------------------
+            /// This is thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @return The number of bytes that have been extracted so
+            /// far during the current install.
+            //-----------------------------------------------------------
+            u64 GetRunningTotalInstalled() const;
+            //-----------------------------------------------------------
             /// @author S Downie
             ///
             /// @return The current content downloader
             //-----------------------------------------------------------
             IContentDownloader* GetContentDownloader() const;
             //-----------------------------------------------------------
+            /// Sets a custom delegate used to calculate file checksums.
+            /// Checksums from a custom delegate are not cached and are
+            /// calculated serially on the calling thread.
+            ///
             /// @author N Tanda
             ///
             /// @param The checksum calculation delegate
@@ -286,6 +321,23 @@ namespace ChilliSource
             //-----------------------------------------------------------
             void AddToDownloadListIfNotInBundle(Core::XML::Node* in_packageEl);
             //-----------------------------------------------------------
+            /// Calculates the checksums of all local files which
+            /// BuildDownloadList() will need to validate, in parallel on
+            /// the task scheduler. Files in packages whose local checksum
+            /// matches the server are validated in the DLC storage
+            /// location, all others are validated in the bundle.
+            ///
+            /// Nothing is calculated if a custom checksum delegate is
+            /// set, as it may not be thread-safe.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The root node of the server manifest.
+            /// @param The checksums of the packages in the local manifest
+            /// keyed on package Id.
+            //-----------------------------------------------------------
+            void CalculateLocalChecksums(Core::XML::Node* in_serverManifestRootNode, const std::unordered_map<std::string, std::string>& in_localPackageChecksums);
+            //-----------------------------------------------------------
             /// Save the zip file to documents directory
             ///
             /// @author S Downie
@@ -297,14 +349,35 @@ namespace ChilliSource
             //-----------------------------------------------------------
             bool SavePackageToFile(const PackageDetails& in_packageDetails, const std::string& in_zippedPackage, bool in_fullyDownloaded);
             //-----------------------------------------------------------
+            /// Called on the main thread once all packages have been
+            /// extracted to complete the install.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param Whether or not all packages were extracted
+            /// successfully.
+            /// @param Delegate to call when Install is complete
+            //-----------------------------------------------------------
+            void OnInstallComplete(bool in_success, const CompleteDelegate& in_delegate);
+            //-----------------------------------------------------------
             /// Unzip the package and save all the files to the
-            /// documents directory
+            /// documents directory. Files are streamed through a
+            /// fixed size buffer and, if the default checksum is in
+            /// use, their checksum is validated as they are written.
+            ///
+            /// This is thread-safe, so packages can be extracted
+            /// concurrently.
             ///
             /// @author S Downie
             ///
             /// @param Zipped package
+            /// @param The expected checksum of each file keyed on its
+            /// path.
+            ///
+            /// @return Whether or not all files were successfully
+            /// extracted.
             //-----------------------------------------------------------
-            void ExtractFilesFromPackage(const PackageDetails& in_packageDetails) const;
+            bool ExtractFilesFromPackage(const PackageDetails& in_packageDetails, const std::unordered_map<std::string, std::string>& in_fileChecksums) const;
             //-----------------------------------------------------------
 			/// Deletes a directory from the DLC Storage Location.
             ///
@@ -340,6 +413,18 @@ namespace ChilliSource
             //-----------------------------------------------------------
             std::string CalculateChecksum(Core::StorageLocation in_location, const std::string& in_filePath) const;
             //-----------------------------------------------------------
+            /// Gets the checksum of a local file. If the default checksum
+            /// is in use this is read from the checksum cache, and is
+            /// only recalculated if the file has changed.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param File location
+            /// @param File path
+            /// @return Checksum string
+            //-----------------------------------------------------------
+            std::string GetFileChecksum(Core::StorageLocation in_location, const std::string& in_filePath) const;
+            //-----------------------------------------------------------
             /// Perform the HTTP request for the next DLC package.
             ///
             /// @author S Downie
@@ -352,6 +437,8 @@ namespace ChilliSource
 			
 			u32	m_runningToDownloadTotal = 0;
 			u32 m_runningDownloadedTotal = 0;
+            std::atomic<u64> m_runningToInstallTotal;
+            mutable std::atomic<u64> m_runningInstalledTotal;
             
             Core::XMLUPtr m_serverManifest;
             
@@ -360,6 +447,7 @@ namespace ChilliSource
             CheckForUpdateDelegate m_onUpdateCheckCompleteDelegate;
             CompleteDelegate m_onDownloadCompleteDelegate;
             ChecksumDelegate m_checksumDelegate;
+            ChecksumCacheUPtr m_checksumCache;
             
             std::string m_serverManifestData;
             std::string m_contentDirectory;
@@ -367,6 +455,7 @@ namespace ChilliSource
             u32 m_currentPackageDownload = 0;
             
             bool m_dlcCachePurged = false;
+            bool m_isInstalling = false;
         };
     }
 }
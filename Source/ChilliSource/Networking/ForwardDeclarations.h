@@ -43,6 +43,7 @@ namespace ChilliSource
         //--------------------------------------------------
         /// Content Download
         //--------------------------------------------------
+        CS_FORWARDDECLARE_CLASS(ChecksumCache);
         CS_FORWARDDECLARE_CLASS(IContentDownloader);
         CS_FORWARDDECLARE_CLASS(ContentManagementSystem);
         CS_FORWARDDECLARE_CLASS(MoContentDownloader);
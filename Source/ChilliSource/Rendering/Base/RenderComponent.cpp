@@ -72,7 +72,7 @@ namespace ChilliSource
 		//-----------------------------------------------------
 		/// Get Transformation Matrix
 		//-----------------------------------------------------
-		const Core::Matrix4& RenderComponent::GetTransformationMatrix()
+		Core::Matrix4 RenderComponent::GetTransformationMatrix()
 		{
 			return GetEntity()->GetTransform().GetWorldTransform();
 		}
@@ -118,7 +118,7 @@ namespace ChilliSource
             ///
             /// @return Objects transform
             //-----------------------------------------------------
-            const Core::Matrix4& GetTransformationMatrix();
+            Core::Matrix4 GetTransformationMatrix();
 			//-----------------------------------------------------
             /// Render 
             ///
@@ -177,7 +177,16 @@ namespace ChilliSource
             AmbientLightComponent* pAmbientLight = nullptr;
 
 			FindRenderableObjectsInScene(inpScene, aPreFilteredRenderCache, aCameraCache, aDirLightCache, aPointLightCache, pAmbientLight);
-            mpActiveCamera = (aCameraCache.empty() ? nullptr : aCameraCache.back());
+            
+            //the most recently added camera is the active camera.
+            mpActiveCamera = nullptr;
+            for (CameraComponent* camera : aCameraCache)
+            {
+                if (mpActiveCamera == nullptr || camera->GetSceneInsertionOrder() > mpActiveCamera->GetSceneInsertionOrder())
+                {
+                    mpActiveCamera = camera;
+                }
+            }
 
             if(mpActiveCamera)
             {
@@ -297,7 +306,11 @@ namespace ChilliSource
                 }
                 else if(aLightComponentCache[i]->IsA(AmbientLightComponent::InterfaceID))
                 {
-                    outpAmbientLight = (AmbientLightComponent*)aLightComponentCache[i];
+                    //the most recently added ambient light is used.
+                    if(outpAmbientLight == nullptr || aLightComponentCache[i]->GetSceneInsertionOrder() > outpAmbientLight->GetSceneInsertionOrder())
+                    {
+                        outpAmbientLight = (AmbientLightComponent*)aLightComponentCache[i];
+                    }
                 }
             }
 		}
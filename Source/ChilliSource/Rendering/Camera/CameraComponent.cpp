@@ -139,6 +139,18 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
 		const Core::Frustum& CameraComponent::GetFrustum()
 		{
+            if(GetEntity() != nullptr)
+            {
+                //the transform changed event is deferred until the end of the frame, so
+                //the change count is checked to ensure the frustum is never out of date.
+                u32 changeCount = GetEntity()->GetTransform().GetChangeCount();
+                if(changeCount != m_transformChangeCount)
+                {
+                    m_transformChangeCount = changeCount;
+                    m_isFrustumCacheValid = false;
+                }
+            }
+            
             if(m_isFrustumCacheValid == false)
             {
                 UpdateFrustum();
@@ -200,10 +212,7 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         void CameraComponent::OnAddedToEntity()
         {
-            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection([=]()
-            {
-                m_isFrustumCacheValid = false;
-            });
+            m_isFrustumCacheValid = false;
         }
         //------------------------------------------------------------------------------
         //------------------------------------------------------------------------------
@@ -220,12 +229,6 @@ namespace ChilliSource
         {
             m_resolutionChangedConnection.reset();
         }
-        //------------------------------------------------------------------------------
-        //------------------------------------------------------------------------------
-        void CameraComponent::OnRemovedFromEntity()
-        {
-            m_transformChangedConnection.reset();
-        }
 	}
 }
 
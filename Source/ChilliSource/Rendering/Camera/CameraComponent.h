@@ -201,12 +201,6 @@ namespace ChilliSource
             /// @author Ian Copland
             //------------------------------------------------------------------------------
             void OnRemovedFromScene() override;
-            //------------------------------------------------------------------------------
-            /// Called when the component is removed from an entity.
-            ///
-            /// @author Ian Copland
-            //------------------------------------------------------------------------------
-            void OnRemovedFromEntity() override;
             
         protected:
             
@@ -215,6 +209,7 @@ namespace ChilliSource
             f32 m_farClip;
             bool m_isProjCacheValid = false;
             bool m_isFrustumCacheValid = false;
+            u32 m_transformChangeCount = 0;
             Core::Screen* m_screen = nullptr;
 
 		private:
@@ -227,7 +222,6 @@ namespace ChilliSource
             
             ICullingPredicateSPtr m_cullPredicate;
             
-            Core::EventConnectionUPtr m_transformChangedConnection;
             Core::EventConnectionUPtr m_resolutionChangedConnection;
 		};
 	}
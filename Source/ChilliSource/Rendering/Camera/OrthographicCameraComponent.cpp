@@ -58,6 +58,12 @@ namespace ChilliSource
 		{
 			return (in_interfaceId == CameraComponent::InterfaceID || in_interfaceId == OrthographicCameraComponent::InterfaceID);
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool OrthographicCameraComponent::IsUpdatePhaseRequired(UpdatePhase in_phase) const
+		{
+			return false;
+		}
         //------------------------------------------------------
 		//------------------------------------------------------
 		void OrthographicCameraComponent::SetViewportSize(const Core::Vector2& in_size)
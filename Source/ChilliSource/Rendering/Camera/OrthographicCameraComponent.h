@@ -65,6 +65,16 @@ namespace ChilliSource
 			/// @return Whether the class matches the comparison type
 			//----------------------------------------------------------
 			bool IsA(Core::InterfaceIDType in_interfaceId) const override;
+			//----------------------------------------------------------
+			/// Cameras don't need to be updated so no phases are required.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The update phase.
+			///
+			/// @return Whether or not the phase is required.
+			//----------------------------------------------------------
+			bool IsUpdatePhaseRequired(UpdatePhase in_phase) const override;
             //----------------------------------------------------------
             /// @author S Downie
 			///
@@ -57,6 +57,12 @@ namespace ChilliSource
 		{
 			return (in_interfaceId == CameraComponent::InterfaceID || in_interfaceId == PerspectiveCameraComponent::InterfaceID);
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool PerspectiveCameraComponent::IsUpdatePhaseRequired(UpdatePhase in_phase) const
+		{
+			return false;
+		}
         //------------------------------------------------------
 		//------------------------------------------------------
 		void PerspectiveCameraComponent::SetFieldOfView(f32 in_fov)
@@ -281,6 +281,7 @@ namespace ChilliSource
                 {
                     if(in_texture != nullptr)
                     {
+                        out_resource->AddDependency(in_texture);
                         Core::Application::Get()->GetTaskScheduler()->ScheduleTask([out_resource, in_delegate, in_location, in_filePath, in_texture]()
                         {
                             Font::Descriptor desc;
@@ -110,9 +110,11 @@ namespace ChilliSource
         /// Particle
         //------------------------------------------------------------
 		CS_FORWARDDECLARE_CLASS(ConcurrentParticleData);
+		CS_FORWARDDECLARE_CLASS(ParticleBufferPool);
 		CS_FORWARDDECLARE_CLASS(CSParticleProvider);
 		CS_FORWARDDECLARE_CLASS(ParticleEffect);
 		CS_FORWARDDECLARE_CLASS(ParticleEffectComponent);
+		CS_FORWARDDECLARE_CLASS(ParticleSnapshot);
 		CS_FORWARDDECLARE_STRUCT(Particle);
 		CS_FORWARDDECLARE_CLASS(ParticleDrawable);
 		CS_FORWARDDECLARE_CLASS(ParticleDrawableDef);
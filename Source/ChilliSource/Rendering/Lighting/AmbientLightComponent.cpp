@@ -41,6 +41,12 @@ namespace ChilliSource
 		{
 			return inInterfaceID == LightComponent::InterfaceID || inInterfaceID == AmbientLightComponent::InterfaceID;
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool AmbientLightComponent::IsUpdatePhaseRequired(UpdatePhase in_phase) const
+		{
+			return false;
+		}
         //----------------------------------------------------------
         /// Get Light Matrix
         //----------------------------------------------------------
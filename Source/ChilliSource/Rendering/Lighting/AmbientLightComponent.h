@@ -36,7 +36,7 @@ namespace ChilliSource
 {
 	namespace Rendering
 	{
-		class AmbientLightComponent : public LightComponent
+		class AmbientLightComponent final : public LightComponent
 		{
 		public:
 			CS_DECLARE_NAMEDTYPE(AmbientLightComponent);
@@ -49,6 +49,16 @@ namespace ChilliSource
 			/// @return Whether the class matches the comparison type
 			//----------------------------------------------------------
 			bool IsA(Core::InterfaceIDType inInterfaceID) const override;
+			//----------------------------------------------------------
+			/// Lights don't need to be updated so no phases are required.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The update phase.
+			///
+			/// @return Whether or not the phase is required.
+			//----------------------------------------------------------
+			bool IsUpdatePhaseRequired(UpdatePhase in_phase) const override;
             //----------------------------------------------------------
             /// Get Light Matrix
             ///
@@ -68,6 +68,12 @@ namespace ChilliSource
 		{
 			return inInterfaceID == LightComponent::InterfaceID || inInterfaceID == DirectionalLightComponent::InterfaceID;
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool DirectionalLightComponent::IsUpdatePhaseRequired(UpdatePhase in_phase) const
+		{
+			return false;
+		}
         //----------------------------------------------------------
         /// Set Shadow Volume
         //----------------------------------------------------------
@@ -97,8 +103,9 @@ namespace ChilliSource
         const Core::Matrix4& DirectionalLightComponent::GetLightMatrix() const
         {
             //The matrix is a view projection
-            if(mbMatrixCacheValid == false && GetEntity() != nullptr)
+            if(GetEntity() != nullptr && (mbMatrixCacheValid == false || GetEntity()->GetTransform().GetChangeCount() != m_matrixTransformChangeCount))
             {
+                m_matrixTransformChangeCount = GetEntity()->GetTransform().GetChangeCount();
                 Core::Matrix4 matView = Core::Matrix4::Inverse(GetEntity()->GetTransform().GetWorldTransform());
 				mmatLight = matView * mmatProj;
                 mbMatrixCacheValid = true;
@@ -139,19 +146,6 @@ namespace ChilliSource
         //----------------------------------------------------
         //----------------------------------------------------
         void DirectionalLightComponent::OnAddedToScene()
-        {
-            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeDelegate(this, &DirectionalLightComponent::OnEntityTransformChanged));
-        }
-        //----------------------------------------------------
-        //----------------------------------------------------
-        void DirectionalLightComponent::OnRemovedFromScene()
-        {
-            m_transformChangedConnection = nullptr;
-        }
-        //----------------------------------------------------
-        /// On Entity Transform Changed
-        //----------------------------------------------------
-        void DirectionalLightComponent::OnEntityTransformChanged()
         {
             mbMatrixCacheValid = false;
             mbCacheValid = false;
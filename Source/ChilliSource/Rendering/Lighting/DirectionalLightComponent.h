@@ -36,7 +36,7 @@ namespace ChilliSource
 {
 	namespace Rendering
 	{
-		class DirectionalLightComponent : public LightComponent
+		class DirectionalLightComponent final : public LightComponent
 		{
 		public:
 			CS_DECLARE_NAMEDTYPE(DirectionalLightComponent);
@@ -56,6 +56,16 @@ namespace ChilliSource
 			/// @return Whether the class matches the comparison type
 			//----------------------------------------------------------
 			bool IsA(Core::InterfaceIDType inInterfaceID) const override;
+			//----------------------------------------------------------
+			/// Lights don't need to be updated so no phases are required.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The update phase.
+			///
+			/// @return Whether or not the phase is required.
+			//----------------------------------------------------------
+			bool IsUpdatePhaseRequired(UpdatePhase in_phase) const override;
             //----------------------------------------------------------
 			/// Set Shadow Volume
 			///
@@ -97,20 +107,6 @@ namespace ChilliSource
             /// @author S Downie
 			//----------------------------------------------------
             void OnAddedToScene() override;
-			//----------------------------------------------------
-			/// Triggered when the component is removed from
-			/// an entityon the scene
-            ///
-            /// @author S Downie
-			//----------------------------------------------------
-            void OnRemovedFromScene() override;
-            //----------------------------------------------------
-            /// On Entity Transform Changed
-            ///
-            /// Triggered when the entity transform changes
-            /// and invalidates the light VP matrix
-            //----------------------------------------------------
-            void OnEntityTransformChanged();
             //----------------------------------------------------------
 			/// Get Shadow Map Ptr
 			///
@@ -149,8 +145,7 @@ namespace ChilliSource
             
             Core::Matrix4 mmatProj;
             mutable bool mbMatrixCacheValid;
-            
-            Core::EventConnectionUPtr m_transformChangedConnection;
+            mutable u32 m_matrixTransformChangeCount = 0;
             
             f32 mfShadowTolerance;
             u32 m_shadowMapRes;
@@ -65,7 +65,7 @@ namespace ChilliSource
         //----------------------------------------------------------
         /// Get World Position
         //----------------------------------------------------------
-        const Core::Vector3& LightComponent::GetWorldPosition() const
+        Core::Vector3 LightComponent::GetWorldPosition() const
         {
             if(GetEntity() != nullptr)
             {
@@ -95,6 +95,13 @@ namespace ChilliSource
         //----------------------------------------------------------
         bool LightComponent::IsCacheValid() const
         {
+            //the transform changed event is deferred until the end of the frame, so the
+            //change count is checked to catch any changes to the entity transform.
+            if(GetEntity() != nullptr && GetEntity()->GetTransform().GetChangeCount() != m_cacheTransformChangeCount)
+            {
+                return false;
+            }
+            
             return mbCacheValid;
         }
         //----------------------------------------------------------
@@ -102,6 +109,11 @@ namespace ChilliSource
         //----------------------------------------------------------
         void LightComponent::SetCacheValid()
         {
+            if(GetEntity() != nullptr)
+            {
+                m_cacheTransformChangeCount = GetEntity()->GetTransform().GetChangeCount();
+            }
+            
             mbCacheValid = true;
         }
 	}
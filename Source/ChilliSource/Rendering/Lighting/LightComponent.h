@@ -68,7 +68,7 @@ namespace ChilliSource
 			///
 			/// @return Position in world space
 			//----------------------------------------------------------
-			const Core::Vector3& GetWorldPosition() const;
+			Core::Vector3 GetWorldPosition() const;
             //----------------------------------------------------------
 			/// Set Intensity
 			///
@@ -90,8 +90,8 @@ namespace ChilliSource
             //----------------------------------------------------------
             /// Is Cache Valid
             ///
-            /// @return Have any lighting values changed since the last
-            /// render
+            /// @return Have any lighting values or the entity transform
+            /// changed since the last render
             //----------------------------------------------------------
             bool IsCacheValid() const;
             //----------------------------------------------------------
@@ -118,6 +118,7 @@ namespace ChilliSource
             f32 mfIntensity;
             
             bool mbCacheValid;
+            u32 m_cacheTransformChangeCount = 0;
 		};
     }
 }
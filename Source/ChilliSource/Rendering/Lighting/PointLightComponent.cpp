@@ -55,6 +55,12 @@ namespace ChilliSource
 		{
 			return inInterfaceID == LightComponent::InterfaceID || inInterfaceID == PointLightComponent::InterfaceID;
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool PointLightComponent::IsUpdatePhaseRequired(UpdatePhase in_phase) const
+		{
+			return false;
+		}
         //----------------------------------------------------------
         /// Set Radius
         //----------------------------------------------------------
@@ -120,8 +126,9 @@ namespace ChilliSource
         {
             //The point light matrix is simply a light view matrix
             //as the projection is done in the shader
-            if(mbMatrixCacheValid == false && GetEntity() != nullptr)
+            if(GetEntity() != nullptr && (mbMatrixCacheValid == false || GetEntity()->GetTransform().GetChangeCount() != m_matrixTransformChangeCount))
             {
+                m_matrixTransformChangeCount = GetEntity()->GetTransform().GetChangeCount();
                 mmatLight = Core::Matrix4::Inverse(GetEntity()->GetTransform().GetWorldTransform());
                 mbMatrixCacheValid = true;
             }
@@ -131,19 +138,6 @@ namespace ChilliSource
         //----------------------------------------------------
         //----------------------------------------------------
         void PointLightComponent::OnAddedToScene()
-        {
-            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeDelegate(this, &PointLightComponent::OnEntityTransformChanged));
-        }
-        //----------------------------------------------------
-        //----------------------------------------------------
-        void PointLightComponent::OnRemovedFromScene()
-        {
-            m_transformChangedConnection = nullptr;
-        }
-        //----------------------------------------------------
-        /// On Entity Transform Changed
-        //----------------------------------------------------
-        void PointLightComponent::OnEntityTransformChanged()
         {
             mbMatrixCacheValid = false;
             mbCacheValid = false;
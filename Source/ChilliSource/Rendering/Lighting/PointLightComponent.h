@@ -36,7 +36,7 @@ namespace ChilliSource
 {
 	namespace Rendering
 	{
-		class PointLightComponent : public LightComponent
+		class PointLightComponent final : public LightComponent
 		{
 		public:
 			CS_DECLARE_NAMEDTYPE(PointLightComponent);
@@ -53,6 +53,16 @@ namespace ChilliSource
 			/// @return Whether the class matches the comparison type
 			//----------------------------------------------------------
 			bool IsA(Core::InterfaceIDType inInterfaceID) const override;
+			//----------------------------------------------------------
+			/// Lights don't need to be updated so no phases are required.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The update phase.
+			///
+			/// @return Whether or not the phase is required.
+			//----------------------------------------------------------
+			bool IsUpdatePhaseRequired(UpdatePhase in_phase) const override;
             //----------------------------------------------------------
 			/// Set Radius
 			///
@@ -140,20 +150,6 @@ namespace ChilliSource
             /// @author S Downie
 			//----------------------------------------------------
             void OnAddedToScene() override;
-			//----------------------------------------------------
-			/// Triggered when the component is removed from
-			/// an entity on the scene
-            ///
-            /// @author S Downie
-			//----------------------------------------------------
-            void OnRemovedFromScene() override;
-            //----------------------------------------------------
-            /// On Entity Transform Changed
-            ///
-            /// Triggered when the entity transform changes
-            /// and invalidates the light VP matrix
-            //----------------------------------------------------
-            void OnEntityTransformChanged();
             //----------------------------------------------------------
             /// Calculate Lighting Values
             ///
@@ -164,8 +160,6 @@ namespace ChilliSource
             void CalculateLightingValues();
         private:
             
-            Core::EventConnectionUPtr m_transformChangedConnection;
-            
             f32 mfConstantAttenuation;
             f32 mfLinearAttenuation;
             f32 mfQuadraticAttenuation;
@@ -174,6 +168,7 @@ namespace ChilliSource
             f32 mfRangeOfInfluence;
             
             mutable bool mbMatrixCacheValid;
+            mutable u32 m_matrixTransformChangeCount = 0;
 		};
     }
 }
@@ -586,6 +586,7 @@ namespace ChilliSource
                             if(in_shader->GetLoadState() == Core::Resource::LoadState::k_loaded)
                             {
                                 out_material->SetShader(in_descs[in_loadIndex].m_pass, in_shader);
+                                out_material->AddDependency(in_shader);
                                 
                                 u32 newLoadIndex = in_loadIndex + 1;
                                 
@@ -617,6 +618,7 @@ namespace ChilliSource
                             if(in_texture->GetLoadState() == Core::Resource::LoadState::k_loaded)
                             {
                                 out_material->AddTexture(in_texture);
+                                out_material->AddDependency(in_texture);
                                 
                                 u32 newLoadIndex = in_loadIndex + 1;
                                 
@@ -648,6 +650,7 @@ namespace ChilliSource
                             if(in_cubemap->GetLoadState() == Core::Resource::LoadState::k_loaded)
                             {
                                 out_material->SetCubemap(in_cubemap);
+                                out_material->AddDependency(in_cubemap);
 
                                 u32 newLoadIndex = in_loadIndex + 1;
 
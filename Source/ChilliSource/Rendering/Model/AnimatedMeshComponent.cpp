@@ -70,6 +70,12 @@ namespace ChilliSource
                     (inInterfaceID == RenderComponent::InterfaceID) ||
                     (inInterfaceID == VolumeComponent::InterfaceID);
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool AnimatedMeshComponent::IsUpdatePhaseRequired(UpdatePhase in_phase) const
+		{
+			return (in_phase == UpdatePhase::k_update);
+		}
 		//----------------------------------------------------
 		/// Get Axis Aligned Bounding Box
 		//----------------------------------------------------
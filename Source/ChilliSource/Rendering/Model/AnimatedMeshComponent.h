@@ -67,7 +67,7 @@ namespace ChilliSource
 		/// An animated mesh component. This defines a 3D mesh that can
 		/// be manipulated, textured and animated.
 		//===============================================================
-		class AnimatedMeshComponent : public RenderComponent
+		class AnimatedMeshComponent final : public RenderComponent
 		{
 		public:
 			CS_DECLARE_NAMEDTYPE(AnimatedMeshComponent);
@@ -82,6 +82,16 @@ namespace ChilliSource
 			/// @return Whether the class matches the comparison type
 			//----------------------------------------------------------
 			bool IsA(Core::InterfaceIDType inInterfaceID) const override;
+			//----------------------------------------------------------
+			/// Only the update phase is required, to advance the animation.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The update phase.
+			///
+			/// @return Whether or not the phase is required.
+			//----------------------------------------------------------
+			bool IsUpdatePhaseRequired(UpdatePhase in_phase) const override;
 			//----------------------------------------------------
 			/// Get Axis Aligned Bounding Box
 			///
@@ -29,6 +29,9 @@
 #include <ChilliSource/Rendering/Model/CSAnimProvider.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/AsyncFileReader.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+#include <ChilliSource/Core/File/MemoryReader.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
@@ -46,58 +49,50 @@ namespace ChilliSource
             const u32 k_maxVersion = 4;
             const u32 k_fileCheckValue = 7777;
             
-            //----------------------------------------------------------------------------
-            /// Read value of the given type and size from the binary file stream
-            ///
-			/// @author Ian Copland
-			///
-			/// @param File stream
-			/// @return Value of type TType
-			//----------------------------------------------------------------------------
-			template <typename TType> TType ReadValue(const Core::FileStreamSPtr& in_fileStream)
-			{
-				TType value;
-				in_fileStream->Read(reinterpret_cast<s8*>(&value), sizeof(TType));
-				return value;
-			}
+            const u32 k_headerSize = 17;
+            const u32 k_nodeFrameDataSize = 10 * sizeof(f32);
+            
             //----------------------------------------------------------------------------
             /// Reads all of the data for the animation into the SkinnedAnimation resource
             ///
             /// @author Ian Copland
             ///
-            /// @param The file stream.
+            /// @param The file reader.
             /// @param The number of frames.
             /// @param The number of skeleton nodes.
             /// @param [Out] Animation resource to populate
             //----------------------------------------------------------------------------
-            void ReadAnimationData(const Core::FileStreamSPtr& in_fileStream, u32 in_numFrames, s32 in_numSkeletonNodes, const SkinnedAnimationSPtr& out_resource)
+            void ReadAnimationData(Core::MemoryReader& in_reader, u32 in_numFrames, s32 in_numSkeletonNodes, const SkinnedAnimationSPtr& out_resource)
             {
                 for (u32 frameCount=0; frameCount<in_numFrames; ++frameCount)
                 {
                     //create new frame
                     SkinnedAnimation::FrameUPtr frame(new SkinnedAnimation::Frame());
+                    frame->m_nodeTranslations.reserve(in_numSkeletonNodes);
+                    frame->m_nodeOrientations.reserve(in_numSkeletonNodes);
+                    frame->m_nodeScales.reserve(in_numSkeletonNodes);
                     
                     //add all skeleton nodes matrices
                     for (u32 skelNodeCount=0; skelNodeCount<(u32)in_numSkeletonNodes; ++skelNodeCount)
                     {
                         //create new translation
                         Core::Vector3 translation;
-                        translation.x = ReadValue<f32>(in_fileStream);
-                        translation.y = ReadValue<f32>(in_fileStream);
-                        translation.z = ReadValue<f32>(in_fileStream);
+                        translation.x = in_reader.Read<f32>();
+                        translation.y = in_reader.Read<f32>();
+                        translation.z = in_reader.Read<f32>();
                         
                         //create new orientation
                         Core::Quaternion orientation;
-                        orientation.x = ReadValue<f32>(in_fileStream);
-                        orientation.y = ReadValue<f32>(in_fileStream);
-                        orientation.z = ReadValue<f32>(in_fileStream);
-                        orientation.w = ReadValue<f32>(in_fileStream);
+                        orientation.x = in_reader.Read<f32>();
+                        orientation.y = in_reader.Read<f32>();
+                        orientation.z = in_reader.Read<f32>();
+                        orientation.w = in_reader.Read<f32>();
                         
                         //create new scale
                         Core::Vector3 scale;
-                        scale.x = ReadValue<f32>(in_fileStream);
-                        scale.y = ReadValue<f32>(in_fileStream);
-                        scale.z = ReadValue<f32>(in_fileStream);
+                        scale.x = in_reader.Read<f32>();
+                        scale.y = in_reader.Read<f32>();
+                        scale.z = in_reader.Read<f32>();
                         
                         //add to the frame
                         frame->m_nodeTranslations.push_back(translation);
@@ -114,28 +109,31 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-			/// @param The file stream.
+			/// @param The file reader.
+			/// @param The file path.
 			/// @param the Skeletal Animation that this data is being loaded into.
+			/// @param [Out] The number of frames.
+			/// @param [Out] The number of skeleton nodes.
             ///
 			/// @return whether or not this was successful
 			//----------------------------------------------------------------------------
-			bool ReadHeader(const Core::FileStreamSPtr& in_stream, const std::string & in_filePath, const SkinnedAnimationSPtr& out_resource, u32& out_numFrames, s32& out_numSkeletonNodes)
+			bool ReadHeader(Core::MemoryReader& in_reader, const std::string & in_filePath, const SkinnedAnimationSPtr& out_resource, u32& out_numFrames, s32& out_numSkeletonNodes)
             {
                 //Check file for corruption
-                if(in_stream == nullptr)
+                if(in_reader.GetRemainingSize() < k_headerSize)
                 {
-                    CS_LOG_ERROR("Cannot open CSAnim file: " + in_filePath);
+                    CS_LOG_ERROR("CSAnim file is too small to contain a header: " + in_filePath);
                     return false;
                 }
                 
-                u32 fileCheckValue = ReadValue<u32>(in_stream);
+                u32 fileCheckValue = in_reader.Read<u32>();
                 if(fileCheckValue != k_fileCheckValue)
                 {
                     CS_LOG_ERROR("CSAnim file has corruption(incorrect File Check Value): " + in_filePath);
                     return false;
                 }
                 
-                u32 versionNum = ReadValue<u32>(in_stream);
+                u32 versionNum = in_reader.Read<u32>();
                 if (versionNum < k_minVersion || versionNum > k_maxVersion)
                 {
                     CS_LOG_ERROR("Unsupported CSAnim version: " + in_filePath);
@@ -143,19 +141,26 @@ namespace ChilliSource
                 }
                 
                 //build the feature declaration from the file
-                u32 numFeatures = (u32)ReadValue<u8>(in_stream);
+                u32 numFeatures = (u32)in_reader.Read<u8>();
                 if (numFeatures != 0)
                 {
                     CS_LOG_ERROR("Unknown feature type in CSAnim (" + in_filePath + ") feature declaration!");
                 }
                 
                 //read num frames and skeleton nodes
-                out_numFrames = (u32)ReadValue<u16>(in_stream);
-                out_numSkeletonNodes = (s32)ReadValue<s16>(in_stream);
+                out_numFrames = (u32)in_reader.Read<u16>();
+                out_numSkeletonNodes = (s32)in_reader.Read<s16>();
                 
                 //read frame time
-                f32 frameTime = ReadValue<f32>(in_stream);
+                f32 frameTime = in_reader.Read<f32>();
                 out_resource->SetFrameTime(frameTime);
+                
+                if (out_numSkeletonNodes < 0 || in_reader.GetRemainingSize() < u64(out_numFrames) * u64(out_numSkeletonNodes) * u64(k_nodeFrameDataSize))
+                {
+                    CS_LOG_ERROR("CSAnim file is truncated: " + in_filePath);
+                    return false;
+                }
+                
                 return true;
             }
         }
@@ -192,25 +197,43 @@ namespace ChilliSource
 		{
 			SkinnedAnimationSPtr anim = std::static_pointer_cast<SkinnedAnimation>(out_resource);
             
-            ReadSkinnedAnimationFromFile(in_location, in_filePath, nullptr, anim);
+            Core::MemoryMappedFileCSPtr file = Core::Application::Get()->GetFileSystem()->CreateMemoryMappedFile(in_location, in_filePath);
+            ReadSkinnedAnimationFromFile(file, in_filePath, nullptr, anim);
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
 		void CSAnimProvider::CreateResourceFromFileAsync(Core::StorageLocation in_location, const std::string& in_filePath, const Core::IResourceOptionsBaseCSPtr& in_options, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const Core::ResourceSPtr& out_resource)
 		{
 			SkinnedAnimationSPtr anim = std::static_pointer_cast<SkinnedAnimation>(out_resource);
-			auto task = std::bind(&CSAnimProvider::ReadSkinnedAnimationFromFile, this, in_location, in_filePath, in_delegate, anim);
-			Core::Application::Get()->GetTaskScheduler()->ScheduleTask(task);
+            
+            Core::AsyncFileReader* asyncFileReader = Core::Application::Get()->GetSystem<Core::AsyncFileReader>();
+            CS_ASSERT(asyncFileReader != nullptr, "CSAnimProvider is missing required system: AsyncFileReader.");
+            
+            asyncFileReader->ReadFile(in_location, in_filePath, [=](const Core::AsyncFileReader::ReadResult& in_result)
+            {
+                ReadSkinnedAnimationFromFile(in_result.m_file, in_filePath, in_delegate, anim);
+            });
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
-		void CSAnimProvider::ReadSkinnedAnimationFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const
+		void CSAnimProvider::ReadSkinnedAnimationFromFile(const Core::MemoryMappedFileCSPtr& in_file, const std::string& in_filePath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const
 		{
-			Core::FileStreamSPtr stream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_location, in_filePath, Core::FileMode::k_readBinary);
+			if (in_file == nullptr)
+			{
+				CS_LOG_ERROR("Cannot open CSAnim file: " + in_filePath);
+				out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
+				if(in_delegate != nullptr)
+				{
+					Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
+				}
+				return;
+			}
+
+			Core::MemoryReader reader(in_file->GetData(), in_file->GetSize());
 
 			u32 numFrames = 0;
 			s32 numSkeletonNodes = 0;
-			if(ReadHeader(stream, in_filePath, out_resource, numFrames, numSkeletonNodes) == false)
+			if(ReadHeader(reader, in_filePath, out_resource, numFrames, numSkeletonNodes) == false)
             {
                 CS_LOG_ERROR("Failed to read header in anim: " + in_filePath);
                 out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
@@ -221,7 +244,7 @@ namespace ChilliSource
                 return;
             }
             
-			ReadAnimationData(stream, numFrames, numSkeletonNodes, out_resource);
+			ReadAnimationData(reader, numFrames, numSkeletonNodes, out_resource);
 			
             out_resource->SetLoadState(Core::Resource::LoadState::k_loaded);
             
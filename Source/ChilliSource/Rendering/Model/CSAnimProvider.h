@@ -108,12 +108,12 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-            /// @param The storage location to load from
+            /// @param The anim file. Null if it could not be read.
 			/// @param File path
             /// @param Completion delegate
 			/// @param [Out] the output resource pointer
 			//----------------------------------------------------------------------------
-			void ReadSkinnedAnimationFromFile(Core::StorageLocation in_location, const std::string& in_filePath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const;
+			void ReadSkinnedAnimationFromFile(const Core::MemoryMappedFileCSPtr& in_file, const std::string& in_filePath, const Core::ResourceProvider::AsyncLoadDelegate& in_delegate, const SkinnedAnimationSPtr& out_resource) const;
 		};
 	}
 }
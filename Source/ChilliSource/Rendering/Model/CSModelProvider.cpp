@@ -29,6 +29,9 @@
 #include <ChilliSource/Rendering/Model/CSModelProvider.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/AsyncFileReader.h>
+#include <ChilliSource/Core/File/MemoryMappedFile.h>
+#include <ChilliSource/Core/File/MemoryReader.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Model/Mesh.h>
 #include <ChilliSource/Rendering/Model/MeshDescriptor.h>
@@ -86,52 +89,24 @@ namespace ChilliSource
                 s32 m_numSkeletonNodes;
                 u32 m_numJoints;
             };
-            //----------------------------------------------------------------------------
-			/// Read value in for given type
-            ///
-            /// @author Ian Copland
-            ///
-			/// @param File stream
-            ///
-			/// @return Value of type T
-			//----------------------------------------------------------------------------
-			template <typename TType> TType ReadValue(const Core::FileStreamSPtr& in_meshStream)
-			{
-				TType value;
-				in_meshStream->Read(reinterpret_cast<s8*>(&value), sizeof(TType));
-				return value;
-			}
-            //----------------------------------------------------------------------------
-			/// Read block of data in for given type
-            ///
-            /// @author Ian Copland
-            ///
-			/// @param File stream
-            /// @param Num to read
-			/// @param [Out] data
-			//----------------------------------------------------------------------------
-			template <typename TType> void ReadBlock(const Core::FileStreamSPtr& in_meshStream, u32 in_numToRead, TType* out_data)
-			{
-				in_meshStream->Read(reinterpret_cast<s8*>(out_data), sizeof(TType) * in_numToRead);
-			}
             //-----------------------------------------------------------------------------
-            /// Read the vertex declaration from the mesh filestream. The declaration
+            /// Read the vertex declaration from the mesh file. The declaration
             /// is variable
             ///
             /// @author Ian Copland
             ///
-            /// @param Mesh stream
+            /// @param Mesh reader
             /// @param [Out] Mesh description
             //-----------------------------------------------------------------------------
-            void ReadVertexDeclaration(const Core::FileStreamSPtr& in_meshStream, MeshDescriptor& out_meshDesc)
+            void ReadVertexDeclaration(Core::MemoryReader& in_meshReader, MeshDescriptor& out_meshDesc)
             {
                 //build the vertex declaration from the file
-                u8 numVertexElements = ReadValue<u8>(in_meshStream);
+                u8 numVertexElements = in_meshReader.Read<u8>();
                 
                 VertexElement* vertexElements = new VertexElement[numVertexElements];
                 for (int i = 0; i < numVertexElements; ++i)
                 {
-                    u8 vertexAttrib = ReadValue<u8>(in_meshStream);
+                    u8 vertexAttrib = in_meshReader.Read<u8>();
                     
                     switch (VertexAttribute(vertexAttrib))
                     {
@@ -173,11 +148,11 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param Mesh reader
 			/// @param Mesh description
             /// @param [Out] Submesh description
             //-----------------------------------------------------------------------------
-            void ReadSubMeshData(const Core::FileStreamSPtr& in_meshStream, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
+            void ReadSubMeshData(Core::MemoryReader& in_meshReader, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
             {
                 //read the inverse bind matrices
                 if(true == in_meshDesc.mFeatures.mbHasAnimationData)
@@ -185,35 +160,31 @@ namespace ChilliSource
                     for(u32 i=0; i<in_meshDesc.m_skeletonDesc.m_jointIndices.size(); ++i)
                     {
                         CSCore::Matrix4 IBPMat;
-                        ReadBlock<f32>(in_meshStream, 16, IBPMat.m);
+                        in_meshReader.Read(reinterpret_cast<u8*>(IBPMat.m), sizeof(f32) * 16);
                         out_subMeshDesc.mInverseBindPoseMatrices.push_back(IBPMat);
                     }
                 }
                 
-                //read the vertex data
-                out_subMeshDesc.mpVertexData = new u8[in_meshDesc.mVertexDeclaration.GetTotalSize() * out_subMeshDesc.mudwNumVertices];
-                in_meshStream->Read((s8*)out_subMeshDesc.mpVertexData, in_meshDesc.mVertexDeclaration.GetTotalSize() * out_subMeshDesc.mudwNumVertices);
-                
-                //read the index data
-                out_subMeshDesc.mpIndexData = new u8[in_meshDesc.mudwIndexSize * out_subMeshDesc.mudwNumIndices];
-                in_meshStream->Read((s8*)out_subMeshDesc.mpIndexData, in_meshDesc.mudwIndexSize * out_subMeshDesc.mudwNumIndices);
+                //the vertex and index data is used in place, the mesh descriptor keeps the file alive until the mesh is built.
+                out_subMeshDesc.mpVertexData = in_meshReader.Read(in_meshDesc.mVertexDeclaration.GetTotalSize() * out_subMeshDesc.mudwNumVertices);
+                out_subMeshDesc.mpIndexData = in_meshReader.Read(in_meshDesc.mudwIndexSize * out_subMeshDesc.mudwNumIndices);
             }
             //-----------------------------------------------------------------------------
 			/// Reads the sub-mesh header section of the file
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param Mesh reader
             /// @param Mesh description
 			/// @param [Out] Sube mesh description
             //-----------------------------------------------------------------------------
-            void ReadSubMeshHeader(const Core::FileStreamSPtr& in_meshStream, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
+            void ReadSubMeshHeader(Core::MemoryReader& in_meshReader, const MeshDescriptor& in_meshDesc, SubMeshDescriptor& out_subMeshDesc)
             {
                 //read mesh name
                 u8 nextChar = 0;
                 do
                 {
-                    nextChar = ReadValue<u8>(in_meshStream);
+                    nextChar = in_meshReader.Read<u8>();
                     out_subMeshDesc.mstrName += nextChar;
                     
                 } while(nextChar != 0);
@@ -221,22 +192,22 @@ namespace ChilliSource
                 //read num verts and triangles
                 if (2 == in_meshDesc.mudwIndexSize)
                 {
-                    out_subMeshDesc.mudwNumVertices = (u32)ReadValue<u16>(in_meshStream);
-                    out_subMeshDesc.mudwNumIndices = ((u32)ReadValue<u16>(in_meshStream)) * 3;
+                    out_subMeshDesc.mudwNumVertices = (u32)in_meshReader.Read<u16>();
+                    out_subMeshDesc.mudwNumIndices = ((u32)in_meshReader.Read<u16>()) * 3;
                 }
                 else
                 {
-                    out_subMeshDesc.mudwNumVertices = ReadValue<u32>(in_meshStream);
-                    out_subMeshDesc.mudwNumIndices = ReadValue<u32>(in_meshStream) * 3;
+                    out_subMeshDesc.mudwNumVertices = in_meshReader.Read<u32>();
+                    out_subMeshDesc.mudwNumIndices = in_meshReader.Read<u32>() * 3;
                 }
                 
                 //read bounds
-                out_subMeshDesc.mvMinBounds.x = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMinBounds.y = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMinBounds.z = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMaxBounds.x = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMaxBounds.y = ReadValue<f32>(in_meshStream);
-                out_subMeshDesc.mvMaxBounds.z = ReadValue<f32>(in_meshStream);
+                out_subMeshDesc.mvMinBounds.x = in_meshReader.Read<f32>();
+                out_subMeshDesc.mvMinBounds.y = in_meshReader.Read<f32>();
+                out_subMeshDesc.mvMinBounds.z = in_meshReader.Read<f32>();
+                out_subMeshDesc.mvMaxBounds.x = in_meshReader.Read<f32>();
+                out_subMeshDesc.mvMaxBounds.y = in_meshReader.Read<f32>();
+                out_subMeshDesc.mvMaxBounds.z = in_meshReader.Read<f32>();
                 
                 //TODO: Remove texture and material from mesh
                 //in the meantime just read and discard.
@@ -245,7 +216,7 @@ namespace ChilliSource
                     u8 nextCharacter = 0;
                     do
                     {
-                        nextCharacter = ReadValue<u8>(in_meshStream);
+                        nextCharacter = in_meshReader.Read<u8>();
                         
                     } while(nextCharacter != 0);
                 }
@@ -255,7 +226,7 @@ namespace ChilliSource
                     u8 nextCharacter = 0;
                     do
                     {
-                        nextCharacter = ReadValue<u8>(in_meshStream);
+                        nextCharacter = in_meshReader.Read<u8>();
                         
                     } while(nextCharacter != 0);
                 }
@@ -265,11 +236,11 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param Mesh reader
             /// @param Container holding the num of meshes, joints and bones
 			/// @param [Out] Skeleton description
             //-----------------------------------------------------------------------------
-            void ReadSkeletonData(const Core::FileStreamSPtr& in_meshStream, const MeshDataQuantities& in_quantities, SkeletonDescriptor& out_skeletonDesc)
+            void ReadSkeletonData(Core::MemoryReader& in_meshReader, const MeshDataQuantities& in_quantities, SkeletonDescriptor& out_skeletonDesc)
             {
                 //read the skeleton nodes
                 out_skeletonDesc.m_nodeNames.reserve(in_quantities.m_numSkeletonNodes);
@@ -283,19 +254,19 @@ namespace ChilliSource
                     u8 nextChar = 0;
                     do
                     {
-                        nextChar = ReadValue<u8>(in_meshStream);
+                        nextChar = in_meshReader.Read<u8>();
                         nodeName += nextChar;
                     } while(nextChar != 0);
                     
                     //get the parent index
-                    s32 parentIndex = (s32)ReadValue<s16>(in_meshStream);
+                    s32 parentIndex = (s32)in_meshReader.Read<s16>();
                     
                     //get the type
                     const u32 k_isJoint = 1;
-                    u8 type = ReadValue<u8>(in_meshStream);
+                    u8 type = in_meshReader.Read<u8>();
                     if (type == k_isJoint)
                     {
-                        u32 jointIndex = (u32)ReadValue<u8>(in_meshStream);
+                        u32 jointIndex = (u32)in_meshReader.Read<u8>();
                         jointToNodeMap.insert(std::pair<u32, s32>(jointIndex, (s32)i));
                     }
                     
@@ -315,23 +286,30 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-			/// @param File stream
+			/// @param Mesh reader
 			/// @param the file path
             /// @param [Out] Mesh description
             /// @param [Out] A struct containing info on the number of meshes, nodes and joints.
             ///
 			/// @return Whether the file is correct
             //-----------------------------------------------------------------------------
-            bool ReadGlobalHeader(const Core::FileStreamSPtr& in_meshStream, const std::string& in_filePath, MeshDescriptor& out_meshDesc, MeshDataQuantities& out_meshQuantities)
+            bool ReadGlobalHeader(Core::MemoryReader& in_meshReader, const std::string& in_filePath, MeshDescriptor& out_meshDesc, MeshDataQuantities& out_meshQuantities)
             {
-                u32 fileCheckValue = ReadValue<u32>(in_meshStream);
+                const u32 k_minHeaderSize = 8;
+                if (in_meshReader.GetRemainingSize() < k_minHeaderSize)
+                {
+                    CS_LOG_ERROR("csmodel file is too small to contain a header: " + in_filePath);
+                    return false;
+                }
+                
+                u32 fileCheckValue = in_meshReader.Read<u32>();
                 if(fileCheckValue != k_fileCheckValue)
                 {
                     CS_LOG_ERROR("csmodel file has corruption(incorrect File Check Value): " + in_filePath);
                     return false;
                 }
                 
-                u32 versionNum = ReadValue<u32>(in_meshStream);
+                u32 versionNum = in_meshReader.Read<u32>();
                 if (versionNum < k_minVersion || versionNum > k_maxVersion)
                 {
                     CS_LOG_ERROR("Unsupported csmodel version: " + in_filePath);
@@ -344,10 +322,10 @@ namespace ChilliSource
                 out_meshDesc.mFeatures.mbHasTexture = false;
                 
                 //build the feature declaration from the file
-                u32 numFeatures = (u32)ReadValue<u8>(in_meshStream);
+                u32 numFeatures = (u32)in_meshReader.Read<u8>();
                 for (u32 i=0; i<numFeatures; ++i)
                 {
-                    u32 featureType = (u32)ReadValue<u8>(in_meshStream);
+                    u32 featureType = (u32)in_meshReader.Read<u8>();
                     
                     switch (Feature(featureType))
                     {
@@ -361,29 +339,29 @@ namespace ChilliSource
                 }
                 
                 //read the vertex declaration
-                ReadVertexDeclaration(in_meshStream, out_meshDesc);
+                ReadVertexDeclaration(in_meshReader, out_meshDesc);
                 
                 //read index declaration
-                out_meshDesc.mudwIndexSize = ReadValue<u8>(in_meshStream);
+                out_meshDesc.mudwIndexSize = in_meshReader.Read<u8>();
                 
                 //read the min and max bounds
-                out_meshDesc.mvMinBounds.x = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMinBounds.y = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMinBounds.z = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMaxBounds.x = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMaxBounds.y = ReadValue<f32>(in_meshStream);
-                out_meshDesc.mvMaxBounds.z = ReadValue<f32>(in_meshStream);
+                out_meshDesc.mvMinBounds.x = in_meshReader.Read<f32>();
+                out_meshDesc.mvMinBounds.y = in_meshReader.Read<f32>();
+                out_meshDesc.mvMinBounds.z = in_meshReader.Read<f32>();
+                out_meshDesc.mvMaxBounds.x = in_meshReader.Read<f32>();
+                out_meshDesc.mvMaxBounds.y = in_meshReader.Read<f32>();
+                out_meshDesc.mvMaxBounds.z = in_meshReader.Read<f32>();
                 
                 //read the number of meshes
-                out_meshQuantities.m_numMeshes = (u32)ReadValue<u16>(in_meshStream);
+                out_meshQuantities.m_numMeshes = (u32)in_meshReader.Read<u16>();
                 out_meshQuantities.m_numSkeletonNodes = 0;
                 out_meshQuantities.m_numJoints = 0;
                 
                 //read num skeleton nodes and joints if used
                 if (true == out_meshDesc.mFeatures.mbHasAnimationData)
                 {
-                    out_meshQuantities.m_numSkeletonNodes = (s32)ReadValue<s16>(in_meshStream);
-                    out_meshQuantities.m_numJoints = (u32)ReadValue<u8>(in_meshStream);
+                    out_meshQuantities.m_numSkeletonNodes = (s32)in_meshReader.Read<s16>();
+                    out_meshQuantities.m_numJoints = (u32)in_meshReader.Read<u8>();
                 }
                 
                 return true;
@@ -393,40 +371,41 @@ namespace ChilliSource
             ///
             /// @author Ian Copland
 			///
-            /// @param The storage location to load from
+            /// @param The mesh file. Null if it could not be read.
 			/// @param File path
 			/// @param [Out] Mesh description
             ///
 			/// @return true if successful, false if not
             //----------------------------------------------------------------------------
-            bool ReadFile(Core::StorageLocation in_location, const std::string& in_filePath, MeshDescriptor& out_meshDesc)
+            bool ReadFile(const Core::MemoryMappedFileCSPtr& in_meshFile, const std::string& in_filePath, MeshDescriptor& out_meshDesc)
             {
-                Core::FileStreamSPtr meshStream = Core::Application::Get()->GetFileSystem()->CreateFileStream(in_location, in_filePath, Core::FileMode::k_readBinary);
-                
                 //Check file for corruption
-                if(nullptr == meshStream)
+                if(nullptr == in_meshFile)
                 {
                     CS_LOG_ERROR("Cannot open csmodel file: " + in_filePath);
                     return false;
                 }
                 
+                out_meshDesc.m_backingFile = in_meshFile;
+                Core::MemoryReader meshReader(in_meshFile->GetData(), in_meshFile->GetSize());
+                
                 MeshDataQuantities quantities;
-                if(ReadGlobalHeader(meshStream, in_filePath, out_meshDesc, quantities) == false)
+                if(ReadGlobalHeader(meshReader, in_filePath, out_meshDesc, quantities) == false)
                 {
                     return false;
                 }
                 
                 if (true == out_meshDesc.mFeatures.mbHasAnimationData)
                 {
-                    ReadSkeletonData(meshStream, quantities, out_meshDesc.m_skeletonDesc);
+                    ReadSkeletonData(meshReader, quantities, out_meshDesc.m_skeletonDesc);
                 }
                 
                 for(u32 i=0; i<quantities.m_numMeshes; ++i)
                 {
                     SubMeshDescriptor subMeshDesc;
                     
-                    ReadSubMeshHeader(meshStream, out_meshDesc, subMeshDesc);
-                    ReadSubMeshData(meshStream, out_meshDesc, subMeshDesc);
+                    ReadSubMeshHeader(meshReader, out_meshDesc, subMeshDesc);
+                    ReadSubMeshData(meshReader, out_meshDesc, subMeshDesc);
                     
                     out_meshDesc.mMeshes.push_back(subMeshDesc);
                 }
@@ -469,7 +448,8 @@ namespace ChilliSource
 			
             MeshDescriptor descriptor;
 			
-			if (ReadFile(in_location, in_filePath, descriptor) == false)
+            Core::MemoryMappedFileCSPtr meshFile = Core::Application::Get()->GetFileSystem()->CreateMemoryMappedFile(in_location, in_filePath);
+			if (ReadFile(meshFile, in_filePath, descriptor) == false)
 			{
                 meshResource->SetLoadState(Core::Resource::LoadState::k_failed);
 				return;
@@ -485,17 +465,22 @@ namespace ChilliSource
             
 			MeshSPtr meshResource = std::static_pointer_cast<Mesh>(out_resource);
 			
-            //Load model as task
-			auto task = std::bind(&CSModelProvider::LoadMeshDataTask, this, in_location, in_filePath, in_delegate, meshResource);
-			Core::Application::Get()->GetTaskScheduler()->ScheduleTask(task);
+            Core::AsyncFileReader* asyncFileReader = Core::Application::Get()->GetSystem<Core::AsyncFileReader>();
+            CS_ASSERT(asyncFileReader != nullptr, "CSModelProvider is missing required system: AsyncFileReader.");
+            
+            //Read the model on the IO thread, then parse it as a task once the read completes.
+            asyncFileReader->ReadFile(in_location, in_filePath, [=](const Core::AsyncFileReader::ReadResult& in_result)
+            {
+                LoadMeshDataTask(in_result.m_file, in_filePath, in_delegate, meshResource);
+            });
 		}
 		//----------------------------------------------------------------------------
 		//----------------------------------------------------------------------------
-		void CSModelProvider::LoadMeshDataTask(Core::StorageLocation in_location, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const MeshSPtr& out_resource)
+		void CSModelProvider::LoadMeshDataTask(const Core::MemoryMappedFileCSPtr& in_meshFile, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const MeshSPtr& out_resource)
 		{
 			//read the mesh data into a MoStaticDeclaration
 			MeshDescriptor descriptor;
-			if (false == ReadFile(in_location, in_filePath, descriptor))
+			if (false == ReadFile(in_meshFile, in_filePath, descriptor))
 			{
                 out_resource->SetLoadState(Core::Resource::LoadState::k_failed);
 				Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_resource));
@@ -511,12 +496,8 @@ namespace ChilliSource
 		{
 			bool success = out_resource->Build(out_meshDesc);
 
-			//cleanup
-			for (auto it = out_meshDesc.mMeshes.begin(); it != out_meshDesc.mMeshes.end(); ++it)
-			{
-				delete[] it->mpVertexData;
-				delete[] it->mpIndexData;
-			}
+			//cleanup. The vertex and index data point into the backing file, so releasing it is all that is required.
+			out_meshDesc.m_backingFile.reset();
 			
             Core::Resource::LoadState loadState = success ? Core::Resource::LoadState::k_loaded : Core::Resource::LoadState::k_failed;
             out_resource->SetLoadState(loadState);
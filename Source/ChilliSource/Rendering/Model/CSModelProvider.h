@@ -108,12 +108,13 @@ namespace ChilliSource
 			//----------------------------------------------------------------------------
 			/// @author Ian Copland
 			///
-            /// @param The storage location to load from
+            /// @param The mesh file, read by the async file reader. Null if
+            /// the read failed.
 			/// @param File path
             /// @param Delegate to callback on completion either success or failure
 			/// @param the output resource pointer
 			//----------------------------------------------------------------------------
-			void LoadMeshDataTask(Core::StorageLocation in_location, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const MeshSPtr& out_resource);
+			void LoadMeshDataTask(const Core::MemoryMappedFileCSPtr& in_meshFile, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const MeshSPtr& out_resource);
 			//----------------------------------------------------------------------------
 			/// Constructs the mesh buffer from the mesh description
 			///
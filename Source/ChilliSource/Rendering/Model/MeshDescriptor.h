@@ -63,8 +63,8 @@ namespace ChilliSource
 			u32 mudwNumIndices;
 			CSCore::Vector3 mvMinBounds;
 			CSCore::Vector3 mvMaxBounds;
-			u8* mpVertexData;
-			u8* mpIndexData;
+			const u8* mpVertexData;
+			const u8* mpIndexData;
 			std::vector<CSCore::Matrix4> mInverseBindPoseMatrices;
 			PrimitiveType ePrimitiveType;            
 		};
@@ -78,12 +78,16 @@ namespace ChilliSource
             std::vector<s32> m_jointIndices;
 		};
 		//-------------------------------------------------------------------------
-		/// Container for information required to build a mesh.
+		/// Container for information required to build a mesh. If a backing
+		/// file is provided the sub-mesh vertex and index data point directly
+		/// into it rather than being separately allocated, and the descriptor
+		/// keeps it alive until the mesh has been built.
 		//-------------------------------------------------------------------------
 		struct MeshDescriptor
 		{
 			MeshDescriptor();
 			
+            Core::MemoryMappedFileCSPtr m_backingFile;
             SkeletonDescriptor m_skeletonDesc;
 			MeshFeatureDescriptor mFeatures;
             std::vector<SubMeshDescriptor> mMeshes;
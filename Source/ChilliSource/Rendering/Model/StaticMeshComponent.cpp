@@ -62,11 +62,19 @@ namespace ChilliSource
                     (inInterfaceID == RenderComponent::InterfaceID) ||
                     (inInterfaceID == VolumeComponent::InterfaceID);
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool StaticMeshComponent::IsUpdatePhaseRequired(UpdatePhase in_phase) const
+		{
+			return false;
+		}
 		//----------------------------------------------------
 		/// Get Axis Aligned Bounding Box
 		//----------------------------------------------------
 		const Core::AABB& StaticMeshComponent::GetAABB()
 		{
+            CheckForTransformChange();
+            
 			if(GetEntity() && !m_isAABBValid)
 			{
                 m_isAABBValid = true;
@@ -150,6 +158,8 @@ namespace ChilliSource
 		//----------------------------------------------------
 		const Core::OOBB& StaticMeshComponent::GetOOBB()
 		{
+            CheckForTransformChange();
+            
 			if(GetEntity() && !m_isOOBBValid)
 			{
                 m_isOOBBValid = true;
@@ -164,6 +174,8 @@ namespace ChilliSource
 		//----------------------------------------------------
 		const Core::Sphere& StaticMeshComponent::GetBoundingSphere()
 		{
+            CheckForTransformChange();
+            
 			if(GetEntity() && !m_isBSValid)
 			{
                 m_isBSValid = true;
@@ -320,11 +332,25 @@ namespace ChilliSource
         //----------------------------------------------------
         void StaticMeshComponent::OnAddedToScene()
         {
-            m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeDelegate(this, &StaticMeshComponent::OnEntityTransformChanged));
+            m_transformChangeCount = GetEntity()->GetTransform().GetChangeCount();
             
             OnEntityTransformChanged();
         }
         //----------------------------------------------------
+        //----------------------------------------------------
+        void StaticMeshComponent::CheckForTransformChange()
+        {
+            if (GetEntity() != nullptr)
+            {
+                u32 changeCount = GetEntity()->GetTransform().GetChangeCount();
+                if (changeCount != m_transformChangeCount)
+                {
+                    m_transformChangeCount = changeCount;
+                    OnEntityTransformChanged();
+                }
+            }
+        }
+        //----------------------------------------------------
         /// On Entity Transform Changed
         //----------------------------------------------------
         void StaticMeshComponent::OnEntityTransformChanged()
@@ -333,11 +359,5 @@ namespace ChilliSource
             m_isAABBValid = false;
             m_isOOBBValid = false;
         }
-        //----------------------------------------------------
-        //----------------------------------------------------
-        void StaticMeshComponent::OnRemovedFromScene()
-        {
-            m_transformChangedConnection = nullptr;
-        }
 	}
 }
@@ -43,7 +43,7 @@ namespace ChilliSource
 		/// A static mesh component. This defines a 3D mesh that can
 		/// be manipulated, textured but not animated.
 		//===============================================================
-		class StaticMeshComponent : public RenderComponent
+		class StaticMeshComponent final : public RenderComponent
 		{
 		public:
 			CS_DECLARE_NAMEDTYPE(StaticMeshComponent);
@@ -57,6 +57,16 @@ namespace ChilliSource
 			/// @return Whether the class matches the comparison type
 			//----------------------------------------------------------
 			bool IsA(Core::InterfaceIDType inInterfaceID) const override;
+			//----------------------------------------------------------
+			/// Static meshes don't need to be updated so no phases are required.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The update phase.
+			///
+			/// @return Whether or not the phase is required.
+			//----------------------------------------------------------
+			bool IsUpdatePhaseRequired(UpdatePhase in_phase) const override;
 			//----------------------------------------------------
 			/// Get Axis Aligned Bounding Box
 			///
@@ -191,24 +201,26 @@ namespace ChilliSource
             //----------------------------------------------------
             /// On Entity Transform Changed
             ///
-            /// Delegate called when the owning entities transform
+            /// Called when the owning entities transform
             /// changes. This is used to dirty the bounding volumes
             //----------------------------------------------------
             void OnEntityTransformChanged();
             //----------------------------------------------------
-            /// Triggered when the component is removed from
-            /// an entity on the scene
+            /// Dirties the bounding volumes if the owning entity's
+            /// transform has changed since they were last checked.
+            /// The transform changed event is deferred until the
+            /// end of the frame so can't be relied on for this.
             ///
-            /// @author S Downie
+            /// @author Carlos Artesano
             //----------------------------------------------------
-            void OnRemovedFromScene() override;
+            void CheckForTransformChange();
             
 		private:
 			
 			MeshCSPtr mpModel;
 			std::vector<MaterialCSPtr> mMaterials;
             
-            Core::EventConnectionUPtr m_transformChangedConnection;
+            u32 m_transformChangeCount = 0;
             
             bool m_isBSValid;
             bool m_isAABBValid;
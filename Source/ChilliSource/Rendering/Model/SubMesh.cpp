@@ -130,7 +130,7 @@ namespace ChilliSource
 		//-----------------------------------------------------------------
 		/// Build
 		//-----------------------------------------------------------------
-		void SubMesh::Build(void* inpVertexData, void* inpIndexData, u32 inudwNumVertices, u32 indwNumIndices, Core::Vector3 invMin, Core::Vector3 invMax)
+		void SubMesh::Build(const void* inpVertexData, const void* inpIndexData, u32 inudwNumVertices, u32 indwNumIndices, Core::Vector3 invMin, Core::Vector3 invMax)
 		{
 			mpMeshBuffer->SetVertexCount(inudwNumVertices);
 			mpMeshBuffer->SetIndexCount(indwNumIndices);
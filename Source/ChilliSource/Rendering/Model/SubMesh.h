@@ -134,7 +134,7 @@ namespace ChilliSource
 			/// @param the minimum bounds.
 			/// @param the maximum bounds.
 			//-----------------------------------------------------------------
-			void Build(void* inpVertexData, void*inpIndexData, u32 inudwNumVertices, u32 indwNumIndices, Core::Vector3 invMin, Core::Vector3 invMax);
+			void Build(const void* inpVertexData, const void* inpIndexData, u32 inudwNumVertices, u32 indwNumIndices, Core::Vector3 invMin, Core::Vector3 invMax);
 			//-----------------------------------------------------------------
 			/// Set Inverse Bind Pose
 			/// 
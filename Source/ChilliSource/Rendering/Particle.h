@@ -33,8 +33,11 @@
 #include <ChilliSource/Rendering/Particle/CSParticleProvider.h>
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
 #include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleBufferPool.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffectComponent.h>
+#include <ChilliSource/Rendering/Particle/ParticleSimulation.h>
+#include <ChilliSource/Rendering/Particle/ParticleSnapshot.h>
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Affector/AccelerationParticleAffectorDef.h>
 #include <ChilliSource/Rendering/Particle/Affector/AngularAccelerationParticleAffector.h>
@@ -33,6 +33,8 @@
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/ColourOverLifetimeParticleAffectorDef.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -72,5 +74,17 @@ namespace ChilliSource
 				particle.m_colour = colourData.m_initialColour + (colourData.m_targetColour - colourData.m_initialColour) * normalisedLifeProgress;
 			}
 		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		void ColourOverLifetimeParticleAffector::CopyState(const ParticleAffector& in_affector)
+		{
+			ParticleAffector::CopyState(in_affector);
+
+			//Both affectors were created by the same def so this is safe.
+			const auto& affector = static_cast<const ColourOverLifetimeParticleAffector&>(in_affector);
+			CS_ASSERT(m_particleColourData.size() == affector.m_particleColourData.size(), "Cannot copy the state of an affector with a different number of particles.");
+
+			std::copy(affector.m_particleColourData.begin(), affector.m_particleColourData.end(), m_particleColourData.begin());
+		}
 	}
 }
\ No newline at end of file
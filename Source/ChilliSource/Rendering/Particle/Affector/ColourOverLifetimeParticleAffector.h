@@ -70,6 +70,15 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) override;
 			//----------------------------------------------------------------
+			/// Copies the initial and target colours of each particle from the given
+			/// affector.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The affector to copy the state from.
+			//----------------------------------------------------------------
+			void CopyState(const ParticleAffector& in_affector) override;
+			//----------------------------------------------------------------
 			/// Destructor
 			///
 			/// @author Ian Copland
@@ -40,6 +40,12 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
+		void ParticleAffector::CopyState(const ParticleAffector& in_affector)
+		{
+			CS_ASSERT(m_affectorDef == in_affector.m_affectorDef, "Cannot copy the state of an affector with a different affector def.");
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
 		const ParticleAffectorDef* ParticleAffector::GetAffectorDef() const
 		{
 			return m_affectorDef;
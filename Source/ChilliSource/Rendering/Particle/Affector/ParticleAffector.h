@@ -42,6 +42,12 @@ namespace ChilliSource
 		///
 		/// Particle affectors will be updated as part of a background task and 
 		/// should not be accessed from other threads.
+		///
+		/// Affectors must not change particle positions. The bounds of the
+		/// effect are calculated while particles are moved, prior to the
+		/// affectors being applied, so a particle moved by an affector could
+		/// lie outside of them and be culled incorrectly. Affectors should
+		/// instead change the velocity, which is applied in the next update.
 		//---------------------------------------------------------------------
 		class ParticleAffector
 		{
@@ -57,7 +63,8 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			ParticleAffector(const ParticleAffectorDef* in_affectorDef, Core::dynamic_array<Particle>* in_particleArray);
 			//----------------------------------------------------------------
-			/// Activates the particle with the given index.
+			/// Activates the particle with the given index. This must not
+			/// change the particle's position.
 			///
 			/// This will be called on a background thread.
 			///
@@ -69,7 +76,8 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			virtual void ActivateParticle(u32 in_index, f32 in_effectProgress) = 0;
 			//----------------------------------------------------------------
-			/// Applies the affect to each of the active particles.
+			/// Applies the affect to each of the active particles. This must
+			/// not change particle positions.
 			///
 			/// This will be called on a background thread.
 			///
@@ -81,6 +89,18 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			virtual void AffectParticles(f32 in_deltaTime, f32 in_effectProgress) = 0;
 			//----------------------------------------------------------------
+			/// Copies any per-particle state from the given affector. This is
+			/// used to start an effect from a previously simulated snapshot.
+			/// Both affectors must have been created from the same definition.
+			/// Affectors which don't store per-particle state don't need to
+			/// override this.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The affector to copy the state from.
+			//----------------------------------------------------------------
+			virtual void CopyState(const ParticleAffector& in_affector);
+			//----------------------------------------------------------------
 			/// Destructor
 			///
 			/// @author Ian Copland
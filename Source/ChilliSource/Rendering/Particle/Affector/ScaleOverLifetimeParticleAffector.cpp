@@ -33,6 +33,8 @@
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/ScaleOverLifetimeParticleAffectorDef.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -72,5 +74,17 @@ namespace ChilliSource
 				particle.m_scale = scaleData.m_initialScale + (scaleData.m_targetScale - scaleData.m_initialScale) * normalisedLifeProgress;
 			}
 		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
+		void ScaleOverLifetimeParticleAffector::CopyState(const ParticleAffector& in_affector)
+		{
+			ParticleAffector::CopyState(in_affector);
+
+			//Both affectors were created by the same def so this is safe.
+			const auto& affector = static_cast<const ScaleOverLifetimeParticleAffector&>(in_affector);
+			CS_ASSERT(m_particleScaleData.size() == affector.m_particleScaleData.size(), "Cannot copy the state of an affector with a different number of particles.");
+
+			std::copy(affector.m_particleScaleData.begin(), affector.m_particleScaleData.end(), m_particleScaleData.begin());
+		}
 	}
 }
\ No newline at end of file
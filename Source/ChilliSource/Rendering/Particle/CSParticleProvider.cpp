@@ -32,6 +32,7 @@
 #include <ChilliSource/Core/Json/JsonUtils.h>
 #include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Rendering/Material/Material.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDefFactory.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawableDefFactory.h>
@@ -118,6 +119,22 @@ namespace ChilliSource
 					out_particleEffect->SetSimulationSpace(ParseSimulationSpace(jsonValue.asString()));
 				}
 
+				//Prewarm Time
+				jsonValue = in_jsonRoot.get("PrewarmTime", Json::nullValue);
+				if (jsonValue.isNull() == false)
+				{
+					CS_ASSERT(jsonValue.isString(), "Prewarm time value must be a string.");
+					out_particleEffect->SetPrewarmTime(Core::ParseF32(jsonValue.asString()));
+				}
+
+				//Prewarm Time Step
+				jsonValue = in_jsonRoot.get("PrewarmTimeStep", Json::nullValue);
+				if (jsonValue.isNull() == false)
+				{
+					CS_ASSERT(jsonValue.isString(), "Prewarm time step value must be a string.");
+					out_particleEffect->SetPrewarmTimeStep(Core::ParseF32(jsonValue.asString()));
+				}
+
 				//Lifetime Property
 				jsonValue = in_jsonRoot.get("LifetimeProperty", Json::nullValue);
 				if (jsonValue.isNull() == false)
@@ -248,6 +265,8 @@ namespace ChilliSource
 			///
 			/// This is not thread safe and must be run on the main thread.
 			/// LoadCSParticleAsync() should be used for background loading.
+			/// The effect must be fully loaded on return, so it is prewarmed
+			/// on the calling thread rather than in a background task.
 			///
 			/// @author Ian Copland
 			///
@@ -273,6 +292,8 @@ namespace ChilliSource
 				ReadEmitterDef(jsonRoot, in_emitterDefFactory, out_particleEffect);
 				ReadAffectorDefs(jsonRoot, in_affectorDefFactory, out_particleEffect);
 
+				//a synchronous load must be complete when it returns, so the prewarm can't be moved to a background task here.
+				out_particleEffect->Prewarm();
 				out_particleEffect->SetLoadState(Core::Resource::LoadState::k_loaded);
 			}
 			//-----------------------------------------------------------------
@@ -296,6 +317,12 @@ namespace ChilliSource
 
 				in_drawableDefFactory->CreateInstanceAsync(typeJson.asString(), drawableJson, [=](ParticleDrawableDefUPtr in_drawableDef)
 				{
+					//the drawable's resources are loaded asynchronously, so aren't recorded as dependencies of the effect automatically.
+					if (in_drawableDef != nullptr && in_drawableDef->GetMaterial() != nullptr)
+					{
+						out_particleEffect->AddDependency(in_drawableDef->GetMaterial());
+					}
+					
 					out_particleEffect->SetDrawableDef(std::move(in_drawableDef));
 					in_completionDelegate();
 				});
@@ -430,8 +457,13 @@ namespace ChilliSource
 					{
 						ReadAffectorDefsAsync(jsonRoot, in_affectorDefFactory, out_particleEffect, [=]()
 						{
-							out_particleEffect->SetLoadState(Core::Resource::LoadState::k_loaded);
-							Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_particleEffect));
+							//the def completion delegates can be called on the main thread, so the prewarm is explicitly moved to a background task.
+							Core::Application::Get()->GetTaskScheduler()->ScheduleTask([=]()
+							{
+								out_particleEffect->Prewarm();
+								out_particleEffect->SetLoadState(Core::Resource::LoadState::k_loaded);
+								Core::Application::Get()->GetTaskScheduler()->ScheduleMainThreadTask(std::bind(in_delegate, out_particleEffect));
+							});
 						});
 					});
 				});
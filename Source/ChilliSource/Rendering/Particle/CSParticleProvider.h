@@ -94,6 +94,10 @@ namespace ChilliSource
 			/// given file. The resource should be checked to ensure it has
 			/// loaded after this method is called.
 			///
+			/// The effect is prewarmed before this returns, on the calling
+			/// thread. Effects with a long prewarm time should be loaded
+			/// asynchronously instead, which prewarms in a background task.
+			///
 			/// @author Ian Copland
 			///
 			/// @param The storage location of the file.
@@ -135,5 +135,18 @@ namespace ChilliSource
 			m_boundingSphere = in_boundingSphere;
 			m_updating = false;
 		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void ConcurrentParticleData::Reset()
+		{
+			std::unique_lock<std::recursive_mutex> lock(m_mutex);
+
+			m_particles.fill(Particle());
+			m_newParticleIndices.clear();
+			m_aabb = Core::AABB();
+			m_boundingSphere = Core::Sphere();
+			m_updating = false;
+			m_activeParticles = false;
+		}
 	}
 }
\ No newline at end of file
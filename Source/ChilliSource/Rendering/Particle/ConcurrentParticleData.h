@@ -168,6 +168,17 @@ namespace ChilliSource
 			/// @param The bounding sphere.
 			//-----------------------------------------------------------------
 			void CommitParticleData(const Core::dynamic_array<Rendering::Particle>* in_particles, const std::vector<u32>& in_newIndices, const Core::AABB& in_aabb, const Core::Sphere& in_boundingSphere);
+			//-----------------------------------------------------------------
+			/// Returns the data to its initial state: all particles inactive,
+			/// no new indices, empty bounds and no update in progress. This 
+			/// allows the data to be reused by another particle effect 
+			/// instance.
+			///
+			/// This is thread-safe, lock doesn't need to be called first.
+			///
+			/// @author Carlos Artesano
+			//-----------------------------------------------------------------
+			void Reset();
 		private:
 
 			Core::dynamic_array<ConcurrentParticleData::Particle> m_particles;
@@ -48,6 +48,8 @@
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
+#include <cmath>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -88,63 +90,60 @@ namespace ChilliSource
 				}
 			}
 			//-----------------------------------------------------------------------------
-			/// Builds world space sprite data for a particle from the given parameters.
+			/// Writes the world space vertices for a single billboard directly into the
+			/// given vertex buffer. Rather than building an orientation quaternion per
+			/// particle, the camera facing is described by the camera's world space right
+			/// and up vectors which are then rotated in the billboard plane by the particle
+			/// rotation.
 			///
 			/// @author Ian Copland
 			///
-			/// @param The material.
 			/// @param The uvs.
-			/// @param The local bottom left vertex position of the sprite.
-			/// @param The local top right vertex position of the sprite.
-			/// @param The world position of the sprite.
-			/// @param The world scale of the sprite.
-			/// @param The world orientation of the sprite.
-			/// @param The colour of the sprite.
-			///
-			/// @param The sprite data.
+			/// @param The local bottom left vertex position of the billboard.
+			/// @param The local top right vertex position of the billboard.
+			/// @param The world position of the billboard.
+			/// @param The world scale of the billboard.
+			/// @param The rotation of the billboard in the camera plane.
+			/// @param The colour of the billboard.
+			/// @param The camera world space right vector.
+			/// @param The camera world space up vector.
+			/// @param [Out] The vertex buffer to write to. This must have room for
+			/// k_numSpriteVerts vertices.
 			//-----------------------------------------------------------------------------
-			SpriteBatch::SpriteData BuildSpriteData(const MaterialCSPtr& in_material, const UVs& in_uvs, const Core::Vector2& in_localBL,
-				const Core::Vector2& in_localTR, const Core::Vector3& in_worldPosition, const Core::Vector2& in_worldScale, const Core::Quaternion& in_worldOrientation,
-				const Core::Colour& in_colour)
+			void WriteBillboardVertices(const UVs& in_uvs, const Core::Vector2& in_localBL, const Core::Vector2& in_localTR, const Core::Vector3& in_worldPosition, const Core::Vector2& in_worldScale,
+				f32 in_rotation, const Core::Colour& in_colour, const Core::Vector3& in_cameraRight, const Core::Vector3& in_cameraUp, SpriteBatch::SpriteVertex* out_vertices)
 			{
-				SpriteBatch::SpriteData spriteData;
-				spriteData.pMaterial = in_material;
-
-				//set the sprite colour
-				Core::ByteColour colour = Core::ColourUtils::ColourToByteColour(in_colour);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].Col = colour;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].Col = colour;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].Col = colour;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].Col = colour;
-
-				//set the UVs.
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vTex.x = in_uvs.m_u;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vTex.y = in_uvs.m_v;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vTex.x = in_uvs.m_u;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vTex.y = in_uvs.m_v + in_uvs.m_t;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vTex.x = in_uvs.m_u + in_uvs.m_s;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vTex.y = in_uvs.m_v;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vTex.x = in_uvs.m_u + in_uvs.m_s;
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vTex.y = in_uvs.m_v + in_uvs.m_t;
-
-				//Build the vertex data.
-				Core::Vector3 localTopLeft(in_localBL.x * in_worldScale.x, in_localTR.y * in_worldScale.y, 0.0f);
-				Core::Vector3 worldTopLeft = in_worldPosition + Core::Vector3::Rotate(localTopLeft, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topLeft].vPos = Core::Vector4(worldTopLeft, 1.0f);
-
-				Core::Vector3 localTopRight(in_localTR.x * in_worldScale.x, in_localTR.y * in_worldScale.y, 0.0f);
-				Core::Vector3 worldTopRight = in_worldPosition + Core::Vector3::Rotate(localTopRight, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_topRight].vPos = Core::Vector4(worldTopRight, 1.0f);
-
-				Core::Vector3 localBottomLeft(in_localBL.x * in_worldScale.x, in_localBL.y * in_worldScale.y, 0.0f);
-				Core::Vector3 worldBottomLeft = in_worldPosition + Core::Vector3::Rotate(localBottomLeft, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomLeft].vPos = Core::Vector4(worldBottomLeft, 1.0f);
-
-				Core::Vector3 localBottomRight(in_localTR.x * in_worldScale.x, in_localBL.y * in_worldScale.y, 0.0f);
-				Core::Vector3 worldBottomRight = in_worldPosition + Core::Vector3::Rotate(localBottomRight, in_worldOrientation);
-				spriteData.sVerts[(u32)SpriteBatch::Verts::k_bottomRight].vPos = Core::Vector4(worldBottomRight, 1.0f);
-
-				return spriteData;
+				const f32 cosRotation = std::cos(in_rotation);
+				const f32 sinRotation = std::sin(in_rotation);
+				const Core::Vector3 right = in_cameraRight * cosRotation + in_cameraUp * sinRotation;
+				const Core::Vector3 up = in_cameraUp * cosRotation - in_cameraRight * sinRotation;
+
+				const Core::Vector3 left = right * (in_localBL.x * in_worldScale.x);
+				const Core::Vector3 rightEdge = right * (in_localTR.x * in_worldScale.x);
+				const Core::Vector3 bottom = up * (in_localBL.y * in_worldScale.y);
+				const Core::Vector3 top = up * (in_localTR.y * in_worldScale.y);
+
+				const Core::ByteColour colour = Core::ColourUtils::ColourToByteColour(in_colour);
+
+				SpriteBatch::SpriteVertex& topLeft = out_vertices[(u32)SpriteBatch::Verts::k_topLeft];
+				topLeft.vPos = Core::Vector4(in_worldPosition + left + top, 1.0f);
+				topLeft.vTex = Core::Vector2(in_uvs.m_u, in_uvs.m_v);
+				topLeft.Col = colour;
+
+				SpriteBatch::SpriteVertex& bottomLeft = out_vertices[(u32)SpriteBatch::Verts::k_bottomLeft];
+				bottomLeft.vPos = Core::Vector4(in_worldPosition + left + bottom, 1.0f);
+				bottomLeft.vTex = Core::Vector2(in_uvs.m_u, in_uvs.m_v + in_uvs.m_t);
+				bottomLeft.Col = colour;
+
+				SpriteBatch::SpriteVertex& topRight = out_vertices[(u32)SpriteBatch::Verts::k_topRight];
+				topRight.vPos = Core::Vector4(in_worldPosition + rightEdge + top, 1.0f);
+				topRight.vTex = Core::Vector2(in_uvs.m_u + in_uvs.m_s, in_uvs.m_v);
+				topRight.Col = colour;
+
+				SpriteBatch::SpriteVertex& bottomRight = out_vertices[(u32)SpriteBatch::Verts::k_bottomRight];
+				bottomRight.vPos = Core::Vector4(in_worldPosition + rightEdge + bottom, 1.0f);
+				bottomRight.vTex = Core::Vector2(in_uvs.m_u + in_uvs.m_s, in_uvs.m_v + in_uvs.m_t);
+				bottomRight.Col = colour;
 			}
 		}
 
@@ -152,7 +151,7 @@ namespace ChilliSource
 		//----------------------------------------------
 		StaticBillboardParticleDrawable::StaticBillboardParticleDrawable(const Core::Entity* in_entity, const ParticleDrawableDef* in_drawableDef, ConcurrentParticleData* in_concurrentParticleData)
 			: ParticleDrawable(in_entity, in_drawableDef, in_concurrentParticleData), m_billboardDrawableDef(static_cast<const StaticBillboardParticleDrawableDef*>(in_drawableDef)),
-			m_particleBillboardIndices(in_drawableDef->GetParticleEffect()->GetMaxParticles())
+			m_particleBillboardIndices(in_drawableDef->GetParticleEffect()->GetMaxParticles()), m_vertices(in_drawableDef->GetParticleEffect()->GetMaxParticles() * k_numSpriteVerts)
 		{
 			BuildBillboardImageData();
 		}
@@ -252,7 +251,7 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void StaticBillboardParticleDrawable::DrawLocalSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const
+		void StaticBillboardParticleDrawable::DrawLocalSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera)
 		{
 			const auto& material = m_billboardDrawableDef->GetMaterial();
 			auto entityWorldTransform = GetEntity()->GetTransform().GetWorldTransform();
@@ -265,7 +264,10 @@ namespace ChilliSource
 
 			//billboard by applying the inverse of the view orientation. The view orientation is the inverse of the camera entity orientation.
 			auto inverseView = in_camera->GetEntity()->GetTransform().GetWorldOrientation();
+			auto cameraRight = Core::Vector3::Rotate(Core::Vector3::k_unitPositiveX, inverseView);
+			auto cameraUp = Core::Vector3::Rotate(Core::Vector3::k_unitPositiveY, inverseView);
 
+			u32 numSprites = 0;
 			for (u32 i = 0; i < in_particleData.size(); ++i)
 			{
 				const auto& particle = in_particleData[i];
@@ -275,42 +277,45 @@ namespace ChilliSource
 					auto worldPosition = particle.m_position * entityWorldTransform;
 					auto worldScale = particle.m_scale * particleScaleFactor;
 
-					//rotate locally in the XY plane before rotating to face the camera.
-					auto worldOrientation = Core::Quaternion(Core::Vector3::k_unitPositiveZ, particle.m_rotation) * inverseView;
-
 					const auto& billboardData = m_billboards->at(m_particleBillboardIndices[i]);
-					auto spriteData = BuildSpriteData(material, billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, worldPosition, worldScale, worldOrientation,
-						particle.m_colour);
-
-					Core::Application::Get()->GetRenderSystem()->GetDynamicSpriteBatchPtr()->Render(spriteData, nullptr);
+					WriteBillboardVertices(billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, worldPosition, worldScale, particle.m_rotation, particle.m_colour, cameraRight, cameraUp, &m_vertices[numSprites * k_numSpriteVerts]);
+					++numSprites;
 				}
 			}
+
+			if (numSprites > 0)
+			{
+				Core::Application::Get()->GetRenderSystem()->GetDynamicSpriteBatchPtr()->Render(material, m_vertices.data(), numSprites);
+			}
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
-		void StaticBillboardParticleDrawable::DrawWorldSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const
+		void StaticBillboardParticleDrawable::DrawWorldSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera)
 		{
 			const auto& material = m_billboardDrawableDef->GetMaterial();
 
 			//billboard by applying the inverse of the view orientation. The view orientation is the inverse of the camera entity orientation.
 			auto inverseView = in_camera->GetEntity()->GetTransform().GetWorldOrientation();
+			auto cameraRight = Core::Vector3::Rotate(Core::Vector3::k_unitPositiveX, inverseView);
+			auto cameraUp = Core::Vector3::Rotate(Core::Vector3::k_unitPositiveY, inverseView);
 
+			u32 numSprites = 0;
 			for (u32 i = 0; i < in_particleData.size(); ++i)
 			{
 				const auto& particle = in_particleData[i];
 
 				if (particle.m_isActive == true && particle.m_colour != Core::Colour::k_transparent)
 				{
-					//rotate locally in the XY plane before rotating to face the camera.
-					auto worldOrientation = Core::Quaternion(Core::Vector3::k_unitPositiveZ, particle.m_rotation) * inverseView;
-
 					const auto& billboardData = m_billboards->at(m_particleBillboardIndices[i]);
-					auto spriteData = BuildSpriteData(material, billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, particle.m_position, particle.m_scale,
-						worldOrientation, particle.m_colour);
-
-					Core::Application::Get()->GetRenderSystem()->GetDynamicSpriteBatchPtr()->Render(spriteData, nullptr);
+					WriteBillboardVertices(billboardData.m_uvs, billboardData.m_bottomLeft, billboardData.m_topRight, particle.m_position, particle.m_scale, particle.m_rotation, particle.m_colour, cameraRight, cameraUp, &m_vertices[numSprites * k_numSpriteVerts]);
+					++numSprites;
 				}
 			}
+
+			if (numSprites > 0)
+			{
+				Core::Application::Get()->GetRenderSystem()->GetDynamicSpriteBatchPtr()->Render(material, m_vertices.data(), numSprites);
+			}
 		}
 	}
 }
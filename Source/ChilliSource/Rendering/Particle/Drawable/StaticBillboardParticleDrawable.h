@@ -33,6 +33,7 @@
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawable.h>
+#include <ChilliSource/Rendering/Sprite/SpriteBatch.h>
 #include <ChilliSource/Rendering/Texture/TextureAtlas.h>
 
 namespace ChilliSource
@@ -105,30 +106,35 @@ namespace ChilliSource
 			void PrepareParticleBillboardIndices();
 			//----------------------------------------------------------------
 			/// Draws the particles taking into account the world space
-			/// transform of the owning entity.
+			/// transform of the owning entity. The vertices for all visible
+			/// particles are written into a single buffer and submitted
+			/// to the sprite batcher in one go.
 			///
 			/// @author Ian Copland
 			///
 			/// @param The particle draw data.
 			/// @param The camera component used to render.
 			//----------------------------------------------------------------
-			void DrawLocalSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const;
+			void DrawLocalSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera);
 			//----------------------------------------------------------------
 			/// Draws the particles without taking into account the world
 			/// space transform of the owning entity as the particles are
-			/// already in world space.
+			/// already in world space. The vertices for all visible particles
+			/// are written into a single buffer and submitted to the sprite
+			/// batcher in one go.
 			///
 			/// @author Ian Copland
 			///
 			/// @param The particle draw data.
 			/// @param The camera component used to render.
 			//----------------------------------------------------------------
-			void DrawWorldSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera) const;
+			void DrawWorldSpace(const Core::dynamic_array<ConcurrentParticleData::Particle>& in_particleData, const CameraComponent* in_camera);
 
 			const StaticBillboardParticleDrawableDef* m_billboardDrawableDef;
 			std::unique_ptr <Core::dynamic_array<BillboardData>> m_billboards;
 			Core::dynamic_array<u32> m_particleBillboardIndices;
 			u32 m_nextBillboardIndex = 0;
+			Core::dynamic_array<SpriteBatch::SpriteVertex> m_vertices;
 		};
 	}
 }
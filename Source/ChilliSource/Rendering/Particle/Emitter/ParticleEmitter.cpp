@@ -86,6 +86,30 @@ namespace ChilliSource
 		}
 		//----------------------------------------------
 		//----------------------------------------------
+		void ParticleEmitter::CopyState(const ParticleEmitter& in_emitter)
+		{
+			CS_ASSERT(m_emitterDef == in_emitter.m_emitterDef, "Cannot copy the state of an emitter with a different emitter def.");
+
+			m_emissionPosition = in_emitter.m_emissionPosition;
+			m_emissionScale = in_emitter.m_emissionScale;
+			m_emissionOrientation = in_emitter.m_emissionOrientation;
+			m_emissionTime = in_emitter.m_emissionTime;
+			m_hasEmitted = in_emitter.m_hasEmitted;
+			m_nextParticleIndex = in_emitter.m_nextParticleIndex;
+		}
+		//----------------------------------------------
+		//----------------------------------------------
+		void ParticleEmitter::Reset()
+		{
+			m_emissionPosition = Core::Vector3::k_zero;
+			m_emissionScale = Core::Vector3::k_zero;
+			m_emissionOrientation = Core::Quaternion::k_identity;
+			m_emissionTime = 0.0f;
+			m_hasEmitted = false;
+			m_nextParticleIndex = 0;
+		}
+		//----------------------------------------------
+		//----------------------------------------------
 		const ParticleEmitterDef* ParticleEmitter::GetEmitterDef() const
 		{
 			return m_emitterDef;
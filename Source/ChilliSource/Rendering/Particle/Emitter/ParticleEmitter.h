@@ -80,6 +80,23 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			std::vector<u32> TryEmit(f32 in_playbackTime, const Core::Vector3& in_emitterPosition, const Core::Vector3& in_emitterScale, const Core::Quaternion& in_emitterOrientation, bool in_interpolateEmission);
 			//----------------------------------------------------------------
+			/// Copies the emission state from the given emitter. This is used
+			/// to start an effect from a previously simulated snapshot. Both
+			/// emitters must have been created from the same definition.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The emitter to copy the state from.
+			//----------------------------------------------------------------
+			void CopyState(const ParticleEmitter& in_emitter);
+			//----------------------------------------------------------------
+			/// Returns the emission state to how it was when the emitter was
+			/// created, allowing it to be reused.
+			///
+			/// @author Carlos Artesano
+			//----------------------------------------------------------------
+			void Reset();
+			//----------------------------------------------------------------
 			/// Destructor.
 			///
 			/// @author Ian Copland
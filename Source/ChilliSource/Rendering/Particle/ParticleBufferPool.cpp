@@ -0,0 +1,171 @@
+//
+//  ParticleBufferPool.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleBufferPool.h>
+
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
+#include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
+#include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
+#include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		ParticleBufferPool::Buffers::Buffers(const ParticleEffect* in_particleEffect)
+			: m_particles(in_particleEffect->GetMaxParticles()), m_concurrentParticleData(in_particleEffect->GetMaxParticles())
+		{
+			m_emitter = in_particleEffect->GetEmitterDef()->CreateInstance(&m_particles);
+			CS_ASSERT(m_emitter != nullptr, "Failed to create particle emitter.");
+
+			for (const auto& affectorDef : in_particleEffect->GetAffectorDefs())
+			{
+				ParticleAffectorUPtr affector = affectorDef->CreateInstance(&m_particles);
+				CS_ASSERT(affector != nullptr, "Failed to create particle affector.");
+
+				m_affectors.push_back(std::move(affector));
+			}
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		ParticleBufferPool::Buffers::~Buffers()
+		{
+			m_affectors.clear();
+			m_emitter.reset();
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		ParticleBufferPool::ParticleBufferPool(const ParticleEffect* in_particleEffect)
+			: m_particleEffect(in_particleEffect)
+		{
+			CS_ASSERT(m_particleEffect != nullptr, "Cannot create a particle buffer pool with a null particle effect.");
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		ParticleBufferPool::BuffersSPtr ParticleBufferPool::Acquire()
+		{
+			CS_ASSERT(m_particleEffect->GetEmitterDef() != nullptr, "Cannot acquire buffers for an incomplete particle effect.");
+
+			std::unique_ptr<Buffers> buffers;
+			u32 generation = 0;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+
+				generation = m_generation;
+				++m_numAcquired;
+				++m_numInUse;
+
+				if (m_freeBuffers.empty() == false)
+				{
+					buffers = std::move(m_freeBuffers.back());
+					m_freeBuffers.pop_back();
+				}
+				else
+				{
+					++m_numCreated;
+				}
+			}
+
+			if (buffers == nullptr)
+			{
+				buffers.reset(new Buffers(m_particleEffect));
+				buffers->m_generation = generation;
+			}
+
+			//the deleter only holds a weak reference so that outstanding buffers don't keep the pool alive.
+			std::weak_ptr<ParticleBufferPool> weakPool = shared_from_this();
+			return BuffersSPtr(buffers.release(), [weakPool](Buffers* in_buffers)
+			{
+				auto pool = weakPool.lock();
+				if (pool != nullptr)
+				{
+					pool->Release(in_buffers);
+				}
+				else
+				{
+					delete in_buffers;
+				}
+			});
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		ParticleBufferPool::Stats ParticleBufferPool::GetStats() const
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+
+			Stats stats;
+			stats.m_numInUse = m_numInUse;
+			stats.m_numFree = static_cast<u32>(m_freeBuffers.size());
+			stats.m_numAcquired = m_numAcquired;
+			stats.m_numCreated = m_numCreated;
+			return stats;
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void ParticleBufferPool::Clear()
+		{
+			std::vector<std::unique_ptr<Buffers>> freeBuffers;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				freeBuffers.swap(m_freeBuffers);
+				++m_generation;
+			}
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		ParticleBufferPool::~ParticleBufferPool()
+		{
+			m_freeBuffers.clear();
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		void ParticleBufferPool::Release(Buffers* in_buffers)
+		{
+			std::unique_ptr<Buffers> buffers(in_buffers);
+
+			//all references have been released so nothing else can be accessing the buffers.
+			buffers->m_particles.fill(Particle());
+			buffers->m_concurrentParticleData.Reset();
+			buffers->m_emitter->Reset();
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+
+			CS_ASSERT(m_numInUse > 0, "Released more particle buffers than were acquired.");
+			--m_numInUse;
+
+			//buffers acquired prior to the pool being cleared may be out of date, so are destroyed.
+			if (buffers->m_generation == m_generation)
+			{
+				m_freeBuffers.push_back(std::move(buffers));
+			}
+		}
+	}
+}
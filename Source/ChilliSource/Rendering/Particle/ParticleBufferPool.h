@@ -0,0 +1,176 @@
+//
+//  ParticleBufferPool.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEBUFFERPOOL_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLEBUFFERPOOL_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/dynamic_array.h>
+#include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
+#include <ChilliSource/Rendering/Particle/Particle.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//------------------------------------------------------------------------
+		/// A pool of the runtime buffers needed to simulate a single instance of
+		/// a particle effect: the particle array, the concurrent particle data,
+		/// the emitter and the affectors. Each Particle Effect owns a pool, so
+		/// buffers are effectively keyed by effect, and Particle Effect 
+		/// Components acquire their buffers from it rather than allocating new
+		/// ones. This avoids churning the allocator when short-lived effects 
+		/// are frequently spawned.
+		///
+		/// Acquired buffers are returned to the pool automatically when the 
+		/// last reference to them is released, which may be on a background 
+		/// thread if an update task is still in flight. If the pool has been 
+		/// destroyed by then the buffers are simply deleted.
+		///
+		/// This is thread-safe.
+		///
+		/// @author Carlos Artesano
+		//------------------------------------------------------------------------
+		class ParticleBufferPool final : public std::enable_shared_from_this<ParticleBufferPool>
+		{
+		public:
+			CS_DECLARE_NOCOPY(ParticleBufferPool);
+			//-----------------------------------------------------------------
+			/// The buffers required to simulate a single particle effect 
+			/// instance.
+			///
+			/// @author Carlos Artesano
+			//-----------------------------------------------------------------
+			struct Buffers final
+			{
+				CS_DECLARE_NOCOPY(Buffers);
+				//-------------------------------------------------------------
+				/// Constructor. Creates buffers for the given particle effect.
+				///
+				/// @author Carlos Artesano
+				///
+				/// @param The particle effect.
+				//-------------------------------------------------------------
+				Buffers(const ParticleEffect* in_particleEffect);
+				//-------------------------------------------------------------
+				/// Destructor
+				///
+				/// @author Carlos Artesano
+				//-------------------------------------------------------------
+				~Buffers();
+
+				Core::dynamic_array<Particle> m_particles;
+				ConcurrentParticleData m_concurrentParticleData;
+				ParticleEmitterUPtr m_emitter;
+				std::vector<ParticleAffectorUPtr> m_affectors;
+				u32 m_generation = 0;
+			};
+			using BuffersSPtr = std::shared_ptr<Buffers>;
+			//-----------------------------------------------------------------
+			/// Statistics describing the occupancy of the pool.
+			///
+			/// @author Carlos Artesano
+			//-----------------------------------------------------------------
+			struct Stats final
+			{
+				u32 m_numInUse = 0;
+				u32 m_numFree = 0;
+				u32 m_numAcquired = 0;
+				u32 m_numCreated = 0;
+			};
+			//-----------------------------------------------------------------
+			/// Constructor.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The particle effect the buffers are for. This must out
+			/// live the pool.
+			//-----------------------------------------------------------------
+			ParticleBufferPool(const ParticleEffect* in_particleEffect);
+			//-----------------------------------------------------------------
+			/// Acquires a set of buffers from the pool, creating new ones if
+			/// there are none free. The returned buffers are in their initial
+			/// state: all particles are inactive and the emitter is reset. The
+			/// particle effect must be complete prior to calling this.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @return The buffers. These are returned to the pool when the
+			/// last reference is released.
+			//-----------------------------------------------------------------
+			BuffersSPtr Acquire();
+			//-----------------------------------------------------------------
+			/// @author Carlos Artesano
+			///
+			/// @return The current occupancy statistics of the pool.
+			//-----------------------------------------------------------------
+			Stats GetStats() const;
+			//-----------------------------------------------------------------
+			/// Destroys all buffers which are not currently in use. Buffers 
+			/// that are in use are unaffected until they are released, at
+			/// which point they are destroyed rather than returned to the
+			/// pool. The particle effect calls this whenever a change would
+			/// leave the existing buffers out of date.
+			///
+			/// @author Carlos Artesano
+			//-----------------------------------------------------------------
+			void Clear();
+			//-----------------------------------------------------------------
+			/// Destructor
+			///
+			/// @author Carlos Artesano
+			//-----------------------------------------------------------------
+			~ParticleBufferPool();
+
+		private:
+			//-----------------------------------------------------------------
+			/// Resets the given buffers and returns them to the free list.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The buffers.
+			//-----------------------------------------------------------------
+			void Release(Buffers* in_buffers);
+
+			const ParticleEffect* m_particleEffect = nullptr;
+
+			mutable std::mutex m_mutex;
+			std::vector<std::unique_ptr<Buffers>> m_freeBuffers;
+			u32 m_numInUse = 0;
+			u32 m_numAcquired = 0;
+			u32 m_numCreated = 0;
+			u32 m_generation = 0;
+		};
+	}
+}
+
+#endif
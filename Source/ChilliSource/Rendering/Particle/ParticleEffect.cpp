@@ -28,6 +28,10 @@
 
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 
+#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Rendering/Particle/ParticleBufferPool.h>
+#include <ChilliSource/Rendering/Particle/ParticleSnapshot.h>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -42,6 +46,7 @@ namespace ChilliSource
 		//-------------------------------------------------------
 		//-------------------------------------------------------
 		ParticleEffect::ParticleEffect()
+			: m_bufferPool(std::make_shared<ParticleBufferPool>(this))
 		{
 		}
 		//-------------------------------------------------------
@@ -131,6 +136,30 @@ namespace ChilliSource
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
+		f32 ParticleEffect::GetPrewarmTime() const
+		{
+			return m_prewarmTime;
+		}
+		//-------------------------------------------------------
+		//-------------------------------------------------------
+		f32 ParticleEffect::GetPrewarmTimeStep() const
+		{
+			return m_prewarmTimeStep;
+		}
+		//-------------------------------------------------------
+		//-------------------------------------------------------
+		const ParticleSnapshot* ParticleEffect::GetPrewarmSnapshot() const
+		{
+			return m_prewarmSnapshot.get();
+		}
+		//-------------------------------------------------------
+		//-------------------------------------------------------
+		ParticleBufferPool* ParticleEffect::GetBufferPool() const
+		{
+			return m_bufferPool.get();
+		}
+		//-------------------------------------------------------
+		//-------------------------------------------------------
 		void ParticleEffect::SetDuration(f32 in_duration)
 		{
 			m_duration = in_duration;
@@ -140,6 +169,7 @@ namespace ChilliSource
 		void ParticleEffect::SetMaxParticles(u32 in_maxParticles)
 		{
 			m_maxParticles = in_maxParticles;
+			m_bufferPool->Clear();
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
@@ -200,6 +230,7 @@ namespace ChilliSource
 
 			m_emitterDef = std::move(in_emitterDef);
 			m_emitterDef->SetParticleEffect(this);
+			m_bufferPool->Clear();
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
@@ -212,11 +243,42 @@ namespace ChilliSource
 			{
 				affectorDef->SetParticleEffect(this);
 			}
+			m_bufferPool->Clear();
+		}
+		//-------------------------------------------------------
+		//-------------------------------------------------------
+		void ParticleEffect::SetPrewarmTime(f32 in_prewarmTime)
+		{
+			CS_ASSERT(in_prewarmTime >= 0.0f, "Prewarm time cannot be negative.");
+
+			m_prewarmTime = in_prewarmTime;
+		}
+		//-------------------------------------------------------
+		//-------------------------------------------------------
+		void ParticleEffect::SetPrewarmTimeStep(f32 in_prewarmTimeStep)
+		{
+			CS_ASSERT(in_prewarmTimeStep > 0.0f, "Prewarm time step must be greater than zero.");
+
+			m_prewarmTimeStep = in_prewarmTimeStep;
+		}
+		//-------------------------------------------------------
+		//-------------------------------------------------------
+		void ParticleEffect::Prewarm()
+		{
+			m_prewarmSnapshot.reset();
+
+			if (m_prewarmTime > 0.0f)
+			{
+				m_prewarmSnapshot = ParticleSnapshot::Create(this, m_prewarmTime, m_prewarmTimeStep, Core::Random::GenerateSeed());
+			}
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
 		ParticleEffect::~ParticleEffect()
 		{
+			m_bufferPool.reset();
+			m_prewarmSnapshot.reset();
+
 			m_lifetimeProperty.reset();
 			m_initialScaleProperty.reset();
 			m_initialRotationProperty.reset();
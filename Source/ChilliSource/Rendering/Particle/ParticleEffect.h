@@ -164,6 +164,39 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			std::vector<const ParticleAffectorDef*> GetAffectorDefs() const;
 			//----------------------------------------------------------------
+			/// @author Carlos Artesano
+			///
+			/// @return The amount of time the effect should be simulated for
+			/// prior to playback. If zero, the effect is not prewarmed.
+			//----------------------------------------------------------------
+			f32 GetPrewarmTime() const;
+			//----------------------------------------------------------------
+			/// @author Carlos Artesano
+			///
+			/// @return The time step used when prewarming the effect.
+			//----------------------------------------------------------------
+			f32 GetPrewarmTimeStep() const;
+			//----------------------------------------------------------------
+			/// @author Carlos Artesano
+			///
+			/// @return The snapshot of the prewarmed effect. Particle Effect
+			/// Components will start playback from this snapshot unless 
+			/// another is provided. Will be null if the effect has not been
+			/// prewarmed.
+			//----------------------------------------------------------------
+			const ParticleSnapshot* GetPrewarmSnapshot() const;
+			//----------------------------------------------------------------
+			/// Particle Effect Components acquire the buffers they need to
+			/// simulate the effect from this pool, recycling them between 
+			/// instances. The pool is thread-safe so can be used even though
+			/// the effect is immutable while in use.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @return The pool of runtime buffers for this effect.
+			//----------------------------------------------------------------
+			ParticleBufferPool* GetBufferPool() const;
+			//----------------------------------------------------------------
 			/// Sets the duration of the particle effect. 
 			///
 			/// @author Ian Copland
@@ -267,6 +300,35 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void SetAffectorDefs(std::vector<ParticleAffectorDefUPtr> in_affectorDefs);
 			//----------------------------------------------------------------
+			/// Sets the amount of time the effect should be simulated for 
+			/// prior to playback. This only describes the prewarm; the 
+			/// simulation itself is performed by Prewarm().
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The prewarm time.
+			//----------------------------------------------------------------
+			void SetPrewarmTime(f32 in_prewarmTime);
+			//----------------------------------------------------------------
+			/// Sets the time step used when prewarming the effect. Larger
+			/// steps are faster but less accurate.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The prewarm time step.
+			//----------------------------------------------------------------
+			void SetPrewarmTimeStep(f32 in_prewarmTimeStep);
+			//----------------------------------------------------------------
+			/// Simulates the effect for the prewarm time and stores the
+			/// resulting snapshot. This should be called once the effect is
+			/// complete and, as the simulation can be expensive, should 
+			/// typically be called on a background thread during loading. If
+			/// the prewarm time is zero any existing snapshot is cleared.
+			///
+			/// @author Carlos Artesano
+			//----------------------------------------------------------------
+			void Prewarm();
+			//----------------------------------------------------------------
 			/// Destructor
 			///
 			/// @author Ian Copland
@@ -291,6 +353,8 @@ namespace ChilliSource
 			f32 m_duration = 1.0f;
 			u32 m_maxParticles = 100;
 			SimulationSpace m_simulationSpace = SimulationSpace::k_local;
+			f32 m_prewarmTime = 0.0f;
+			f32 m_prewarmTimeStep = 0.1f;
 
 			ParticlePropertyUPtr<f32> m_lifetimeProperty;
 			ParticlePropertyUPtr<Core::Vector2> m_initialScaleProperty = ParticlePropertyUPtr<Core::Vector2>(new ConstantParticleProperty<Core::Vector2>(Core::Vector2::k_one));
@@ -302,6 +366,9 @@ namespace ChilliSource
 			ParticleDrawableDefUPtr m_drawableDef;
 			ParticleEmitterDefUPtr m_emitterDef;
 			std::vector<ParticleAffectorDefUPtr> m_affectorDefs;
+
+			ParticleSnapshotUPtr m_prewarmSnapshot;
+			ParticleBufferPoolSPtr m_bufferPool;
 		};
 	}
 }
@@ -32,12 +32,16 @@
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Math/Random.h>
 #include <ChilliSource/Core/State/State.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 #include <ChilliSource/Rendering/Camera/PerspectiveCameraComponent.h>
 #include <ChilliSource/Rendering/Particle/ConcurrentParticleData.h>
 #include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleBufferPool.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleSimulation.h>
+#include <ChilliSource/Rendering/Particle/ParticleSnapshot.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
 #include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawable.h>
@@ -45,8 +49,8 @@
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
 
-#include <limits>
-#include <tuple>
+#include <algorithm>
+#include <cmath>
 
 namespace ChilliSource
 {
@@ -74,55 +78,6 @@ namespace ChilliSource
 				CS_ASSERT(in_particleEffect->GetInitialAngularVelocityProperty() != nullptr, "Trying to use incomplete particle effect: Initial angular velocity property missing.");
 			}
 			//----------------------------------------------------------------
-			/// Calculates the bounding shapes for the given set of particles.
-			///
-			/// @author Ian Copland
-			///
-			/// @param The particle effect.
-			/// @param The array of particles.
-			/// 
-			/// @return a pair containing the AABB and the Bounding Sphere.
-			//----------------------------------------------------------------
-			std::pair<Core::AABB, Core::Sphere> CalculateBoundingShapes(const ParticleEffect* in_particleEffect, const Core::dynamic_array<Particle>* in_particleArray)
-			{
-				Core::Vector3 min = CSCore::Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
-				Core::Vector3 max = CSCore::Vector3(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
-
-				bool anyActive = false;
-				for (const auto& particle : *in_particleArray)
-				{
-					if (particle.m_isActive == true)
-					{
-						anyActive = true;
-
-						if (particle.m_position.x < min.x)
-							min.x = particle.m_position.x;
-						if (particle.m_position.y < min.y)
-							min.y = particle.m_position.y;
-						if (particle.m_position.z < min.z)
-							min.z = particle.m_position.z;
-
-						if (particle.m_position.x > max.x)
-							max.x = particle.m_position.x;
-						if (particle.m_position.y > max.y)
-							max.y = particle.m_position.y;
-						if (particle.m_position.z > max.z)
-							max.z = particle.m_position.z;
-					}
-				}
-
-				if (anyActive == false)
-				{
-					min = CSCore::Vector3::k_zero;
-					max = CSCore::Vector3::k_zero;
-				}
-
-				Core::Vector3 size = max - min;
-				Core::Vector3 centre = min + 0.5f * size;
-
-				return std::make_pair(Core::AABB(centre, size), Core::Sphere(centre, size.Length() * 0.5f));
-			}
-			//----------------------------------------------------------------
 			/// Updates the particles on a background thread. This will emit
 			/// new particles, update existing particles and apply particle
 			/// affectors. These changes will then be committed to the 
@@ -137,6 +92,8 @@ namespace ChilliSource
 			/// @param The list of particle affectors.
 			/// @param The array of particles.
 			/// @param The particle draw data array.
+			/// @param The random engine used for all random numbers generated
+			/// during the update.
 			/// @param The playback time.
 			/// @param The delta time.
 			/// @param The entity's world position.
@@ -146,59 +103,23 @@ namespace ChilliSource
 			/// of emission since the last frame.
 			//----------------------------------------------------------------
 			void ParticleUpdateTask(ParticleEffectCSPtr in_particleEffect, ParticleEmitterSPtr in_particleEmitter, std::vector<ParticleAffectorSPtr> in_particleAffectors, 
-				std::shared_ptr<Core::dynamic_array<Particle>> in_particleArray, ConcurrentParticleDataSPtr in_concurrentParticleData, f32 in_playbackTime, 
+				std::shared_ptr<Core::dynamic_array<Particle>> in_particleArray, ConcurrentParticleDataSPtr in_concurrentParticleData, std::shared_ptr<Core::RandomEngine> in_randomEngine, f32 in_playbackTime, 
 				f32 in_deltaTime, Core::Vector3 in_entityPosition, Core::Vector3 in_entityScale, Core::Quaternion in_entityOrientation, bool in_interpolateEmission)
 			{
 				CS_ASSERT(in_particleEffect != nullptr, "Cannot update particles with null particle effect.");
 				CS_ASSERT(in_particleArray != nullptr, "Cannot update particles with null particle array.");
 				CS_ASSERT(in_concurrentParticleData != nullptr, "Cannot update particles with null concurrent particle data.");
+				CS_ASSERT(in_randomEngine != nullptr, "Cannot update particles with null random engine.");
 
-				//update the particles
-				for (auto& particle : *in_particleArray)
-				{
-					if (particle.m_isActive == true)
-					{
-						particle.m_energy -= in_deltaTime;
-						if (particle.m_energy > 0.0f)
-						{
-							particle.m_position += particle.m_velocity * in_deltaTime;
-							particle.m_rotation += particle.m_angularVelocity * in_deltaTime;
-						}
-						else
-						{
-							particle.m_energy = 0.0f;
-							particle.m_isActive = false;
-						}
-					}
-				}
-
-                //calculate the normalised playback progress.
-                const f32 effectProgress = in_playbackTime / in_particleEffect->GetDuration();
-                
-				//apply affectors
-				for (auto& affector : in_particleAffectors)
-				{
-					affector->AffectParticles(in_deltaTime, effectProgress);
-				}
-
-				//try to emit
-				std::vector<u32> newIndices;
-				if (in_particleEmitter != nullptr)
-				{
-					newIndices = in_particleEmitter->TryEmit(in_playbackTime, in_entityPosition, in_entityScale, in_entityOrientation, in_interpolateEmission);
-				}
+				//only one update task can run at a time for an effect, so the effect's engine can safely be used by the emitter, affectors and properties.
+				Core::Random::ScopedEngine scopedRandomEngine(*in_randomEngine);
 
-				//Initialise any new particles in each affector.
-				for (u32 newIndex : newIndices)
-				{
-					for (auto& affector : in_particleAffectors)
-					{
-						affector->ActivateParticle(newIndex, effectProgress);
-					}
-				}
+				Core::AABB aabb;
+				Core::Sphere boundingSphere;
+				std::vector<u32> newIndices = ParticleSimulation::Update(in_particleEffect.get(), in_particleEmitter.get(), in_particleAffectors, *in_particleArray, in_playbackTime, in_deltaTime,
+					in_entityPosition, in_entityScale, in_entityOrientation, in_interpolateEmission, aabb, boundingSphere);
 
-				auto boundingShapes = CalculateBoundingShapes(in_particleEffect.get(), in_particleArray.get());
-				in_concurrentParticleData->CommitParticleData(in_particleArray.get(), newIndices, boundingShapes.first, boundingShapes.second);
+				in_concurrentParticleData->CommitParticleData(in_particleArray.get(), newIndices, aabb, boundingSphere);
 			}
 		}
 		CS_DEFINE_NAMEDTYPE(ParticleEffectComponent);
@@ -214,6 +135,12 @@ namespace ChilliSource
 		{
 			return (RenderComponent::InterfaceID == in_interfaceId || ParticleEffectComponent::InterfaceID == in_interfaceId);
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool ParticleEffectComponent::IsUpdatePhaseRequired(UpdatePhase in_phase) const
+		{
+			return (in_phase == UpdatePhase::k_update);
+		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
 		ParticleEffectCSPtr ParticleEffectComponent::GetParticleEffect() const
@@ -298,6 +225,23 @@ namespace ChilliSource
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
+		void ParticleEffectComponent::SetRandomSeed(u64 in_seed)
+		{
+			CS_ASSERT(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Random seed must be set on the main thread.");
+
+			m_randomSeed = in_seed;
+			m_hasRandomSeed = true;
+		}
+		//-------------------------------------------------------
+		//-------------------------------------------------------
+		void ParticleEffectComponent::SetStartSnapshot(const ParticleSnapshotCSPtr& in_snapshot)
+		{
+			CS_ASSERT(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Start snapshot must be set on the main thread.");
+
+			m_startSnapshot = in_snapshot;
+		}
+		//-------------------------------------------------------
+		//-------------------------------------------------------
 		void ParticleEffectComponent::Play()
 		{
 			CS_ASSERT(Core::Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Play must be called on the main thread.");
@@ -317,6 +261,11 @@ namespace ChilliSource
 			m_accumulatedDeltaTime = 0.0f;
 			m_firstFrame = true;
 
+			//a new engine is created rather than re-seeding the existing one as a previous update task may still be using it.
+			u64 seed = (m_hasRandomSeed == true) ? m_randomSeed : Core::Random::GenerateSeed();
+			m_randomEngine = std::make_shared<Core::RandomEngine>(seed);
+			m_drawableRandomEngine.Seed(~seed);
+
 			//reset the bounding shapes.
 			m_localAABB = Core::AABB();
 			m_localBoundingSphere = Core::Sphere();
@@ -373,24 +322,20 @@ namespace ChilliSource
 			{
 				ValidateParticleEffect(m_particleEffect);
 
-				m_particleArray = std::make_shared<Core::dynamic_array<Particle>>(m_particleEffect->GetMaxParticles());
-				m_concurrentParticleData = std::make_shared<ConcurrentParticleData>(m_particleEffect->GetMaxParticles());
+				//the buffers are recycled through the effect's pool. Each of the pointers below shares ownership
+				//of the buffers, so they are only returned to the pool once any in-flight update task has finished.
+				ParticleBufferPool::BuffersSPtr buffers = m_particleEffect->GetBufferPool()->Acquire();
+				m_particleArray = std::shared_ptr<Core::dynamic_array<Particle>>(buffers, &buffers->m_particles);
+				m_concurrentParticleData = ConcurrentParticleDataSPtr(buffers, &buffers->m_concurrentParticleData);
+				m_emitter = ParticleEmitterSPtr(buffers, buffers->m_emitter.get());
+				for (const auto& affector : buffers->m_affectors)
+				{
+					m_affectors.push_back(ParticleAffectorSPtr(buffers, affector.get()));
+				}
 
 				m_drawable = m_particleEffect->GetDrawableDef()->CreateInstance(GetEntity(), m_concurrentParticleData.get());
 				CS_ASSERT(m_drawable != nullptr, "Failed to create particle drawable.");
 
-				m_emitter = m_particleEffect->GetEmitterDef()->CreateInstance(m_particleArray.get());
-				CS_ASSERT(m_emitter != nullptr, "Failed to create particle emitter.");
-
-				const std::vector<const ParticleAffectorDef*> affectorDefs = m_particleEffect->GetAffectorDefs();
-				for (const auto& affectorDef : affectorDefs)
-				{
-					ParticleAffectorSPtr affector = affectorDef->CreateInstance(m_particleArray.get());
-					CS_ASSERT(affector != nullptr, "Failed to create particle emitter.");
-
-					m_affectors.push_back(affector);
-				}
-
 				mpMaterial = m_particleEffect->GetDrawableDef()->GetMaterial();
 
 				//reset the bounding shapes.
@@ -403,9 +348,10 @@ namespace ChilliSource
 		//-------------------------------------------------------
 		void ParticleEffectComponent::CleanupParticleEffect()
 		{
+			//the drawable references the concurrent particle data so must be destroyed before the buffers are released.
+			m_drawable.reset();
 			m_particleArray.reset();
 			m_concurrentParticleData.reset();
-			m_drawable.reset();
 			m_emitter.reset();
 			m_affectors.clear();
 		}
@@ -415,9 +361,15 @@ namespace ChilliSource
 		{
 			CS_ASSERT((m_playbackState == PlaybackState::k_playing || m_playbackState == PlaybackState::k_stopping), "Can only store local bounding shapes when playing or stopping.");
 
-			m_localAABB = m_concurrentParticleData->GetAABB();
-			m_localBoundingSphere = m_concurrentParticleData->GetBoundingSphere();
-			m_invalidateBoundingShapeCache = true;
+			Core::AABB localAABB = m_concurrentParticleData->GetAABB();
+
+			//the world space shapes only need to be recalculated if the local bounds have actually changed.
+			if (localAABB.GetOrigin() != m_localAABB.GetOrigin() || localAABB.GetSize() != m_localAABB.GetSize())
+			{
+				m_localAABB = localAABB;
+				m_localBoundingSphere = m_concurrentParticleData->GetBoundingSphere();
+				m_invalidateBoundingShapeCache = true;
+			}
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
@@ -425,6 +377,15 @@ namespace ChilliSource
 		{
 			CS_ASSERT(GetEntity() != nullptr, "Cannot get world bounding shapes without being attached to an entity.");
 
+			//the transform changed event is deferred until the end of the frame, so the change count
+			//is checked instead to ensure the bounding shapes are never out of date.
+			u32 changeCount = GetEntity()->GetTransform().GetChangeCount();
+			if (changeCount != m_transformChangeCount)
+			{
+				m_transformChangeCount = changeCount;
+				m_invalidateBoundingShapeCache = true;
+			}
+
 			if (m_invalidateBoundingShapeCache == true)
 			{
 				if (m_particleEffect != nullptr && m_particleEffect->GetSimulationSpace() == ParticleEffect::SimulationSpace::k_world)
@@ -442,38 +403,16 @@ namespace ChilliSource
 					mOBBoundingBox = Core::OOBB(m_localAABB.GetOrigin(), m_localAABB.GetSize());
 					mOBBoundingBox.SetTransform(worldMatrix);
 
-					//transform the 8 points of the AABB into world space and recalculate.
-					std::vector<Core::Vector3> points;
-					points.push_back(m_localAABB.BackBottomLeft() * worldMatrix);
-					points.push_back(m_localAABB.BackBottomRight() * worldMatrix);
-					points.push_back(m_localAABB.BackTopLeft() * worldMatrix);
-					points.push_back(m_localAABB.BackTopRight() * worldMatrix);
-					points.push_back(m_localAABB.FrontBottomLeft() * worldMatrix);
-					points.push_back(m_localAABB.FrontBottomRight() * worldMatrix);
-					points.push_back(m_localAABB.FrontTopLeft() * worldMatrix);
-					points.push_back(m_localAABB.FrontTopRight() * worldMatrix);
-
-					Core::Vector3 min = CSCore::Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
-					Core::Vector3 max = CSCore::Vector3(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
-					for (auto& point : points)
-					{
-						if (point.x < min.x)
-							min.x = point.x;
-						if (point.y < min.y)
-							min.y = point.y;
-						if (point.z < min.z)
-							min.z = point.z;
-
-						if (point.x > max.x)
-							max.x = point.x;
-						if (point.y > max.y)
-							max.y = point.y;
-						if (point.z > max.z)
-							max.z = point.z;
-					}
+					//transform the centre of the AABB into world space and project the half extents onto each
+					//world axis. This gives the same result as transforming all 8 corners without doing so.
+					Core::Vector3 centre = m_localAABB.GetOrigin() * worldMatrix;
+					Core::Vector3 halfSize = 0.5f * m_localAABB.GetSize();
+					Core::Vector3 worldHalfSize;
+					worldHalfSize.x = std::abs(worldMatrix.m[0]) * halfSize.x + std::abs(worldMatrix.m[4]) * halfSize.y + std::abs(worldMatrix.m[8]) * halfSize.z;
+					worldHalfSize.y = std::abs(worldMatrix.m[1]) * halfSize.x + std::abs(worldMatrix.m[5]) * halfSize.y + std::abs(worldMatrix.m[9]) * halfSize.z;
+					worldHalfSize.z = std::abs(worldMatrix.m[2]) * halfSize.x + std::abs(worldMatrix.m[6]) * halfSize.y + std::abs(worldMatrix.m[10]) * halfSize.z;
 
-					Core::Vector3 size = max - min;
-					Core::Vector3 centre = min + 0.5f * size;
+					Core::Vector3 size = 2.0f * worldHalfSize;
 
 					mBoundingBox = Core::AABB(centre, size);
 
@@ -490,7 +429,7 @@ namespace ChilliSource
 		{
 			PrepareParticleEffect();
 
-			m_entityTransformConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeDelegate(this, &ParticleEffectComponent::OnEntityTransformChanged));
+			m_invalidateBoundingShapeCache = true;
 		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
@@ -530,12 +469,24 @@ namespace ChilliSource
 		{
 			if (m_concurrentParticleData->StartUpdate() == true)
 			{
-				//intialise the particles by disabling them all.
-				for (auto& particle : *m_particleArray)
+				const ParticleSnapshot* snapshot = (m_startSnapshot != nullptr) ? m_startSnapshot.get() : m_particleEffect->GetPrewarmSnapshot();
+
+				std::vector<u32> activeIndices;
+				if (snapshot != nullptr)
+				{
+					//start from the warm state of the snapshot.
+					activeIndices = RestoreSnapshot(*snapshot);
+					m_playbackTimer += snapshot->GetPlaybackTime();
+				}
+				else
 				{
-					particle.m_isActive = false;
+					//intialise the particles by disabling them all.
+					for (auto& particle : *m_particleArray)
+					{
+						particle.m_isActive = false;
+					}
 				}
-				m_concurrentParticleData->CommitParticleData(m_particleArray.get(), std::vector<u32>(), Core::AABB(), Core::Sphere());
+				m_concurrentParticleData->CommitParticleData(m_particleArray.get(), activeIndices, Core::AABB(), Core::Sphere());
 
 				m_playbackState = PlaybackState::k_playing;
 				UpdatePlayingState(in_deltaTime);
@@ -548,6 +499,49 @@ namespace ChilliSource
 		}
 		//----------------------------------------------------------------
 		//----------------------------------------------------------------
+		std::vector<u32> ParticleEffectComponent::RestoreSnapshot(const ParticleSnapshot& in_snapshot)
+		{
+			CS_ASSERT(in_snapshot.GetParticleEffect() == m_particleEffect.get(), "Cannot restore a snapshot of a different particle effect.");
+
+			const Core::dynamic_array<Particle>& snapshotParticles = in_snapshot.GetParticles();
+			CS_ASSERT(snapshotParticles.size() == m_particleArray->size(), "Cannot restore a snapshot with a different number of particles.");
+
+			std::copy(snapshotParticles.begin(), snapshotParticles.end(), m_particleArray->begin());
+
+			m_emitter->CopyState(*in_snapshot.GetEmitter());
+
+			const std::vector<const ParticleAffector*> snapshotAffectors = in_snapshot.GetAffectors();
+			CS_ASSERT(snapshotAffectors.size() == m_affectors.size(), "Cannot restore a snapshot with a different number of affectors.");
+			for (u32 i = 0; i < m_affectors.size(); ++i)
+			{
+				m_affectors[i]->CopyState(*snapshotAffectors[i]);
+			}
+
+			//the snapshot was simulated at the origin, so world space particles need to be moved to the entity.
+			const bool isWorldSpace = (m_particleEffect->GetSimulationSpace() == ParticleEffect::SimulationSpace::k_world);
+			const Core::Transform& transform = GetEntity()->GetTransform();
+			const Core::Matrix4 worldTransform = Core::Matrix4::CreateTransform(transform.GetWorldPosition(), transform.GetWorldScale(), transform.GetWorldOrientation());
+
+			std::vector<u32> activeIndices;
+			for (u32 i = 0; i < m_particleArray->size(); ++i)
+			{
+				Particle& particle = (*m_particleArray)[i];
+				if (particle.m_isActive == true)
+				{
+					if (isWorldSpace == true)
+					{
+						particle.m_position = particle.m_position * worldTransform;
+						particle.m_velocity = Core::Vector3::Rotate(particle.m_velocity * transform.GetWorldScale(), transform.GetWorldOrientation());
+					}
+
+					activeIndices.push_back(i);
+				}
+			}
+
+			return activeIndices;
+		}
+		//----------------------------------------------------------------
+		//----------------------------------------------------------------
 		void ParticleEffectComponent::UpdatePlayingState(f32 in_deltaTime)
 		{
 			m_playbackTimer += in_deltaTime;
@@ -573,7 +567,7 @@ namespace ChilliSource
 				StoreLocalBoundingShapes();
 
 				bool shouldInterpolateEmission = (m_firstFrame == false);
-				Core::Application::Get()->GetTaskScheduler()->ScheduleTask(std::bind(ParticleUpdateTask, m_particleEffect, m_emitter, m_affectors, m_particleArray, m_concurrentParticleData,
+				Core::Application::Get()->GetTaskScheduler()->ScheduleTask(std::bind(ParticleUpdateTask, m_particleEffect, m_emitter, m_affectors, m_particleArray, m_concurrentParticleData, m_randomEngine,
 					m_playbackTimer, m_accumulatedDeltaTime, GetEntity()->GetTransform().GetWorldPosition(), GetEntity()->GetTransform().GetWorldScale(), GetEntity()->GetTransform().GetWorldOrientation(), shouldInterpolateEmission));
 
 				m_firstFrame = false;
@@ -596,7 +590,7 @@ namespace ChilliSource
 					StoreLocalBoundingShapes();
 
 					bool shouldInterpolateEmission = (m_firstFrame == false);
-					Core::Application::Get()->GetTaskScheduler()->ScheduleTask(std::bind(ParticleUpdateTask, m_particleEffect, nullptr, m_affectors, m_particleArray, m_concurrentParticleData,
+					Core::Application::Get()->GetTaskScheduler()->ScheduleTask(std::bind(ParticleUpdateTask, m_particleEffect, nullptr, m_affectors, m_particleArray, m_concurrentParticleData, m_randomEngine,
 						m_playbackTimer, m_accumulatedDeltaTime, GetEntity()->GetTransform().GetWorldPosition(), GetEntity()->GetTransform().GetWorldScale(), GetEntity()->GetTransform().GetWorldOrientation(), shouldInterpolateEmission));
 
 					m_firstFrame = false;
@@ -612,15 +606,10 @@ namespace ChilliSource
 			{
 				CS_ASSERT(m_drawable != nullptr, "Cannot render without a drawable.");
 
+				Core::Random::ScopedEngine scopedRandomEngine(m_drawableRandomEngine);
 				m_drawable->Draw(in_camera);
 			}
 		}
-		//----------------------------------------------------------------
-		//----------------------------------------------------------------
-		void ParticleEffectComponent::OnEntityTransformChanged()
-		{
-			m_invalidateBoundingShapeCache = true;
-		}
 		//-------------------------------------------------------
 		//-------------------------------------------------------
 		void ParticleEffectComponent::OnRemovedFromScene()
@@ -634,8 +623,6 @@ namespace ChilliSource
 		//-------------------------------------------------------
 		void ParticleEffectComponent::OnRemovedFromEntity()
 		{
-			m_entityTransformConnection.reset();
-
 			CleanupParticleEffect();
 		}
 	}
@@ -31,6 +31,7 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Event/Event.h>
+#include <ChilliSource/Core/Math/RandomEngine.h>
 #include <ChilliSource/Rendering/Base/RenderComponent.h>
 #include <ChilliSource/Rendering/Particle/Drawable/ParticleDrawable.h>
 
@@ -99,6 +100,16 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			bool IsA(Core::InterfaceIDType in_interfaceId) const override;
 			//----------------------------------------------------------------
+			/// Only the update phase is required, to advance the simulation.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The update phase.
+			///
+			/// @return Whether or not the phase is required.
+			//----------------------------------------------------------------
+			bool IsUpdatePhaseRequired(UpdatePhase in_phase) const override;
+			//----------------------------------------------------------------
 			/// Returns the current particle effect. 
 			///
 			/// This is not thread-safe and should only be called on the main
@@ -191,6 +202,38 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void SetPlaybackType(PlaybackType in_playbackType);
 			//----------------------------------------------------------------
+			/// Sets the seed used for all random numbers generated by this
+			/// effect. The effect is re-seeded each time it is played, so
+			/// given the same sequence of update delta times it will produce
+			/// identical particles each time. This is useful for replays and
+			/// tests. If no seed is set, a new seed is generated each time the
+			/// effect is played.
+			///
+			/// This is not thread-safe and should only be called on the main
+			/// thread.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The seed.
+			//----------------------------------------------------------------
+			void SetRandomSeed(u64 in_seed);
+			//----------------------------------------------------------------
+			/// Sets the snapshot that playback should start from. This will
+			/// take effect the next time the effect is played and takes 
+			/// precedence over the particle effect's prewarm snapshot. The 
+			/// snapshot must have been created from the current particle 
+			/// effect. Setting this to null will revert to using the prewarm
+			/// snapshot, if there is one.
+			///
+			/// This is not thread-safe and should only be called on the main
+			/// thread.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The snapshot.
+			//----------------------------------------------------------------
+			void SetStartSnapshot(const ParticleSnapshotCSPtr& in_snapshot);
+			//----------------------------------------------------------------
 			/// Starts the particle effect playing.
 			///
 			/// This is not thread-safe and should only be called on the main
@@ -280,7 +323,9 @@ namespace ChilliSource
 			void CleanupParticleEffect();
 			//----------------------------------------------------------------
 			/// Takes the calculated local bounds of the particle effect and
-			/// stores them for later calculating the world bounds.
+			/// stores them for later calculating the world bounds. The world
+			/// bounding shape cache is only invalidated if the local bounds
+			/// have changed.
 			///
 			/// @author Ian Copland
 			//----------------------------------------------------------------
@@ -327,6 +372,20 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void UpdateStartingState(f32 in_deltaTime);
 			//----------------------------------------------------------------
+			/// Copies the particles, emitter state and affector state from the
+			/// given snapshot. If the effect is simulated in world space the
+			/// particles are moved into the space of the entity.
+			///
+			/// This must only be called while no update task is in progress.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The snapshot.
+			///
+			/// @return The indices of the active particles.
+			//----------------------------------------------------------------
+			std::vector<u32> RestoreSnapshot(const ParticleSnapshot& in_snapshot);
+			//----------------------------------------------------------------
 			/// This will fire off a new particle update background task.
 			///
 			/// @author Ian Copland
@@ -367,13 +426,6 @@ namespace ChilliSource
 			//----------------------------------------------------------------
 			void RenderShadowMap(RenderSystem* in_renderSystem, CameraComponent* in_camera, const MaterialCSPtr& in_staticShadowMat, const MaterialCSPtr& in_animShadowMat) override {};
 			//----------------------------------------------------------------
-			/// Called when the entities transform changes. This invalidates
-			/// the bounding shape cache.
-			///
-			/// @author Ian Copland
-			//----------------------------------------------------------------
-			void OnEntityTransformChanged();
-			//----------------------------------------------------------------
 			/// Called either when this is removed from an entity that is 
 			/// attached to the scene or when an entity this is attached to is 
 			/// removed from the scene. This will stop the particle effect 
@@ -395,6 +447,11 @@ namespace ChilliSource
 			std::vector<ParticleAffectorSPtr> m_affectors;
 			std::shared_ptr<Core::dynamic_array<Particle>> m_particleArray;
 			ConcurrentParticleDataSPtr m_concurrentParticleData;
+			std::shared_ptr<Core::RandomEngine> m_randomEngine;
+			Core::RandomEngine m_drawableRandomEngine;
+			u64 m_randomSeed = 0;
+			bool m_hasRandomSeed = false;
+			ParticleSnapshotCSPtr m_startSnapshot;
 
 			PlaybackType m_playbackType = PlaybackType::k_once;
 			PlaybackState m_playbackState = PlaybackState::k_notPlaying;
@@ -407,7 +464,7 @@ namespace ChilliSource
 			Core::AABB m_localAABB;
 			Core::Sphere m_localBoundingSphere;
 			bool m_invalidateBoundingShapeCache = true;
-			Core::EventConnectionUPtr m_entityTransformConnection;
+			u32 m_transformChangeCount = 0;
 		};
 	}
 }
@@ -0,0 +1,164 @@
+//
+//  ParticleSimulation.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleSimulation.h>
+
+#include <ChilliSource/Rendering/Particle/Particle.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
+#include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
+
+#include <limits>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		namespace ParticleSimulation
+		{
+			namespace
+			{
+				//----------------------------------------------------------------
+				/// Expands the given min and max bounds to include the given
+				/// position.
+				///
+				/// @author Carlos Artesano
+				///
+				/// @param The position.
+				/// @param [Out] The minimum bounds.
+				/// @param [Out] The maximum bounds.
+				//----------------------------------------------------------------
+				void ExpandBounds(const Core::Vector3& in_position, Core::Vector3& out_min, Core::Vector3& out_max)
+				{
+					if (in_position.x < out_min.x)
+						out_min.x = in_position.x;
+					if (in_position.y < out_min.y)
+						out_min.y = in_position.y;
+					if (in_position.z < out_min.z)
+						out_min.z = in_position.z;
+
+					if (in_position.x > out_max.x)
+						out_max.x = in_position.x;
+					if (in_position.y > out_max.y)
+						out_max.y = in_position.y;
+					if (in_position.z > out_max.z)
+						out_max.z = in_position.z;
+				}
+				//----------------------------------------------------------------
+				/// Builds the bounding shapes from the given min and max bounds.
+				/// If the min is greater than the max then there were no active
+				/// particles and empty bounding shapes are returned.
+				///
+				/// @author Carlos Artesano
+				///
+				/// @param The minimum bounds.
+				/// @param The maximum bounds.
+				/// 
+				/// @return a pair containing the AABB and the Bounding Sphere.
+				//----------------------------------------------------------------
+				std::pair<Core::AABB, Core::Sphere> BuildBoundingShapes(Core::Vector3 in_min, Core::Vector3 in_max)
+				{
+					if (in_min.x > in_max.x)
+					{
+						in_min = CSCore::Vector3::k_zero;
+						in_max = CSCore::Vector3::k_zero;
+					}
+
+					Core::Vector3 size = in_max - in_min;
+					Core::Vector3 centre = in_min + 0.5f * size;
+
+					return std::make_pair(Core::AABB(centre, size), Core::Sphere(centre, size.Length() * 0.5f));
+				}
+			}
+			//-----------------------------------------------------------------
+			//-----------------------------------------------------------------
+			std::vector<u32> Update(const ParticleEffect* in_particleEffect, ParticleEmitter* in_particleEmitter, const std::vector<ParticleAffectorSPtr>& in_particleAffectors, 
+				Core::dynamic_array<Particle>& inout_particleArray, f32 in_playbackTime, f32 in_deltaTime, const Core::Vector3& in_emitterPosition, const Core::Vector3& in_emitterScale, 
+				const Core::Quaternion& in_emitterOrientation, bool in_interpolateEmission, Core::AABB& out_aabb, Core::Sphere& out_boundingSphere)
+			{
+				CS_ASSERT(in_particleEffect != nullptr, "Cannot update particles with null particle effect.");
+
+				//update the particles. The bounds are calculated as part of the same pass; affectors
+				//never change particle positions so only newly emitted particles need to be added later.
+				Core::Vector3 min = CSCore::Vector3(std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max(), std::numeric_limits<f32>::max());
+				Core::Vector3 max = CSCore::Vector3(-std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max(), -std::numeric_limits<f32>::max());
+				for (auto& particle : inout_particleArray)
+				{
+					if (particle.m_isActive == true)
+					{
+						particle.m_energy -= in_deltaTime;
+						if (particle.m_energy > 0.0f)
+						{
+							particle.m_position += particle.m_velocity * in_deltaTime;
+							particle.m_rotation += particle.m_angularVelocity * in_deltaTime;
+							ExpandBounds(particle.m_position, min, max);
+						}
+						else
+						{
+							particle.m_energy = 0.0f;
+							particle.m_isActive = false;
+						}
+					}
+				}
+
+				//calculate the normalised playback progress.
+				const f32 effectProgress = in_playbackTime / in_particleEffect->GetDuration();
+
+				//apply affectors
+				for (auto& affector : in_particleAffectors)
+				{
+					affector->AffectParticles(in_deltaTime, effectProgress);
+				}
+
+				//try to emit
+				std::vector<u32> newIndices;
+				if (in_particleEmitter != nullptr)
+				{
+					newIndices = in_particleEmitter->TryEmit(in_playbackTime, in_emitterPosition, in_emitterScale, in_emitterOrientation, in_interpolateEmission);
+				}
+
+				//Initialise any new particles in each affector.
+				for (u32 newIndex : newIndices)
+				{
+					for (auto& affector : in_particleAffectors)
+					{
+						affector->ActivateParticle(newIndex, effectProgress);
+					}
+
+					ExpandBounds(inout_particleArray[newIndex].m_position, min, max);
+				}
+
+				auto boundingShapes = BuildBoundingShapes(min, max);
+				out_aabb = boundingShapes.first;
+				out_boundingSphere = boundingShapes.second;
+
+				return newIndices;
+			}
+		}
+	}
+}
@@ -0,0 +1,88 @@
+//
+//  ParticleSimulation.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLESIMULATION_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLESIMULATION_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/dynamic_array.h>
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//------------------------------------------------------------------------
+		/// A collection of functions for stepping the simulation of a particle
+		/// effect. This is shared by the Particle Effect Component's background
+		/// update task and by the creation of particle snapshots.
+		///
+		/// @author Carlos Artesano
+		//------------------------------------------------------------------------
+		namespace ParticleSimulation
+		{
+			//-----------------------------------------------------------------
+			/// Performs a single step of the particle simulation. This will 
+			/// update existing particles, apply particle affectors and emit
+			/// new particles. The bounds of all active particles are 
+			/// calculated as part of the same pass.
+			///
+			/// Any random numbers are generated with the calling thread's
+			/// current random engine.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The particle effect.
+			/// @param The particle emitter. If null, the effect is no longer
+			/// emitting.
+			/// @param The list of particle affectors.
+			/// @param [In/Out] The array of particles.
+			/// @param The playback time.
+			/// @param The delta time.
+			/// @param The emitter world position.
+			/// @param The emitter world scale.
+			/// @param The emitter world orientation.
+			/// @param Whether or not to interpolate the particles point
+			/// of emission since the last step.
+			/// @param [Out] The bounding box of the active particles.
+			/// @param [Out] The bounding sphere of the active particles.
+			///
+			/// @return The indices of the newly emitted particles.
+			//-----------------------------------------------------------------
+			std::vector<u32> Update(const ParticleEffect* in_particleEffect, ParticleEmitter* in_particleEmitter, const std::vector<ParticleAffectorSPtr>& in_particleAffectors, 
+				Core::dynamic_array<Particle>& inout_particleArray, f32 in_playbackTime, f32 in_deltaTime, const Core::Vector3& in_emitterPosition, const Core::Vector3& in_emitterScale, 
+				const Core::Quaternion& in_emitterOrientation, bool in_interpolateEmission, Core::AABB& out_aabb, Core::Sphere& out_boundingSphere);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,139 @@
+//
+//  ParticleSnapshot.cpp
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Rendering/Particle/ParticleSnapshot.h>
+
+#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/RandomEngine.h>
+#include <ChilliSource/Rendering/Particle/ParticleEffect.h>
+#include <ChilliSource/Rendering/Particle/ParticleSimulation.h>
+#include <ChilliSource/Rendering/Particle/Affector/ParticleAffector.h>
+#include <ChilliSource/Rendering/Particle/Affector/ParticleAffectorDef.h>
+#include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitter.h>
+#include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
+
+#include <algorithm>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		ParticleSnapshotUPtr ParticleSnapshot::Create(const ParticleEffect* in_particleEffect, f32 in_simulationTime, f32 in_timeStep, u64 in_seed)
+		{
+			CS_ASSERT(in_particleEffect != nullptr, "Cannot create a particle snapshot with a null particle effect.");
+			CS_ASSERT(in_particleEffect->GetDuration() > 0.0f, "Cannot create a particle snapshot for an effect with no duration.");
+			CS_ASSERT(in_simulationTime >= 0.0f, "Cannot create a particle snapshot with a negative simulation time.");
+			CS_ASSERT(in_timeStep > 0.0f, "Cannot create a particle snapshot with a time step of zero or less.");
+
+			ParticleSnapshotUPtr snapshot(new ParticleSnapshot(in_particleEffect));
+
+			Core::RandomEngine randomEngine(in_seed);
+			Core::Random::ScopedEngine scopedRandomEngine(randomEngine);
+
+			const f32 duration = in_particleEffect->GetDuration();
+			f32 simulatedTime = 0.0f;
+			bool interpolateEmission = false;
+			Core::AABB aabb;
+			Core::Sphere boundingSphere;
+			while (simulatedTime < in_simulationTime)
+			{
+				f32 deltaTime = std::min(in_timeStep, in_simulationTime - simulatedTime);
+				simulatedTime += deltaTime;
+
+				snapshot->m_playbackTime += deltaTime;
+				while (snapshot->m_playbackTime >= duration)
+				{
+					snapshot->m_playbackTime -= duration;
+				}
+
+				ParticleSimulation::Update(in_particleEffect, snapshot->m_emitter.get(), snapshot->m_affectors, snapshot->m_particles, snapshot->m_playbackTime, deltaTime, 
+					Core::Vector3::k_zero, Core::Vector3::k_one, Core::Quaternion::k_identity, interpolateEmission, aabb, boundingSphere);
+				interpolateEmission = true;
+			}
+
+			return snapshot;
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		ParticleSnapshot::ParticleSnapshot(const ParticleEffect* in_particleEffect)
+			: m_particleEffect(in_particleEffect), m_particles(in_particleEffect->GetMaxParticles())
+		{
+			CS_ASSERT(m_particleEffect->GetEmitterDef() != nullptr, "Cannot create a particle snapshot for an effect without an emitter.");
+
+			m_emitter = m_particleEffect->GetEmitterDef()->CreateInstance(&m_particles);
+			CS_ASSERT(m_emitter != nullptr, "Failed to create particle emitter.");
+
+			for (const auto& affectorDef : m_particleEffect->GetAffectorDefs())
+			{
+				ParticleAffectorSPtr affector = affectorDef->CreateInstance(&m_particles);
+				CS_ASSERT(affector != nullptr, "Failed to create particle affector.");
+
+				m_affectors.push_back(affector);
+			}
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		const ParticleEffect* ParticleSnapshot::GetParticleEffect() const
+		{
+			return m_particleEffect;
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		f32 ParticleSnapshot::GetPlaybackTime() const
+		{
+			return m_playbackTime;
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		const Core::dynamic_array<Particle>& ParticleSnapshot::GetParticles() const
+		{
+			return m_particles;
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		const ParticleEmitter* ParticleSnapshot::GetEmitter() const
+		{
+			return m_emitter.get();
+		}
+		//-----------------------------------------------------------------
+		//-----------------------------------------------------------------
+		std::vector<const ParticleAffector*> ParticleSnapshot::GetAffectors() const
+		{
+			std::vector<const ParticleAffector*> output;
+
+			for (const auto& affector : m_affectors)
+			{
+				output.push_back(affector.get());
+			}
+
+			return output;
+		}
+	}
+}
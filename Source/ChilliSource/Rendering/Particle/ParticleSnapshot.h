@@ -0,0 +1,143 @@
+//
+//  ParticleSnapshot.h
+//  Chilli Source
+//  Created by Carlos Artesano on 19/10/2026.
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2026 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_RENDERING_PARTICLE_PARTICLESNAPSHOT_H_
+#define _CHILLISOURCE_RENDERING_PARTICLE_PARTICLESNAPSHOT_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/dynamic_array.h>
+#include <ChilliSource/Rendering/Particle/Particle.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+	namespace Rendering
+	{
+		//------------------------------------------------------------------------
+		/// A snapshot of the simulation state of a particle effect after it has
+		/// been simulated for a period of time. This includes the particles 
+		/// themselves, the emitter state and any per-particle affector state.
+		///
+		/// Particle Effect Components can start playback from a snapshot rather
+		/// than from an empty state, allowing effects such as smoke or fire to
+		/// appear already "warm" when they are first seen. As a snapshot is 
+		/// immutable once created, a single snapshot can be shared between any
+		/// number of instances of the same effect without each having to 
+		/// re-simulate.
+		///
+		/// The simulation is performed with the emitter at the origin with no
+		/// rotation or scale. When a world space effect is started from a 
+		/// snapshot, the positions and velocities of the particles are 
+		/// transformed into the space of the entity.
+		///
+		/// @author Carlos Artesano
+		//------------------------------------------------------------------------
+		class ParticleSnapshot final
+		{
+		public:
+			CS_DECLARE_NOCOPY(ParticleSnapshot);
+			//-----------------------------------------------------------------
+			/// Creates a new snapshot by simulating the given particle effect
+			/// from an empty state for the requested amount of time. The 
+			/// simulation is performed in fixed time steps, which can be far 
+			/// larger than a typical frame time as only the end state is of
+			/// interest. The effect is treated as looping.
+			///
+			/// This is thread safe, so long as the particle effect is not 
+			/// modified during creation, and will typically be called from a
+			/// background thread while the effect is loading.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The particle effect to simulate. This must be complete
+			/// and must out live the snapshot.
+			/// @param The total time to simulate.
+			/// @param The time step to use.
+			/// @param The seed for the random engine used during simulation.
+			///
+			/// @return The new snapshot.
+			//-----------------------------------------------------------------
+			static ParticleSnapshotUPtr Create(const ParticleEffect* in_particleEffect, f32 in_simulationTime, f32 in_timeStep, u64 in_seed);
+			//-----------------------------------------------------------------
+			/// @author Carlos Artesano
+			///
+			/// @return The particle effect this snapshot was created from.
+			//-----------------------------------------------------------------
+			const ParticleEffect* GetParticleEffect() const;
+			//-----------------------------------------------------------------
+			/// @author Carlos Artesano
+			///
+			/// @return The playback time of the effect at the point the 
+			/// snapshot was taken. This will always be less than the duration
+			/// of the effect.
+			//-----------------------------------------------------------------
+			f32 GetPlaybackTime() const;
+			//-----------------------------------------------------------------
+			/// @author Carlos Artesano
+			///
+			/// @return The simulated particles.
+			//-----------------------------------------------------------------
+			const Core::dynamic_array<Particle>& GetParticles() const;
+			//-----------------------------------------------------------------
+			/// @author Carlos Artesano
+			///
+			/// @return The emitter, containing the emission state at the point
+			/// the snapshot was taken.
+			//-----------------------------------------------------------------
+			const ParticleEmitter* GetEmitter() const;
+			//-----------------------------------------------------------------
+			/// @author Carlos Artesano
+			///
+			/// @return The affectors, containing any per-particle state at 
+			/// the point the snapshot was taken. These are in the same order
+			/// as the particle effect's affector defs.
+			//-----------------------------------------------------------------
+			std::vector<const ParticleAffector*> GetAffectors() const;
+
+		private:
+			//-----------------------------------------------------------------
+			/// Constructor. Creates the emitter and affectors for the given 
+			/// particle effect with all particles inactive.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The particle effect.
+			//-----------------------------------------------------------------
+			ParticleSnapshot(const ParticleEffect* in_particleEffect);
+
+			const ParticleEffect* m_particleEffect = nullptr;
+			f32 m_playbackTime = 0.0f;
+			Core::dynamic_array<Particle> m_particles;
+			ParticleEmitterSPtr m_emitter;
+			std::vector<ParticleAffectorSPtr> m_affectors;
+		};
+	}
+}
+
+#endif
@@ -33,6 +33,8 @@
 #include <ChilliSource/Rendering/Base/RenderSystem.h>
 #include <ChilliSource/Rendering/Material/Material.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -53,6 +55,7 @@ namespace ChilliSource
             }
             
             maRenderCommands.reserve(50);
+            m_vertexCache.reserve(kudwMaxSpritesInDynamicBatch * k_numSpriteVerts);
 		}
         //-------------------------------------------------------
         /// Render
@@ -67,7 +70,7 @@ namespace ChilliSource
 		void DynamicSpriteBatch::Render(const SpriteBatch::SpriteData& inpSprite, const Core::Matrix4 * inpTransform)
 		{
             //If we exceed the capacity of the buffer then we will be forced to flush it
-            if(maSpriteCache.size() >= kudwMaxSpritesInDynamicBatch)
+            if(m_vertexCache.size() >= kudwMaxSpritesInDynamicBatch * k_numSpriteVerts)
             {
                 ForceRender();
             }
@@ -80,17 +83,46 @@ namespace ChilliSource
                 InsertDrawCommand();
             }
             
-            maSpriteCache.push_back(inpSprite);
+            m_vertexCache.insert(m_vertexCache.end(), inpSprite.sVerts, inpSprite.sVerts + k_numSpriteVerts);
             if(inpTransform)
             {
+                auto firstVertex = m_vertexCache.end() - k_numSpriteVerts;
                 for(u32 i = 0; i < k_numSpriteVerts; i++)
-					maSpriteCache.back().sVerts[i].vPos = inpSprite.sVerts[i].vPos * *inpTransform;
+					firstVertex[i].vPos = inpSprite.sVerts[i].vPos * *inpTransform;
             }
             mpLastMaterial = inpSprite.pMaterial;
             ++mudwSpriteCommandCounter;
 		}
         //-------------------------------------------------------
         //-------------------------------------------------------
+        void DynamicSpriteBatch::Render(const MaterialCSPtr& in_material, const SpriteBatch::SpriteVertex* in_vertices, u32 in_numSprites)
+        {
+            while(in_numSprites > 0)
+            {
+                u32 numCachedSprites = static_cast<u32>(m_vertexCache.size()) / k_numSpriteVerts;
+                if(numCachedSprites >= kudwMaxSpritesInDynamicBatch)
+                {
+                    ForceRender();
+                    numCachedSprites = 0;
+                }
+                
+                if(mpLastMaterial && mpLastMaterial != in_material)
+                {
+                    InsertDrawCommand();
+                }
+                
+                u32 numSpritesToAdd = std::min(in_numSprites, kudwMaxSpritesInDynamicBatch - numCachedSprites);
+                m_vertexCache.insert(m_vertexCache.end(), in_vertices, in_vertices + numSpritesToAdd * k_numSpriteVerts);
+                
+                mpLastMaterial = in_material;
+                mudwSpriteCommandCounter += numSpritesToAdd;
+                
+                in_vertices += numSpritesToAdd * k_numSpriteVerts;
+                in_numSprites -= numSpritesToAdd;
+            }
+        }
+        //-------------------------------------------------------
+        //-------------------------------------------------------
         void DynamicSpriteBatch::EnableScissoring(const Core::Vector2& in_pos, const Core::Vector2& in_size)
         {
             InsertDrawCommand();
@@ -117,7 +149,7 @@ namespace ChilliSource
         //-------------------------------------------------------
 		void DynamicSpriteBatch::InsertDrawCommand()
 		{
-            if(!maSpriteCache.empty())
+            if(!m_vertexCache.empty())
             {
                 maRenderCommands.resize(maRenderCommands.size() + 1);
                 
@@ -127,7 +159,7 @@ namespace ChilliSource
                 sLastCommand.m_material = mpLastMaterial;
                 
                 //The offset of the indices for this batch
-                sLastCommand.m_offset = ((static_cast<s32>(maSpriteCache.size()) - mudwSpriteCommandCounter) * k_numSpriteIndices) * sizeof(s16);
+                sLastCommand.m_offset = ((static_cast<s32>(m_vertexCache.size() / k_numSpriteVerts) - mudwSpriteCommandCounter) * k_numSpriteIndices) * sizeof(s16);
                 
                 //The number of indices in this batch
                 sLastCommand.m_stride = mudwSpriteCommandCounter * k_numSpriteIndices;
@@ -145,7 +177,7 @@ namespace ChilliSource
         //-------------------------------------------------------
         void DynamicSpriteBatch::ForceRender()
         {
-            if(!maSpriteCache.empty())
+            if(!m_vertexCache.empty())
             {
                 //Close off the batch
                 InsertDrawCommand();
@@ -164,11 +196,11 @@ namespace ChilliSource
         //----------------------------------------------------------
 		void DynamicSpriteBatch::BuildAndFlushBatch()
         {
-            if(!maSpriteCache.empty())
+            if(!m_vertexCache.empty())
             {
                 //Build the next buffer
-                mpBatch[mudwCurrentRenderSpriteBatch]->Build(maSpriteCache);
-                maSpriteCache.clear();
+                mpBatch[mudwCurrentRenderSpriteBatch]->Build(m_vertexCache.data(), static_cast<u32>(m_vertexCache.size()) / k_numSpriteVerts);
+                m_vertexCache.clear();
             }   
             
             //Loop round all the render commands and draw the sections of the buffer with the correct material
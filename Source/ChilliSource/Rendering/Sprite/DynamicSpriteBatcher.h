@@ -75,6 +75,24 @@ namespace ChilliSource
             /// @param Sprite data to batch
 			//-------------------------------------------------------
 			void Render(const SpriteBatch::SpriteData& inpSprite, const Core::Matrix4 * inpTransform = nullptr);
+            //-------------------------------------------------------
+            /// Batch a block of pre-built sprites which all share
+            /// the same material. This avoids building a SpriteData
+            /// per sprite and allows callers which render many
+            /// sprites, such as particle drawables, to write the
+            /// vertices in a single tight loop. The block will be
+            /// split over multiple flushes if it exceeds the
+            /// capacity of the batch.
+            ///
+            /// @author Carlos Artesano
+            ///
+            /// @param The material shared by all of the sprites.
+            /// @param The sprite vertices. Each sprite should be
+            /// k_numSpriteVerts consecutive vertices in the order
+            /// described by SpriteBatch::Verts.
+            /// @param The number of sprites.
+            //-------------------------------------------------------
+            void Render(const MaterialCSPtr& in_material, const SpriteBatch::SpriteVertex* in_vertices, u32 in_numSprites);
             //-------------------------------------------------------
 			/// Enable scissoring with the given region. Any
             /// subsequent renders to the batcher will be clipped
@@ -123,7 +141,7 @@ namespace ChilliSource
 		private:
         
 			SpriteBatch* mpBatch[kudwNumBuffers];
-			std::vector<SpriteBatch::SpriteData> maSpriteCache;
+			std::vector<SpriteBatch::SpriteVertex> m_vertexCache;
             std::vector<RenderCommand> maRenderCommands;
             
             MaterialCSPtr mpLastMaterial;
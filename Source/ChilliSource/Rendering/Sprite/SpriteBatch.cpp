@@ -32,6 +32,8 @@
 #include <ChilliSource/Rendering/Base/VertexLayouts.h>
 #include <ChilliSource/Rendering/Base/RenderSystem.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
 	namespace Rendering
@@ -94,6 +96,21 @@ namespace ChilliSource
 
 			BuildIndicesForNumberSprites(udwNumSprites);
 		}
+		//------------------------------------------------------
+		//------------------------------------------------------
+		void SpriteBatch::Build(const SpriteVertex* in_vertices, u32 in_numSprites)
+		{
+			mpSpriteBuffer->Bind();
+			mpSpriteBuffer->SetVertexCount(k_numSpriteVerts * in_numSprites);
+			mpSpriteBuffer->SetIndexCount(k_numSpriteIndices * in_numSprites);
+
+			SpriteVertex* vertexBuffer = nullptr;
+			mpSpriteBuffer->LockVertex((f32**)&vertexBuffer, 0, 0);
+			std::copy(in_vertices, in_vertices + k_numSpriteVerts * in_numSprites, vertexBuffer);
+			mpSpriteBuffer->UnlockVertex();
+
+			BuildIndicesForNumberSprites(in_numSprites);
+		}
         //-------------------------------------------------------
         /// Map Sprite Into Buffer
         ///
@@ -93,6 +93,18 @@ namespace ChilliSource
 			//------------------------------------------------------
 			void Build(const std::vector<SpriteData>& in_sprites);
 			//------------------------------------------------------
+			/// Finalise the batch from pre-built sprite vertices.
+			/// Each sprite is expected to be k_numSpriteVerts
+			/// consecutive vertices in the order described by
+			/// Verts. Nothing can be changed once the batch is built.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The sprite vertices.
+			/// @param The number of sprites.
+			//------------------------------------------------------
+			void Build(const SpriteVertex* in_vertices, u32 in_numSprites);
+			//------------------------------------------------------
 			/// Render
 			///
 			/// Draw the contents of the mesh buffer
@@ -168,10 +168,18 @@ namespace ChilliSource
                     (in_interfaceId == RenderComponent::InterfaceID) ||
                     (in_interfaceId == VolumeComponent::InterfaceID);
 		}
+		//----------------------------------------------------------
+		//----------------------------------------------------------
+		bool SpriteComponent::IsUpdatePhaseRequired(UpdatePhase in_phase) const
+		{
+			return false;
+		}
 		//----------------------------------------------------
 		//----------------------------------------------------
 		const Core::AABB& SpriteComponent::GetAABB()
 		{
+            CheckForTransformChange();
+            
             if(IsTextureSizeCacheValid() == false)
             {
                 OnTransformChanged();
@@ -197,6 +205,8 @@ namespace ChilliSource
 		//----------------------------------------------------
 		const Core::OOBB& SpriteComponent::GetOOBB()
 		{
+            CheckForTransformChange();
+            
             if(IsTextureSizeCacheValid() == false)
             {
                 OnTransformChanged();
@@ -223,6 +233,8 @@ namespace ChilliSource
 		//----------------------------------------------------
 		const Core::Sphere& SpriteComponent::GetBoundingSphere()
 		{
+            CheckForTransformChange();
+            
             if(IsTextureSizeCacheValid() == false)
             {
                 OnTransformChanged();
@@ -395,6 +407,8 @@ namespace ChilliSource
         {
             if (ineShaderPass == ShaderPass::k_ambient)
             {
+                CheckForTransformChange();
+                
                 if(IsTextureSizeCacheValid() == false)
                 {
                     OnTransformChanged();
@@ -457,16 +471,24 @@ namespace ChilliSource
 		//----------------------------------------------------
 		void SpriteComponent::OnAddedToScene()
 		{
-			m_transformChangedConnection = GetEntity()->GetTransform().GetTransformChangedEvent().OpenConnection(Core::MakeDelegate(this, &SpriteComponent::OnTransformChanged));
+			m_transformChangeCount = GetEntity()->GetTransform().GetChangeCount();
             
             OnTransformChanged();
 		}
-		//----------------------------------------------------
-		//----------------------------------------------------
-		void SpriteComponent::OnRemovedFromScene()
-		{
-            m_transformChangedConnection = nullptr;
-		}
+        //------------------------------------------------------------
+        //------------------------------------------------------------
+        void SpriteComponent::CheckForTransformChange()
+        {
+            if (GetEntity() != nullptr)
+            {
+                u32 changeCount = GetEntity()->GetTransform().GetChangeCount();
+                if (changeCount != m_transformChangeCount)
+                {
+                    m_transformChangeCount = changeCount;
+                    OnTransformChanged();
+                }
+            }
+        }
         //-----------------------------------------------------------
         /// The image from the texture atlas will have potentially
         /// been cropped by the tool. This will affect the sprites
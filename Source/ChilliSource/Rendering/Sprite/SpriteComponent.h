@@ -97,6 +97,16 @@ namespace ChilliSource
 			/// @return Whether the class matches the comparison type
 			//----------------------------------------------------------
             bool IsA(Core::InterfaceIDType in_interfaceId) const override;
+			//----------------------------------------------------------
+			/// Sprites don't need to be updated so no phases are required.
+			///
+			/// @author Carlos Artesano
+			///
+			/// @param The update phase.
+			///
+			/// @return Whether or not the phase is required.
+			//----------------------------------------------------------
+			bool IsUpdatePhaseRequired(UpdatePhase in_phase) const override;
 			//----------------------------------------------------
             /// The axis aligned bounding box is positioned in
             /// world space but the orientation is aligned to
@@ -298,13 +308,6 @@ namespace ChilliSource
             /// @author S Downie
 			//----------------------------------------------------
 			void OnAddedToScene() override;
-			//----------------------------------------------------
-			/// Triggered when the component is removed from
-			/// an entity on the scene
-            ///
-            /// @author S Downie
-			//----------------------------------------------------
-			void OnRemovedFromScene() override;
             //------------------------------------------------------------
             /// On Transform Changed
             ///
@@ -312,6 +315,15 @@ namespace ChilliSource
             /// We must rebuild our sprite data
             //------------------------------------------------------------
             void OnTransformChanged();
+            //------------------------------------------------------------
+            /// Rebuilds the sprite data if the owning entity's transform
+            /// has changed since it was last checked. The transform
+            /// changed event is deferred until the end of the frame so
+            /// can't be relied on for this.
+            ///
+            /// @author Carlos Artesano
+            //------------------------------------------------------------
+            void CheckForTransformChange();
             //-----------------------------------------------------------
             /// If the transform cache is invalid we must calculate
             /// the corner positions from the new world transform
@@ -351,7 +363,7 @@ namespace ChilliSource
 
 		private:
         
-            Core::EventConnectionUPtr m_transformChangedConnection;
+            u32 m_transformChangeCount = 0;
         
             TextureAtlasCSPtr m_textureAtlas;
             u32 m_hashedTextureAtlasId = 0;
@@ -0,0 +1,274 @@
+#!/usr/bin/python
+#
+#  pack_resources.py
+#  Chilli Source
+#  Created by Carlos Artesano on 19/10/2026.
+#
+#  The MIT License (MIT)
+#
+#  Copyright (c) 2026 Tag Games Limited
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a copy
+#  of this software and associated documentation files (the "Software"), to deal
+#  in the Software without restriction, including without limitation the rights
+#  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#  copies of the Software, and to permit persons to whom the Software is
+#  furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included in
+#  all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#  THE SOFTWARE.
+
+import sys
+import os
+import struct
+import zlib
+
+#----------------------------------------------------------------------
+# Packs the contents of a directory into a packed archive (.cspack)
+# which can be mounted by the engine's file system. See
+# PackedArchive.h for a description of the format.
+#
+# Usage: pack_resources.py <input directory> <output file> [--compress]
+#
+# If --compress is given, files are deflate compressed if doing so
+# saves at least 10% of their size. Compressed files must be
+# decompressed on load, whereas uncompressed files are read in place,
+# so compression should only be used where the size saving matters.
+#
+# @author Carlos Artesano
+#----------------------------------------------------------------------
+
+MAGIC_NUMBER = 0x4B505343
+VERSION = 1
+HEADER_SIZE = 32
+ENTRY_SIZE = 48
+DATA_ALIGNMENT = 16
+DIRECTORY_FLAG = 1
+COMPRESSED_FLAG = 2
+MIN_COMPRESSION_SAVING = 0.1
+
+MASK_64 = 0xFFFFFFFFFFFFFFFF
+PRIME_1 = 11400714785074694791
+PRIME_2 = 14029467366897019727
+PRIME_3 = 1609587929392839161
+PRIME_4 = 9650029242287828579
+PRIME_5 = 2870177450012600261
+
+#----------------------------------------------------------------------
+# @author Carlos Artesano
+#
+# @param The value.
+# @param The number of bits to rotate by.
+#
+# @return The 64-bit value rotated left by the given number of bits.
+#----------------------------------------------------------------------
+def rotate_left(value, bits):
+    return ((value << bits) | (value >> (64 - bits))) & MASK_64
+
+#----------------------------------------------------------------------
+# Applies a single round of xxHash64 to an accumulator.
+#
+# @author Carlos Artesano
+#
+# @param The accumulator.
+# @param The input lane.
+#
+# @return The new accumulator.
+#----------------------------------------------------------------------
+def xxhash64_round(accumulator, lane):
+    accumulator = (accumulator + lane * PRIME_2) & MASK_64
+    accumulator = rotate_left(accumulator, 31)
+    return (accumulator * PRIME_1) & MASK_64
+
+#----------------------------------------------------------------------
+# Calculates the xxHash64 of the given data with a seed of 0. This
+# must match Core::HashXXHash64 as it is used to look up paths.
+#
+# @author Carlos Artesano
+#
+# @param The data.
+#
+# @return The hash.
+#----------------------------------------------------------------------
+def xxhash64(data):
+    length = len(data)
+    index = 0
+
+    if length >= 32:
+        accumulators = [(PRIME_1 + PRIME_2) & MASK_64, PRIME_2, 0, (-PRIME_1) & MASK_64]
+        while index <= length - 32:
+            for lane in range(4):
+                accumulators[lane] = xxhash64_round(accumulators[lane], struct.unpack_from("<Q", data, index + lane * 8)[0])
+            index += 32
+
+        hash = (rotate_left(accumulators[0], 1) + rotate_left(accumulators[1], 7) + rotate_left(accumulators[2], 12) + rotate_left(accumulators[3], 18)) & MASK_64
+        for accumulator in accumulators:
+            hash ^= xxhash64_round(0, accumulator)
+            hash = (hash * PRIME_1 + PRIME_4) & MASK_64
+    else:
+        hash = PRIME_5
+
+    hash = (hash + length) & MASK_64
+
+    while index + 8 <= length:
+        hash ^= xxhash64_round(0, struct.unpack_from("<Q", data, index)[0])
+        hash = (rotate_left(hash, 27) * PRIME_1 + PRIME_4) & MASK_64
+        index += 8
+
+    if index + 4 <= length:
+        hash ^= (struct.unpack_from("<I", data, index)[0] * PRIME_1) & MASK_64
+        hash = (rotate_left(hash, 23) * PRIME_2 + PRIME_3) & MASK_64
+        index += 4
+
+    while index < length:
+        hash ^= (bytearray(data)[index] * PRIME_5) & MASK_64
+        hash = (rotate_left(hash, 11) * PRIME_1) & MASK_64
+        index += 1
+
+    hash ^= hash >> 33
+    hash = (hash * PRIME_2) & MASK_64
+    hash ^= hash >> 29
+    hash = (hash * PRIME_3) & MASK_64
+    hash ^= hash >> 32
+    return hash
+
+#----------------------------------------------------------------------
+# Lists the directories and files in the given directory, with paths
+# relative to it using forward slashes. Directory paths end with a
+# forward slash.
+#
+# @author Carlos Artesano
+#
+# @param The input directory path.
+#
+# @return The list of paths.
+#----------------------------------------------------------------------
+def get_archive_paths(input_dir):
+    paths = []
+    for root, directory_names, file_names in os.walk(input_dir):
+        directory_names.sort()
+        relative_root = os.path.relpath(root, input_dir).replace(os.sep, "/")
+        prefix = "" if relative_root == "." else relative_root + "/"
+
+        for directory_name in directory_names:
+            paths.append(prefix + directory_name + "/")
+        for file_name in sorted(file_names):
+            if file_name != ".DS_Store":
+                paths.append(prefix + file_name)
+    return paths
+
+#----------------------------------------------------------------------
+# @author Carlos Artesano
+#
+# @param The value.
+#
+# @return The smallest power of two greater than or equal to the
+# value, with a minimum of 1.
+#----------------------------------------------------------------------
+def next_power_of_two(value):
+    result = 1
+    while result < value:
+        result *= 2
+    return result
+
+#----------------------------------------------------------------------
+# @author Carlos Artesano
+#
+# @param The offset.
+#
+# @return The offset rounded up to the data alignment.
+#----------------------------------------------------------------------
+def align(offset):
+    return (offset + DATA_ALIGNMENT - 1) // DATA_ALIGNMENT * DATA_ALIGNMENT
+
+#----------------------------------------------------------------------
+# Packs the contents of the input directory into a packed archive.
+#
+# @author Carlos Artesano
+#
+# @param The input directory path.
+# @param The output file path.
+# @param Whether or not to compress files where worthwhile.
+#----------------------------------------------------------------------
+def pack_resources(input_dir, output_file_path, compress):
+    entries = []
+    for path in get_archive_paths(input_dir):
+        encoded_path = path.encode("utf-8")
+        entry = { "path" : encoded_path, "hash" : xxhash64(encoded_path), "flags" : 0, "data" : b"", "uncompressed_size" : 0 }
+
+        if path.endswith("/"):
+            entry["flags"] = DIRECTORY_FLAG
+        else:
+            with open(os.path.join(input_dir, path), "rb") as file:
+                data = file.read()
+            entry["data"] = data
+            entry["uncompressed_size"] = len(data)
+
+            if compress == True and len(data) > 0:
+                compressed_data = zlib.compress(data, 9)
+                if len(compressed_data) <= len(data) * (1.0 - MIN_COMPRESSION_SAVING):
+                    entry["data"] = compressed_data
+                    entry["flags"] |= COMPRESSED_FLAG
+
+        entries.append(entry)
+
+    num_buckets = next_power_of_two(len(entries))
+    entries.sort(key=lambda entry: (entry["hash"] & (num_buckets - 1), entry["path"]))
+
+    bucket_starts = [0] * (num_buckets + 1)
+    for entry in entries:
+        bucket_starts[(entry["hash"] & (num_buckets - 1)) + 1] += 1
+    for bucket in range(num_buckets):
+        bucket_starts[bucket + 1] += bucket_starts[bucket]
+
+    entry_table_offset = align(HEADER_SIZE + (num_buckets + 1) * 4)
+    string_table_offset = entry_table_offset + len(entries) * ENTRY_SIZE
+
+    string_table = b""
+    for entry in entries:
+        entry["path_offset"] = len(string_table)
+        string_table += entry["path"]
+
+    data_offset = align(string_table_offset + len(string_table))
+    for entry in entries:
+        entry["data_offset"] = data_offset
+        data_offset = align(data_offset + len(entry["data"]))
+
+    with open(output_file_path, "wb") as output:
+        output.write(struct.pack("<IIIIQQ", MAGIC_NUMBER, VERSION, len(entries), num_buckets, entry_table_offset, string_table_offset))
+        for bucket_start in bucket_starts:
+            output.write(struct.pack("<I", bucket_start))
+
+        output.write(b"\0" * (entry_table_offset - output.tell()))
+        for entry in entries:
+            output.write(struct.pack("<QQQQIIII", entry["hash"], entry["data_offset"], len(entry["data"]), entry["uncompressed_size"], entry["path_offset"], len(entry["path"]), entry["flags"], 0))
+
+        output.write(string_table)
+        for entry in entries:
+            output.write(b"\0" * (entry["data_offset"] - output.tell()))
+            output.write(entry["data"])
+
+#----------------------------------------------------------------------
+# The entry point into the script.
+#
+# @author Carlos Artesano
+#
+# @param The list of arguments.
+#----------------------------------------------------------------------
+def main(args):
+    if len(args) < 3 or len(args) > 4 or (len(args) == 4 and args[3] != "--compress"):
+        print("ERROR: Usage: pack_resources.py <input directory> <output file> [--compress]")
+        return
+
+    pack_resources(args[1], args[2], len(args) == 4)
+
+if __name__ == "__main__":
+    main(sys.argv)